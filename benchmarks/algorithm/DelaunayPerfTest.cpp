@@ -0,0 +1,206 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2021 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/triangulate/ConstrainedDelaunayTriangulationBuilder.h>
+#include <geos/triangulate/DelaunayTriangulationBuilder.h>
+#include <geos/triangulate/IncrementalDelaunayTriangulator.h>
+#include <geos/triangulate/quadedge/JumpAndWalkQuadEdgeLocator.h>
+#include <geos/triangulate/quadedge/QuadEdgeSubdivision.h>
+#include <geos/geom/CoordinateArraySequence.h>
+#include <geos/geom/Envelope.h>
+#include <geos/geom/GeometryCollection.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/Polygon.h>
+#include <geos/profiler.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include <memory>
+
+using geos::triangulate::DelaunayTriangulationBuilder;
+using geos::triangulate::IncrementalDelaunayTriangulator;
+using InsertionOrder = DelaunayTriangulationBuilder::InsertionOrder;
+
+class DelaunayPerfTest {
+
+public:
+    void test(std::size_t num_points) {
+        using namespace geos::geom;
+
+        std::cout << num_points << " points" << std::endl;
+
+        // square grid, as produced by gridded LiDAR or DEM input
+        CoordinateArraySequence grid;
+        std::size_t side = static_cast<std::size_t>(std::sqrt(num_points));
+        for(std::size_t i = 0; i < side; i++) {
+            for(std::size_t j = 0; j < side; j++) {
+                grid.add(Coordinate(static_cast<double>(i), static_cast<double>(j)));
+            }
+        }
+
+        // dense gaussian clusters
+        std::default_random_engine e(12345);
+        std::uniform_real_distribution<> center(0, 1000);
+        std::normal_distribution<> spread(0, 5);
+        CoordinateArraySequence clustered;
+        while(clustered.size() < num_points) {
+            double cx = center(e);
+            double cy = center(e);
+            for(int k = 0; k < 1000 && clustered.size() < num_points; k++) {
+                clustered.add(Coordinate(cx + spread(e), cy + spread(e)));
+            }
+        }
+
+        for(auto order : { InsertionOrder::LEXICOGRAPHIC, InsertionOrder::HILBERT, InsertionOrder::BRIO }) {
+            delaunay("grid", grid, order);
+            delaunay("clustered", clustered, order);
+        }
+
+        parallel("grid", grid);
+        parallel("clustered", clustered);
+
+        compact("grid", grid);
+        compact("clustered", clustered);
+
+        randomOrder("clustered", clustered, false);
+        randomOrder("clustered", clustered, true);
+
+        constrained(num_points);
+
+        std::cout << std::endl;
+    }
+
+private:
+    geos::util::Profiler* profiler = geos::util::Profiler::instance();
+
+    static std::string
+    orderName(InsertionOrder order)
+    {
+        switch(order) {
+        case InsertionOrder::HILBERT:
+            return "Hilbert";
+        case InsertionOrder::BRIO:
+            return "BRIO";
+        default:
+            return "lexicographic";
+        }
+    }
+
+    void delaunay(const std::string& name, const geos::geom::CoordinateSequence& seq, InsertionOrder order) {
+        auto sw = profiler->get("Delaunay " + name + " " + orderName(order));
+        sw->start();
+
+        DelaunayTriangulationBuilder dtb;
+        dtb.setInsertionOrder(order);
+        dtb.setSites(seq);
+        dtb.getSubdivision();
+
+        sw->stop();
+        std::cout << sw->name << ": " << *sw << std::endl;
+    }
+
+    void parallel(const std::string& name, const geos::geom::CoordinateSequence& seq) {
+        std::size_t numThreads = std::max(2u, std::thread::hardware_concurrency());
+        auto sw = profiler->get("Delaunay " + name + " divide-and-conquer " + std::to_string(numThreads) + " threads");
+        sw->start();
+
+        DelaunayTriangulationBuilder dtb;
+        dtb.setNumThreads(numThreads);
+        dtb.setSites(seq);
+        dtb.getSubdivision();
+
+        sw->stop();
+        std::cout << sw->name << ": " << *sw << std::endl;
+    }
+
+    // Triangulates and extracts the triangles with and without the compact subdivision
+    void compact(const std::string& name, const geos::geom::CoordinateSequence& seq) {
+        auto gf = geos::geom::GeometryFactory::create();
+        for(bool isCompact : { false, true }) {
+            auto sw = profiler->get("Delaunay " + name + " BRIO triangles" + (isCompact ? " compact" : " quadedge"));
+            sw->start();
+
+            DelaunayTriangulationBuilder dtb;
+            dtb.setInsertionOrder(InsertionOrder::BRIO);
+            dtb.setCompact(isCompact);
+            dtb.setSites(seq);
+            dtb.getTriangles(*gf);
+
+            sw->stop();
+            std::cout << sw->name << ": " << *sw << std::endl;
+        }
+    }
+
+    // Triangulates a star-shaped polygon with a jagged boundary
+    void constrained(std::size_t num_points) {
+        using namespace geos::geom;
+
+        std::default_random_engine e(6789);
+        std::uniform_real_distribution<> radius(500, 1000);
+        std::unique_ptr<CoordinateArraySequence> shell(new CoordinateArraySequence());
+        for(std::size_t i = 0; i < num_points; i++) {
+            double a = 2 * M_PI * static_cast<double>(i) / static_cast<double>(num_points);
+            double r = radius(e);
+            shell->add(Coordinate(r * std::cos(a), r * std::sin(a)));
+        }
+        shell->add(shell->getAt(0));
+
+        auto gf = GeometryFactory::create();
+        auto poly = gf->createPolygon(gf->createLinearRing(std::move(shell)));
+
+        auto sw = profiler->get("Constrained Delaunay polygon");
+        sw->start();
+
+        geos::triangulate::ConstrainedDelaunayTriangulationBuilder cdtb;
+        cdtb.setConstraints(*poly);
+        cdtb.getTriangles(*gf);
+
+        sw->stop();
+        std::cout << sw->name << ": " << *sw << std::endl;
+    }
+
+    // Inserts sites in random order, with the default or the jump-and-walk locator
+    void randomOrder(const std::string& name, const geos::geom::CoordinateSequence& seq, bool jumpAndWalk) {
+        using namespace geos::triangulate::quadedge;
+
+        auto vertices = DelaunayTriangulationBuilder::toVertices(seq);
+        std::shuffle(vertices.begin(), vertices.end(), std::default_random_engine(54321));
+
+        auto sw = profiler->get("Delaunay " + name + " random order" + (jumpAndWalk ? " jump-and-walk" : " last found"));
+        sw->start();
+
+        QuadEdgeSubdivision subdiv(DelaunayTriangulationBuilder::envelope(seq), 0.0);
+        if(jumpAndWalk) {
+            subdiv.setLocator(std::unique_ptr<QuadEdgeLocator>(new JumpAndWalkQuadEdgeLocator(&subdiv)));
+        }
+        IncrementalDelaunayTriangulator triangulator(&subdiv);
+        triangulator.insertSites(vertices);
+
+        sw->stop();
+        std::cout << sw->name << ": " << *sw << std::endl;
+    }
+};
+
+int main() {
+    DelaunayPerfTest tester;
+
+    tester.test(10000);
+    tester.test(100000);
+    tester.test(1000000);
+}
@@ -41,6 +41,7 @@ public:
 
         voronoi(seq);
         voronoi(*geom);
+        voronoiCells(seq);
 
         delaunay(seq);
         delaunay(*geom);
@@ -65,6 +66,19 @@ private:
         std::cout << sw->name << ": " << result->getNumGeometries() << ": " << *sw << std::endl;
     }
 
+    void voronoiCells(const geos::geom::CoordinateSequence & sites) {
+        auto sw = profiler->get(std::string("Voronoi cells"));
+        sw->start();
+
+        geos::triangulate::VoronoiDiagramBuilder vdb;
+        vdb.setSites(sites);
+
+        auto result = vdb.getDiagramCells();
+
+        sw->stop();
+        std::cout << sw->name << ": " << result.getNumCells() << ": " << *sw << std::endl;
+    }
+
     template<typename T>
     void delaunay(const T & seq) {
         auto sw = profiler->get(std::string("Delaunay from ") + typeid(T).name());
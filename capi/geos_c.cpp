@@ -273,6 +273,31 @@ extern "C" {
         return GEOSDistanceIndexed_r(handle, g1, g2, dist);
     }
 
+    char
+    GEOSDistanceWithin(const Geometry* g1, const Geometry* g2, double dist)
+    {
+        return GEOSDistanceWithin_r(handle, g1, g2, dist);
+    }
+
+    int
+    GEOSDistanceMatrix(const Geometry* const* geoms1, unsigned int n1,
+                       const Geometry* const* geoms2, unsigned int n2,
+                       double maxDistance, unsigned int numThreads, double* distances)
+    {
+        return GEOSDistanceMatrix_r(handle, geoms1, n1, geoms2, n2, maxDistance, numThreads, distances);
+    }
+
+    int
+    GEOSDistanceMatrixSparse(const Geometry* const* geoms1, unsigned int n1,
+                             const Geometry* const* geoms2, unsigned int n2,
+                             double maxDistance, unsigned int numThreads,
+                             unsigned int** indices1, unsigned int** indices2,
+                             double** distances, unsigned int* numPairs)
+    {
+        return GEOSDistanceMatrixSparse_r(handle, geoms1, n1, geoms2, n2, maxDistance, numThreads,
+                                          indices1, indices2, distances, numPairs);
+    }
+
     int
     GEOSHausdorffDistance(const Geometry* g1, const Geometry* g2, double* dist)
     {
@@ -449,6 +474,24 @@ extern "C" {
         return GEOSConvexHull_r(handle, g);
     }
 
+    Geometry*
+    GEOSConcaveHull(const Geometry* g, double ratio)
+    {
+        return GEOSConcaveHull_r(handle, g, ratio);
+    }
+
+    Geometry*
+    GEOSConcaveHullByLength(const Geometry* g, double length)
+    {
+        return GEOSConcaveHullByLength_r(handle, g, length);
+    }
+
+    Geometry*
+    GEOSAlphaShape(const Geometry* g, double alpha)
+    {
+        return GEOSAlphaShape_r(handle, g, alpha);
+    }
+
     Geometry*
     GEOSMinimumRotatedRectangle(const Geometry* g)
     {
@@ -1061,6 +1104,12 @@ extern "C" {
         return GEOSTopologyPreserveSimplify_r(handle, g, tolerance);
     }
 
+    Geometry*
+    GEOSSimplifyVW(const Geometry* g, double tolerance)
+    {
+        return GEOSSimplifyVW_r(handle, g, tolerance);
+    }
+
 
     /* WKT Reader */
     WKTReader*
@@ -1298,6 +1347,19 @@ extern "C" {
         return GEOSPreparedWithin_r(handle, pg1, g2);
     }
 
+    char*
+    GEOSPreparedRelate(const geos::geom::prep::PreparedGeometry* pg1, const Geometry* g2)
+    {
+        return GEOSPreparedRelate_r(handle, pg1, g2);
+    }
+
+    char
+    GEOSPreparedRelatePattern(const geos::geom::prep::PreparedGeometry* pg1, const Geometry* g2,
+                              const char* pat)
+    {
+        return GEOSPreparedRelatePattern_r(handle, pg1, g2, pat);
+    }
+
     CoordinateSequence*
     GEOSPreparedNearestPoints(const geos::geom::prep::PreparedGeometry* g1, const Geometry* g2)
     {
@@ -1310,6 +1372,12 @@ extern "C" {
         return GEOSPreparedDistance_r(handle, g1, g2, dist);
     }
 
+    char
+    GEOSPreparedDistanceWithin(const geos::geom::prep::PreparedGeometry* g1, const Geometry* g2, double dist)
+    {
+        return GEOSPreparedDistanceWithin_r(handle, g1, g2, dist);
+    }
+
     GEOSSTRtree*
     GEOSSTRtree_create(std::size_t nodeCapacity)
     {
@@ -1502,6 +1570,21 @@ extern "C" {
         return GEOSDelaunayTriangulation_r(handle, g, tolerance, onlyEdges);
     }
 
+    Geometry*
+    GEOSConstrainedDelaunayTriangulation(const Geometry* g)
+    {
+        return GEOSConstrainedDelaunayTriangulation_r(handle, g);
+    }
+
+    int
+    GEOSDelaunayTriangulationMesh(const Geometry* g, double tolerance,
+                                  double** vertices, unsigned int* numVertices,
+                                  int** triangles, int** neighbours, unsigned int* numTriangles)
+    {
+        return GEOSDelaunayTriangulationMesh_r(handle, g, tolerance, vertices, numVertices,
+                                               triangles, neighbours, numTriangles);
+    }
+
     Geometry*
     GEOSVoronoiDiagram(const Geometry* g, const Geometry* env, double tolerance, int onlyEdges)
     {
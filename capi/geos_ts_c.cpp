@@ -50,15 +50,18 @@
 #include <geos/algorithm/Orientation.h>
 #include <geos/algorithm/construct/MaximumInscribedCircle.h>
 #include <geos/algorithm/construct/LargestEmptyCircle.h>
+#include <geos/algorithm/hull/ConcaveHull.h>
 #include <geos/algorithm/distance/DiscreteHausdorffDistance.h>
 #include <geos/algorithm/distance/DiscreteFrechetDistance.h>
 #include <geos/simplify/DouglasPeuckerSimplifier.h>
 #include <geos/simplify/TopologyPreservingSimplifier.h>
+#include <geos/simplify/VisvalingamWhyattSimplifier.h>
 #include <geos/noding/GeometryNoder.h>
 #include <geos/noding/Noder.h>
 #include <geos/operation/buffer/BufferBuilder.h>
 #include <geos/operation/buffer/BufferOp.h>
 #include <geos/operation/buffer/BufferParameters.h>
+#include <geos/operation/distance/DistanceMatrix.h>
 #include <geos/operation/distance/DistanceOp.h>
 #include <geos/operation/distance/IndexedFacetDistance.h>
 #include <geos/operation/linemerge/LineMerger.h>
@@ -80,6 +83,7 @@
 #include <geos/operation/valid/MakeValid.h>
 #include <geos/precision/GeometryPrecisionReducer.h>
 #include <geos/linearref/LengthIndexedLine.h>
+#include <geos/triangulate/ConstrainedDelaunayTriangulationBuilder.h>
 #include <geos/triangulate/DelaunayTriangulationBuilder.h>
 #include <geos/triangulate/VoronoiDiagramBuilder.h>
 #include <geos/util.h>
@@ -101,6 +105,7 @@
 #include <sstream>
 #include <string>
 #include <memory>
+#include <new>
 
 #ifdef _MSC_VER
 #pragma warning(disable : 4099)
@@ -156,6 +161,7 @@ using geos::algorithm::distance::DiscreteHausdorffDistance;
 
 using geos::operation::buffer::BufferBuilder;
 using geos::operation::buffer::BufferParameters;
+using geos::operation::distance::DistanceMatrix;
 using geos::operation::distance::IndexedFacetDistance;
 using geos::operation::geounion::CascadedPolygonUnion;
 using geos::operation::overlayng::OverlayNG;
@@ -797,6 +803,75 @@ extern "C" {
         });
     }
 
+    char
+    GEOSDistanceWithin_r(GEOSContextHandle_t extHandle, const Geometry* g1, const Geometry* g2, double dist)
+    {
+        return execute(extHandle, 2, [&]() {
+            return g1->isWithinDistance(g2, dist);
+        });
+    }
+
+    int
+    GEOSDistanceMatrix_r(GEOSContextHandle_t extHandle,
+                         const Geometry* const* geoms1, unsigned int n1,
+                         const Geometry* const* geoms2, unsigned int n2,
+                         double maxDistance, unsigned int numThreads,
+                         double* distances)
+    {
+        return execute(extHandle, 0, [&]() {
+            DistanceMatrix matrix(std::vector<const Geometry*>(geoms1, geoms1 + n1),
+                                  std::vector<const Geometry*>(geoms2, geoms2 + n2));
+            matrix.setMaxDistance(maxDistance);
+            matrix.setNumThreads(numThreads);
+            matrix.getDense(distances);
+            return 1;
+        });
+    }
+
+    int
+    GEOSDistanceMatrixSparse_r(GEOSContextHandle_t extHandle,
+                               const Geometry* const* geoms1, unsigned int n1,
+                               const Geometry* const* geoms2, unsigned int n2,
+                               double maxDistance, unsigned int numThreads,
+                               unsigned int** indices1, unsigned int** indices2,
+                               double** distances, unsigned int* numPairs)
+    {
+        return execute(extHandle, 0, [&]() {
+            DistanceMatrix matrix(std::vector<const Geometry*>(geoms1, geoms1 + n1),
+                                  std::vector<const Geometry*>(geoms2, geoms2 + n2));
+            matrix.setMaxDistance(maxDistance);
+            matrix.setNumThreads(numThreads);
+            auto entries = matrix.getSparse();
+
+            // allocate an array the caller frees with GEOSFree
+            auto allocate = [&entries](std::size_t elementSize) {
+                if(entries.empty()) {
+                    return static_cast<void*>(nullptr);
+                }
+                void* buf = malloc(entries.size() * elementSize);
+                if(!buf) {
+                    throw std::bad_alloc();
+                }
+                return buf;
+            };
+
+            std::unique_ptr<void, decltype(&free)> ibuf1(allocate(sizeof(unsigned int)), free);
+            std::unique_ptr<void, decltype(&free)> ibuf2(allocate(sizeof(unsigned int)), free);
+            std::unique_ptr<void, decltype(&free)> dbuf(allocate(sizeof(double)), free);
+            for(std::size_t k = 0; k < entries.size(); k++) {
+                static_cast<unsigned int*>(ibuf1.get())[k] = static_cast<unsigned int>(entries[k].index1);
+                static_cast<unsigned int*>(ibuf2.get())[k] = static_cast<unsigned int>(entries[k].index2);
+                static_cast<double*>(dbuf.get())[k] = entries[k].distance;
+            }
+
+            *indices1 = static_cast<unsigned int*>(ibuf1.release());
+            *indices2 = static_cast<unsigned int*>(ibuf2.release());
+            *distances = static_cast<double*>(dbuf.release());
+            *numPairs = static_cast<unsigned int>(entries.size());
+            return 1;
+        });
+    }
+
     int
     GEOSHausdorffDistance_r(GEOSContextHandle_t extHandle, const Geometry* g1, const Geometry* g2, double* dist)
     {
@@ -1174,6 +1249,42 @@ extern "C" {
         });
     }
 
+    Geometry*
+    GEOSConcaveHull_r(GEOSContextHandle_t extHandle, const Geometry* g1, double ratio)
+    {
+        using geos::algorithm::hull::ConcaveHull;
+
+        return execute(extHandle, [&]() {
+            auto g3 = ConcaveHull::concaveHullByLengthRatio(g1, ratio);
+            g3->setSRID(g1->getSRID());
+            return g3.release();
+        });
+    }
+
+    Geometry*
+    GEOSConcaveHullByLength_r(GEOSContextHandle_t extHandle, const Geometry* g1, double length)
+    {
+        using geos::algorithm::hull::ConcaveHull;
+
+        return execute(extHandle, [&]() {
+            auto g3 = ConcaveHull::concaveHullByLength(g1, length);
+            g3->setSRID(g1->getSRID());
+            return g3.release();
+        });
+    }
+
+    Geometry*
+    GEOSAlphaShape_r(GEOSContextHandle_t extHandle, const Geometry* g1, double alpha)
+    {
+        using geos::algorithm::hull::ConcaveHull;
+
+        return execute(extHandle, [&]() {
+            auto g3 = ConcaveHull::alphaShape(g1, alpha);
+            g3->setSRID(g1->getSRID());
+            return g3.release();
+        });
+    }
+
 
     Geometry*
     GEOSMinimumRotatedRectangle_r(GEOSContextHandle_t extHandle, const Geometry* g)
@@ -2578,6 +2689,18 @@ extern "C" {
         });
     }
 
+    Geometry*
+    GEOSSimplifyVW_r(GEOSContextHandle_t extHandle, const Geometry* g1, double tolerance)
+    {
+        using namespace geos::simplify;
+
+        return execute(extHandle, [&]() {
+            Geometry::Ptr g3(VisvalingamWhyattSimplifier::simplify(g1, tolerance));
+            g3->setSRID(g1->getSRID());
+            return g3.release();
+        });
+    }
+
 
     /* WKT Reader */
     WKTReader*
@@ -2940,6 +3063,31 @@ extern "C" {
         });
     }
 
+    char*
+    GEOSPreparedRelate_r(GEOSContextHandle_t extHandle,
+                         const geos::geom::prep::PreparedGeometry* pg, const Geometry* g)
+    {
+        return execute(extHandle, [&]() -> char* {
+            auto im = pg->relate(g);
+            if(im == nullptr) {
+                return nullptr;
+            }
+
+            return gstrdup(im->toString());
+        });
+    }
+
+    char
+    GEOSPreparedRelatePattern_r(GEOSContextHandle_t extHandle,
+                                const geos::geom::prep::PreparedGeometry* pg, const Geometry* g,
+                                const char* pat)
+    {
+        return execute(extHandle, 2, [&]() {
+            std::string s(pat);
+            return pg->relate(g, s);
+        });
+    }
+
     CoordinateSequence*
     GEOSPreparedNearestPoints_r(GEOSContextHandle_t extHandle,
                          const geos::geom::prep::PreparedGeometry* pg, const Geometry* g)
@@ -2962,6 +3110,16 @@ extern "C" {
         });
     }
 
+    char
+    GEOSPreparedDistanceWithin_r(GEOSContextHandle_t extHandle,
+                         const geos::geom::prep::PreparedGeometry* pg,
+                         const Geometry* g, double dist)
+    {
+        return execute(extHandle, 2, [&]() {
+            return pg->isWithinDistance(g, dist);
+        });
+    }
+
 //-----------------------------------------------------------------
 // STRtree
 //-----------------------------------------------------------------
@@ -3388,6 +3546,67 @@ extern "C" {
         });
     }
 
+    Geometry*
+    GEOSConstrainedDelaunayTriangulation_r(GEOSContextHandle_t extHandle, const Geometry* g1)
+    {
+        using geos::triangulate::ConstrainedDelaunayTriangulationBuilder;
+
+        return execute(extHandle, [&]() -> Geometry* {
+            ConstrainedDelaunayTriangulationBuilder builder;
+            builder.setConstraints(*g1);
+
+            Geometry* out = builder.getTriangles(*g1->getFactory()).release();
+            out->setSRID(g1->getSRID());
+            return out;
+        });
+    }
+
+    int
+    GEOSDelaunayTriangulationMesh_r(GEOSContextHandle_t extHandle, const Geometry* g1, double tolerance,
+                                    double** vertices, unsigned int* numVertices,
+                                    int** triangles, int** neighbours, unsigned int* numTriangles)
+    {
+        using geos::triangulate::DelaunayTriangulationBuilder;
+        static_assert(sizeof(int) == sizeof(int32_t), "mesh indices are copied as int");
+
+        return execute(extHandle, 0, [&]() {
+            DelaunayTriangulationBuilder builder;
+            builder.setTolerance(tolerance);
+            builder.setSites(*g1);
+
+            auto mesh = builder.getTriangleMesh(neighbours != nullptr);
+
+            // copy a mesh array to a buffer the caller frees with GEOSFree
+            auto copyOut = [](const void* data, std::size_t size) {
+                if(size == 0) {
+                    return static_cast<void*>(nullptr);
+                }
+                void* buf = malloc(size);
+                if(!buf) {
+                    throw std::bad_alloc();
+                }
+                std::memcpy(buf, data, size);
+                return buf;
+            };
+
+            std::unique_ptr<void, decltype(&free)> vbuf(
+                copyOut(mesh.vertices.data(), mesh.vertices.size() * sizeof(double)), free);
+            std::unique_ptr<void, decltype(&free)> tbuf(
+                copyOut(mesh.triangles.data(), mesh.triangles.size() * sizeof(int32_t)), free);
+            std::unique_ptr<void, decltype(&free)> nbuf(
+                copyOut(mesh.neighbours.data(), mesh.neighbours.size() * sizeof(int32_t)), free);
+
+            *vertices = static_cast<double*>(vbuf.release());
+            *numVertices = static_cast<unsigned int>(mesh.getNumVertices());
+            *triangles = static_cast<int*>(tbuf.release());
+            *numTriangles = static_cast<unsigned int>(mesh.getNumTriangles());
+            if(neighbours) {
+                *neighbours = static_cast<int*>(nbuf.release());
+            }
+            return 1;
+        });
+    }
+
     Geometry*
     GEOSVoronoiDiagram_r(GEOSContextHandle_t extHandle, const Geometry* g1, const Geometry* env, double tolerance,
                          int onlyEdges)
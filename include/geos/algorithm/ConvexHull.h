@@ -39,6 +39,7 @@ namespace geos {
 namespace geom {
 class Geometry;
 class GeometryFactory;
+class PointSet;
 }
 }
 
@@ -177,6 +178,69 @@ public:
      *         1 point, a Point; 0 points, an empty GeometryCollection.
      */
     std::unique_ptr<geom::Geometry> getConvexHull();
+
+    /**
+     * Computes the convex hull of points given as arrays of ordinates,
+     * without building a Geometry. This suits very large point sets.
+     *
+     * The points are reduced by discarding those strictly inside the
+     * polygon of their extreme points in 8 directions (Akl-Toussaint),
+     * in chunks processed concurrently. The extreme points are searched
+     * block by block with branch-free loops, which the compiler can
+     * vectorize. The hull of the remaining points is computed by the
+     * monotone chain algorithm.
+     *
+     * The ordinates of point `i` are `x[i * stride]` and `y[i * stride]`,
+     * so separate X and Y arrays have a stride of 1, and interleaved
+     * XY or XYZ arrays have a stride of 2 or 3.
+     *
+     * @param x the X ordinate of the first point
+     * @param y the Y ordinate of the first point
+     * @param n the number of points
+     * @param stride the number of doubles between consecutive points
+     * @param hull receives the indices of the hull vertices, in CCW order,
+     *             without collinear vertices and without repeating the
+     *             first one. Equal points are reported once.
+     * @param numThreads the number of threads; 0 or 1 runs sequentially
+     */
+    static void computeHull(const double* x, const double* y,
+                            std::size_t n, std::size_t stride,
+                            std::vector<std::size_t>& hull,
+                            std::size_t numThreads = 1);
+
+    /**
+     * Computes the convex hull of points given as arrays of ordinates,
+     * as a Geometry.
+     *
+     * @return the same geometry as getConvexHull() for these points,
+     *         with 2D coordinates
+     *
+     * @see computeHull
+     */
+    static std::unique_ptr<geom::Geometry> getConvexHull(
+        const double* x, const double* y,
+        std::size_t n, std::size_t stride,
+        const geom::GeometryFactory& geomFact,
+        std::size_t numThreads = 1);
+
+    /**
+     * Computes the convex hull of a PointSet.
+     *
+     * @see computeHull
+     */
+    static void computeHull(const geom::PointSet& pts,
+                            std::vector<std::size_t>& hull,
+                            std::size_t numThreads = 1);
+
+    /**
+     * Computes the convex hull of a PointSet, as a Geometry.
+     *
+     * @return the same geometry as getConvexHull() for these points
+     */
+    static std::unique_ptr<geom::Geometry> getConvexHull(
+        const geom::PointSet& pts,
+        const geom::GeometryFactory& geomFact,
+        std::size_t numThreads = 1);
 };
 
 } // namespace geos::algorithm
@@ -24,6 +24,7 @@
 #include <geos/geom/CoordinateSequence.h>
 #include <geos/geom/Geometry.h>
 #include <geos/geom/Point.h>
+#include <geos/geom/PointSet.h>
 #include <geos/geom/Triangle.h>
 
 #include <vector>
@@ -45,6 +46,8 @@ private:
 
     // member variables
     const geom::Geometry* input;
+    geom::PointSet inputPts;
+    const geom::GeometryFactory* geomFactory;
     std::vector<geom::Coordinate> extremalPts;
     geom::Coordinate centre;
     double radius;
@@ -57,6 +60,8 @@ private:
     geom::Coordinate pointWithMinAngleWithSegment(std::vector<geom::Coordinate>& pts,
             geom::Coordinate& P, geom::Coordinate& Q);
     std::vector<geom::Coordinate> farthestPoints(std::vector<geom::Coordinate>& pts);
+    std::vector<geom::Coordinate> hullPoints();
+    uint8_t getCoordinateDimension() const;
 
 
 public:
@@ -66,6 +71,23 @@ public:
         radius(0.0)
     {
         input = geom;
+        geomFactory = geom->getFactory();
+        centre.setNull();
+    }
+
+    /**
+    * Creates a Minimum Bounding Circle computation for points given
+    * as arrays of ordinates, without building a MultiPoint.
+    *
+    * @param pts the input points, whose arrays must outlive the computation
+    * @param geomFact the factory of the output geometries
+    */
+    MinimumBoundingCircle(const geom::PointSet& pts, const geom::GeometryFactory& geomFact):
+        input(nullptr),
+        inputPts(pts),
+        geomFactory(&geomFact),
+        radius(0.0)
+    {
         centre.setNull();
     }
 
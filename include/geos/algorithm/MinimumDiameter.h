@@ -22,6 +22,7 @@
 
 #include <geos/geom/Coordinate.h>
 #include <geos/geom/LineSegment.h>
+#include <geos/geom/PointSet.h>
 
 #include <memory>
 #include <geos/export.h>
@@ -30,6 +31,7 @@
 namespace geos {
 namespace geom {
 class Geometry;
+class GeometryFactory;
 class LineString;
 class CoordinateSequence;
 }
@@ -63,6 +65,8 @@ namespace algorithm { // geos::algorithm
 class GEOS_DLL MinimumDiameter {
 private:
     const geom::Geometry* inputGeom;
+    geom::PointSet inputPts;
+    const geom::GeometryFactory* geomFactory;
     bool isConvex;
 
     std::unique_ptr<geom::CoordinateSequence> convexHullPts;
@@ -115,6 +119,16 @@ public:
     MinimumDiameter(const geom::Geometry* newInputGeom,
                     const bool newIsConvex);
 
+    /** \brief
+     * Compute a minimum diameter for points given as arrays of ordinates,
+     * without building a MultiPoint.
+     *
+     * @param pts the input points, whose arrays must outlive the computation
+     * @param geomFact the factory of the output geometries
+     */
+    MinimumDiameter(const geom::PointSet& pts,
+                    const geom::GeometryFactory& geomFact);
+
     /** \brief
      * Gets the length of the minimum diameter of the input Geometry.
      *
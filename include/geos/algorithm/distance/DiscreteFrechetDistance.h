@@ -102,6 +102,12 @@ namespace distance { // geos::algorithm::distance
  *   DFD(A, B)  = 200
  *   DFD(A, B') = 282.842712474619
  * </pre>
+ *
+ * The couplings are computed row by row, keeping only two rows, so the
+ * memory used is linear in the number of discrete points.
+ * isWithinDistance() decides whether the distance is within a threshold,
+ * sweeping only the band of pairs reachable within it and stopping as
+ * soon as the band vanishes.
  */
 class GEOS_DLL DiscreteFrechetDistance {
 public:
@@ -112,6 +118,9 @@ public:
     static double distance(const geom::Geometry& g0,
                            const geom::Geometry& g1, double densifyFrac);
 
+    static bool isWithinDistance(const geom::Geometry& g0,
+                                 const geom::Geometry& g1, double maxDistance);
+
     DiscreteFrechetDistance(const geom::Geometry& p_g0,
                             const geom::Geometry& p_g1)
         :
@@ -147,6 +156,17 @@ public:
         return ptDist.getDistance();
     }
 
+    /**
+     * Tests whether the discrete Frechet distance is at most a given
+     * distance, without computing it.
+     *
+     * The result is the same as distance() <= maxDistance.
+     *
+     * @param maxDistance the distance to test
+     * @return true if the distance is at most maxDistance
+     */
+    bool isWithinDistance(double maxDistance);
+
     const std::array<geom::Coordinate, 2>
     getCoordinates() const
     {
@@ -156,8 +176,8 @@ public:
 private:
     geom::Coordinate getSegementAt(const geom::CoordinateSequence& seq, std::size_t index);
 
-    PointPairDistance& getFrecheDistance(std::vector< std::vector<PointPairDistance> >& ca, std::size_t i, std::size_t j,
-                                         const geom::CoordinateSequence& p, const geom::CoordinateSequence& q);
+    /// The discrete points of a geometry, densified if required
+    std::vector<geom::Coordinate> getDiscretePoints(const geom::Geometry& g);
 
     void compute(const geom::Geometry& discreteGeom, const geom::Geometry& geom);
 
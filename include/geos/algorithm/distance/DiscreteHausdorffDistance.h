@@ -96,6 +96,13 @@ namespace distance { // geos::algorithm::distance
  *   DHD(A, B) = 22.360679774997898
  *   HD(A, B) ~= 47.8
  * </pre>
+ *
+ * When the geometry measured against is large, its segments are
+ * indexed in an STRtree of facet sequences, which is searched nearest
+ * first for each discrete point. A search stops as soon as the point is
+ * found to be no farther than the maximum distance found so far, since
+ * it can no longer raise the maximum. The discrete points can be
+ * processed by several threads (see setNumThreads).
  */
 class GEOS_DLL DiscreteHausdorffDistance {
 public:
@@ -112,7 +119,8 @@ public:
         g0(p_g0),
         g1(p_g1),
         ptDist(),
-        densifyFrac(0.0)
+        densifyFrac(0.0),
+        numThreads(1)
     {}
 
     /**
@@ -134,6 +142,21 @@ public:
         densifyFrac = dFrac;
     }
 
+    /**
+     * Sets the number of threads used to compute the distance from the
+     * discrete points of a geometry to a large geometry.
+     * The distance is the same whatever the number of threads, but the
+     * coordinates returned may be another pair at the same distance.
+     * The default is 1.
+     *
+     * @param n the number of threads
+     */
+    void
+    setNumThreads(std::size_t n)
+    {
+        numThreads = n < 1 ? 1 : n;
+    }
+
     double
     distance()
     {
@@ -245,6 +268,10 @@ private:
                                  const geom::Geometry& geom,
                                  PointPairDistance& ptDist);
 
+    void computeOrientedDistanceIndexed(const geom::Geometry& discreteGeom,
+                                        const geom::Geometry& geom,
+                                        PointPairDistance& ptDist);
+
     const geom::Geometry& g0;
 
     const geom::Geometry& g1;
@@ -254,6 +281,8 @@ private:
     /// Value of 0.0 indicates that no densification should take place
     double densifyFrac; // = 0.0;
 
+    std::size_t numThreads; // = 1;
+
     // Declare type as noncopyable
     DiscreteHausdorffDistance(const DiscreteHausdorffDistance& other) = delete;
     DiscreteHausdorffDistance& operator=(const DiscreteHausdorffDistance& rhs) = delete;
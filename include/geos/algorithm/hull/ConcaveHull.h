@@ -0,0 +1,164 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2021 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_ALGORITHM_HULL_CONCAVEHULL_H
+#define GEOS_ALGORITHM_HULL_CONCAVEHULL_H
+
+#include <geos/export.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace geos {
+namespace geom {
+class Geometry;
+class GeometryFactory;
+}
+namespace triangulate {
+namespace quadedge {
+struct TriangleMesh;
+}
+}
+}
+
+namespace geos {
+namespace algorithm { // geos::algorithm
+namespace hull { // geos::algorithm::hull
+
+/**
+ * Computes a concave hull of the points of a geometry: a polygon
+ * enclosing all the points, which follows their outline more closely
+ * than the convex hull.
+ *
+ * The hull is computed by eroding the Delaunay triangulation of the
+ * points from its border. Border triangles are kept in a priority queue
+ * and removed, largest first, while they exceed the size criterion:
+ *
+ *  - with a maximum edge length, a triangle is removed if its longest
+ *    border edge is longer;
+ *  - with an alpha value, a triangle is removed if its circumradius is
+ *    larger, which gives the alpha shape of the points without holes.
+ *
+ * Only triangles with a single border edge, whose opposite vertex is
+ * not on the border, are removed. The result is then a single polygon
+ * without holes, having all the points on its border or inside it.
+ * Each triangle enters the queue at most 4 times, so the erosion takes
+ * O(n log n).
+ *
+ * If the points have fewer than 3 non-collinear points, the convex hull
+ * is returned.
+ */
+class GEOS_DLL ConcaveHull {
+
+public:
+
+    /**
+     * Creates a concave hull computation for the points of a geometry.
+     * By default, the hull is the convex hull.
+     *
+     * @param geom the input geometry
+     */
+    ConcaveHull(const geom::Geometry* geom);
+
+    /**
+     * Computes the concave hull of a geometry with a maximum edge length.
+     *
+     * @param geom the input geometry
+     * @param maxLength the length above which border edges are eroded
+     * @return the concave hull
+     */
+    static std::unique_ptr<geom::Geometry> concaveHullByLength(
+        const geom::Geometry* geom, double maxLength);
+
+    /**
+     * Computes the concave hull of a geometry with a maximum edge length
+     * given as a fraction of the range of the Delaunay edge lengths,
+     * 0 for the shortest and 1 for the longest.
+     *
+     * @param geom the input geometry
+     * @param lengthRatio the edge length ratio, between 0 and 1
+     * @return the concave hull
+     */
+    static std::unique_ptr<geom::Geometry> concaveHullByLengthRatio(
+        const geom::Geometry* geom, double lengthRatio);
+
+    /**
+     * Computes the alpha shape of a geometry, without holes.
+     *
+     * @param geom the input geometry
+     * @param alpha the radius of the eroding disc
+     * @return the alpha shape
+     */
+    static std::unique_ptr<geom::Geometry> alphaShape(
+        const geom::Geometry* geom, double alpha);
+
+    /**
+     * Sets the length above which border edges are eroded.
+     *
+     * @param length a non-negative length
+     *
+     * @throws util::IllegalArgumentException if the length is negative
+     */
+    void setMaximumEdgeLength(double length);
+
+    /**
+     * Sets the maximum edge length as a fraction of the range of
+     * the Delaunay edge lengths.
+     *
+     * @param ratio a ratio between 0 and 1
+     *
+     * @throws util::IllegalArgumentException if the ratio is not in [0, 1]
+     */
+    void setMaximumEdgeLengthRatio(double ratio);
+
+    /**
+     * Sets the circumradius above which border triangles are eroded.
+     *
+     * @param alpha a non-negative radius
+     *
+     * @throws util::IllegalArgumentException if alpha is negative
+     */
+    void setAlpha(double alpha);
+
+    /**
+     * Computes the hull.
+     *
+     * @return a Polygon, or the convex hull for degenerate input
+     */
+    std::unique_ptr<geom::Geometry> getHull();
+
+private:
+
+    enum class Criterion {
+        LENGTH,
+        LENGTH_RATIO,
+        ALPHA
+    };
+
+    const geom::Geometry* inputGeom;
+    const geom::GeometryFactory* geomFactory;
+    Criterion criterion;
+    double threshold;
+
+    std::unique_ptr<geom::Geometry> toPolygon(
+        const triangulate::quadedge::TriangleMesh& mesh,
+        const std::vector<bool>& isRemoved) const;
+};
+
+} // geos::algorithm::hull
+} // geos::algorithm
+} // geos
+
+#endif // GEOS_ALGORITHM_HULL_CONCAVEHULL_H
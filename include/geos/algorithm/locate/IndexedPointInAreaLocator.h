@@ -23,6 +23,7 @@
 #include <geos/index/intervalrtree/SortedPackedIntervalRTree.h> // inherited
 
 #include <memory>
+#include <mutex>
 #include <vector> // composition
 
 namespace geos {
@@ -50,6 +51,8 @@ namespace locate { // geos::algorithm::locate
  * Polygonal and [LinearRing](@ref geom::LinearRing) geometries are supported.
  *
  * The index is lazy-loaded, which allows creating instances even if they are not used.
+ * It is built once even when the first queries are concurrent, and is then only
+ * read, so a locator can be queried from several threads at once.
  *
  */
 class IndexedPointInAreaLocator : public PointOnGeometryLocator {
@@ -65,10 +68,26 @@ private:
         // To keep track of LineSegments
         std::vector< geom::LineSegment > segments;
 
+    public:
+        /// A segment with the extents used by the batch sweep
+        struct SweepSegment {
+            double minY;
+            double maxY;
+            double maxX;
+            const geom::LineSegment* seg;
+        };
+
+    private:
+        // Segments sorted by minimum Y, built on first use
+        std::vector<SweepSegment> sweepSegments;
+        std::once_flag sweepFlag;
+
     public:
         IntervalIndexedGeometry(const geom::Geometry& g);
 
         void query(double min, double max, index::ItemVisitor* visitor);
+
+        const std::vector<SweepSegment>& getSweepSegments();
     };
 
 
@@ -90,6 +109,7 @@ private:
 
     const geom::Geometry& areaGeom;
     std::unique_ptr<IntervalIndexedGeometry> index;
+    std::once_flag indexFlag;
 
     void buildIndex(const geom::Geometry& g);
 
@@ -120,6 +140,22 @@ public:
      */
     geom::Location locate(const geom::Coordinate* /*const*/ p) override;
 
+    /** \brief
+     * Determines the [Location](@ref geom::Location) of a batch of points
+     * in an areal [Geometry](@ref geom::Geometry).
+     *
+     * The points are sorted by Y and located in a single sweep over the
+     * segments of the geometry, so the segments crossing the scan line are
+     * only gathered once for all the points. The result is identical to
+     * calling locate(const geom::Coordinate*) on each point.
+     *
+     * @param xs the X ordinates of the points
+     * @param ys the Y ordinates of the points
+     * @param n the number of points
+     * @param out receives the location of each point, must hold n values
+     */
+    void locate(const double* xs, const double* ys, std::size_t n, geom::Location* out);
+
 };
 
 } // geos::algorithm::locate
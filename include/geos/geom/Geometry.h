@@ -801,7 +801,10 @@ public:
      * @param geom the Geometry to check the distance to
      * @param cDistance the distance value to compare
      * @return <code>true</code> if the geometries are less than
-     *  <code>distance</code> apart.
+     *  <code>distance</code> apart, <code>false</code> if either
+     *  is empty.
+     *
+     * @see operation::distance::DistanceOp::isWithinDistance
      *
      * @todo doesn't seem to need being virtual, make it concrete
      */
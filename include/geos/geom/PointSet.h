@@ -0,0 +1,173 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2021 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_GEOM_POINTSET_H
+#define GEOS_GEOM_POINTSET_H
+
+#include <geos/export.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/Envelope.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace geos {
+namespace geom { // geos::geom
+
+/** \brief
+ * A read-only view of points stored in arrays of ordinates owned by
+ * the caller.
+ *
+ * Point-set algorithms accept a PointSet in place of a MultiPoint, so
+ * large inputs are processed without allocating a Point per input point.
+ *
+ * The ordinates of point `i` are `x[i * stride]`, `y[i * stride]` and,
+ * if Z is present, `z[i * stride]`. Separate ordinate arrays have a
+ * stride of 1, while interleaved XY or XYZ arrays have a stride of 2 or 3.
+ * The arrays must outlive the view.
+ */
+class GEOS_DLL PointSet {
+
+public:
+
+    /// Creates an empty point set.
+    PointSet()
+        : xs(nullptr), ys(nullptr), zs(nullptr), numPoints(0), ordStride(1)
+    {}
+
+    /**
+     * Creates a view of points from ordinate arrays.
+     *
+     * @param x the X ordinate of the first point
+     * @param y the Y ordinate of the first point
+     * @param size the number of points
+     * @param stride the number of doubles between consecutive points
+     * @param z the Z ordinate of the first point, or nullptr
+     */
+    PointSet(const double* x, const double* y, std::size_t size,
+             std::size_t stride = 1, const double* z = nullptr)
+        : xs(x), ys(y), zs(z), numPoints(size), ordStride(stride)
+    {}
+
+    /// Creates a view of points from an array of interleaved XY ordinates.
+    static PointSet
+    fromXY(const double* xy, std::size_t size)
+    {
+        return PointSet(xy, xy + 1, size, 2);
+    }
+
+    /// Creates a view of points from an array of interleaved XYZ ordinates.
+    static PointSet
+    fromXYZ(const double* xyz, std::size_t size)
+    {
+        return PointSet(xyz, xyz + 1, size, 3, xyz + 2);
+    }
+
+    std::size_t
+    size() const
+    {
+        return numPoints;
+    }
+
+    bool
+    isEmpty() const
+    {
+        return numPoints == 0;
+    }
+
+    bool
+    hasZ() const
+    {
+        return zs != nullptr;
+    }
+
+    std::size_t
+    getStride() const
+    {
+        return ordStride;
+    }
+
+    /// The X ordinate of the first point, which the others follow by stride.
+    const double*
+    getXData() const
+    {
+        return xs;
+    }
+
+    /// The Y ordinate of the first point, which the others follow by stride.
+    const double*
+    getYData() const
+    {
+        return ys;
+    }
+
+    double
+    getX(std::size_t i) const
+    {
+        return xs[i * ordStride];
+    }
+
+    double
+    getY(std::size_t i) const
+    {
+        return ys[i * ordStride];
+    }
+
+    /// The Z ordinate of a point, or NaN if the points have no Z.
+    double
+    getZ(std::size_t i) const
+    {
+        return zs ? zs[i * ordStride] : DoubleNotANumber;
+    }
+
+    Coordinate
+    getCoordinate(std::size_t i) const
+    {
+        return Coordinate(getX(i), getY(i), getZ(i));
+    }
+
+    /// The envelope of the points.
+    Envelope
+    getEnvelope() const
+    {
+        Envelope env;
+        for(std::size_t i = 0; i < numPoints; i++) {
+            env.expandToInclude(getX(i), getY(i));
+        }
+        return env;
+    }
+
+    /// Appends the coordinates of the points to a vector.
+    void
+    toVector(std::vector<Coordinate>& coords) const
+    {
+        coords.reserve(coords.size() + numPoints);
+        for(std::size_t i = 0; i < numPoints; i++) {
+            coords.push_back(getCoordinate(i));
+        }
+    }
+
+private:
+
+    const double* xs;
+    const double* ys;
+    const double* zs;
+    std::size_t numPoints;
+    std::size_t ordStride;
+};
+
+} // namespace geos::geom
+} // namespace geos
+
+#endif // GEOS_GEOM_POINTSET_H
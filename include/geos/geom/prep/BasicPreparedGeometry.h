@@ -26,13 +26,30 @@
 #include <geos/geom/Coordinate.h>
 //#include <geos/geom/Location.h>
 
+#include <memory>
+#include <mutex>
 #include <vector>
 #include <string>
 
 namespace geos {
+namespace algorithm {
+namespace locate {
+class PointOnGeometryLocator;
+}
+}
 namespace geom {
 class Geometry;
 class Coordinate;
+class IntersectionMatrix;
+class PointSet;
+}
+namespace geomgraph {
+class GeometryGraph;
+}
+namespace operation {
+namespace distance {
+class IndexedFacetDistance;
+}
 }
 }
 
@@ -61,6 +78,30 @@ private:
     const geom::Geometry* baseGeom;
     Coordinate::ConstVect representativePts;
 
+    mutable std::unique_ptr<geomgraph::GeometryGraph> nodedGraph;
+    mutable std::once_flag nodedGraphFlag;
+
+    mutable std::unique_ptr<operation::distance::IndexedFacetDistance> indexedDistance;
+    mutable std::once_flag indexedDistanceFlag;
+
+    /**
+     * Gets the graph of the base geometry with its self-nodes computed,
+     * which relate copies instead of noding the geometry again.
+     */
+    const geomgraph::GeometryGraph& getNodedGraph() const;
+
+    /**
+     * Computes the DE-9IM matrix of the base geometry and a geometry
+     * which does not intersect it.
+     */
+    std::unique_ptr<geom::IntersectionMatrix> disjointIM(const geom::Geometry* g) const;
+
+    /**
+     * Tests whether a DE-9IM pattern can be matched by geometries of
+     * the dimensions of the base geometry and a given geometry.
+     */
+    bool isPatternPossible(const geom::Geometry* g, const std::string& pattern) const;
+
 protected:
     /**
      * Sets the original {@link Geometry} which will be prepared.
@@ -86,10 +127,21 @@ protected:
      */
     bool envelopeCovers(const geom::Geometry* g) const;
 
+    /**
+     * Gets an indexed locator of points in the base geometry, which relate
+     * and distance use in place of a PointLocator, or nullptr if there
+     * is none.
+     */
+    virtual algorithm::locate::PointOnGeometryLocator*
+    getPointLocator() const
+    {
+        return nullptr;
+    }
+
 public:
     BasicPreparedGeometry(const Geometry* geom);
 
-    ~BasicPreparedGeometry() override = default;
+    ~BasicPreparedGeometry() override;
 
     const geom::Geometry&
     getGeometry() const override
@@ -120,6 +172,12 @@ public:
      */
     bool isAnyTargetComponentInTest(const geom::Geometry* testGeom) const;
 
+    /**
+     * Gets the index of the facets of the base geometry, which is
+     * built on first use and shared by all the distance queries.
+     */
+    operation::distance::IndexedFacetDistance* getIndexedFacetDistance() const;
+
     /**
      * Default implementation.
      */
@@ -171,6 +229,16 @@ public:
      */
     bool within(const geom::Geometry* g) const override;
 
+    /**
+     * Standard implementation for all geometries.
+     */
+    std::unique_ptr<geom::IntersectionMatrix> relate(const geom::Geometry* g) const override;
+
+    /**
+     * Standard implementation for all geometries.
+     */
+    bool relate(const geom::Geometry* g, const std::string& pattern) const override;
+
     /**
      * Default implementation.
      */
@@ -181,6 +249,17 @@ public:
      */
     double distance(const geom::Geometry* g) const override;
 
+    /**
+     * Default implementation.
+     */
+    bool isWithinDistance(const geom::Geometry* g, double dist) const override;
+
+    /**
+     * Standard implementation for all geometries.
+     */
+    void distance(const geom::PointSet& pts, double* distances,
+                  std::size_t numThreads = 1) const override;
+
     std::string toString();
 
 };
@@ -19,8 +19,10 @@
 #ifndef GEOS_GEOM_PREP_PREPAREDGEOMETRY_H
 #define GEOS_GEOM_PREP_PREPAREDGEOMETRY_H
 
+#include <cstddef>
 #include <vector>
 #include <memory>
+#include <string>
 #include <geos/export.h>
 
 // Forward declarations
@@ -29,6 +31,8 @@ namespace geos {
         class Geometry;
         class Coordinate;
         class CoordinateSequence;
+        class IntersectionMatrix;
+        class PointSet;
     }
 }
 
@@ -53,6 +57,11 @@ namespace prep { // geos::geom::prep
  * See the implementing classes for documentation about which methods and situations
  * they optimize.
  *
+ * The const methods of a PreparedGeometry may be called from several
+ * threads at once. Indexes are built on first use, exactly once even when
+ * the first calls are concurrent, and are only read afterwards.
+ * The prepared Geometry must not be modified or destroyed meanwhile.
+ *
  */
 class GEOS_DLL PreparedGeometry {
 public:
@@ -197,6 +206,37 @@ public:
      */
     virtual bool within(const geom::Geometry* geom) const = 0;
 
+    /** \brief
+     * Computes the DE-9IM matrix for the spatial relationship between
+     * the base {@link Geometry} and a given geometry.
+     *
+     * The self-intersection nodes of the base geometry are computed once
+     * and reused, and disjoint geometries are detected with the prepared
+     * intersects test without building any graph.
+     *
+     * @param geom the Geometry to relate
+     * @return the DE-9IM matrix of this Geometry and the given Geometry
+     *
+     * @see Geometry#relate(const Geometry*)
+     */
+    virtual std::unique_ptr<geom::IntersectionMatrix> relate(const geom::Geometry* geom) const = 0;
+
+    /** \brief
+     * Tests whether the DE-9IM matrix of the base {@link Geometry} and a
+     * given geometry matches a pattern.
+     *
+     * Patterns of the named predicates which have prepared
+     * implementations use them, and patterns which the dimensions
+     * of the geometries cannot match are rejected without computation.
+     *
+     * @param geom the Geometry to relate
+     * @param pattern a DE-9IM pattern of 9 characters
+     * @return true if the DE-9IM matrix matches the pattern
+     *
+     * @see Geometry#relate(const Geometry*, const std::string&)
+     */
+    virtual bool relate(const geom::Geometry* geom, const std::string& pattern) const = 0;
+
     /** \brief
      * Compute the nearest locations on the base {@link Geometry} and
      * the given geometry.
@@ -216,6 +256,39 @@ public:
      *
      */
     virtual double distance(const geom::Geometry* geom) const = 0;
+
+    /** \brief
+     * Tests whether the base {@link Geometry} is within a given distance
+     * of the given geometry.
+     *
+     * The search stops as soon as locations within the distance are
+     * found, rather than computing the minimum distance.
+     *
+     * @param geom the Geometry to test the distance to
+     * @param dist the distance value to compare
+     * @return true if the geometries are within the distance,
+     *         false if either geometry is empty
+     *
+     */
+    virtual bool isWithinDistance(const geom::Geometry* geom, double dist) const = 0;
+
+    /** \brief
+     * Compute the minimum distance between the base {@link Geometry} and
+     * each point of a PointSet.
+     *
+     * The facets of the base geometry are indexed once for all the
+     * points, and the points are queried without building a Geometry.
+     * The distances are those computed by distance(const geom::Geometry*)
+     * for each point, up to rounding.
+     *
+     * @param pts the points to compute the distance to
+     * @param distances receives the distance of each point, which is
+     *                  infinity if the base geometry is empty.
+     *                  Must hold pts.size() values.
+     * @param numThreads the number of threads; 0 or 1 runs sequentially
+     */
+    virtual void distance(const geom::PointSet& pts, double* distances,
+                          std::size_t numThreads = 1) const = 0;
 };
 
 
@@ -48,6 +48,10 @@ namespace prep { // geos::geom::prep
  * In the future, the factory may accept hints that indicate
  * special optimizations which can be performed.
  *
+ * The prepared geometries it creates can be shared between threads,
+ * so one prepared geometry can serve concurrent queries instead of
+ * preparing the same geometry in each thread.
+ *
  * @author Martin Davis
  *
  */
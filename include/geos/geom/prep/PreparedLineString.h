@@ -27,6 +27,7 @@
 #include <geos/operation/distance/IndexedFacetDistance.h>
 
 #include <memory>
+#include <mutex>
 
 namespace geos {
 namespace geom { // geos::geom
@@ -43,7 +44,9 @@ class PreparedLineString : public BasicPreparedGeometry {
 private:
     std::unique_ptr<noding::FastSegmentSetIntersectionFinder> segIntFinder;
     mutable noding::SegmentString::ConstVect segStrings;
-    mutable std::unique_ptr<operation::distance::IndexedFacetDistance> indexedDistance;
+
+    // the indexes are built on first use, once even for concurrent calls
+    std::once_flag segIntFinderFlag;
 
 protected:
 public:
@@ -60,7 +63,7 @@ public:
     bool intersects(const geom::Geometry* g) const override;
     std::unique_ptr<geom::CoordinateSequence> nearestPoints(const geom::Geometry* g) const override;
     double distance(const geom::Geometry* g) const override;
-    operation::distance::IndexedFacetDistance* getIndexedFacetDistance() const;
+    bool isWithinDistance(const geom::Geometry* g, double dist) const override;
 
 };
 
@@ -35,12 +35,20 @@ public:
         return op.distance(geom);
     }
 
+    static bool isWithinDistance(const PreparedLineString& prep, const geom::Geometry* geom, double dist)
+    {
+        PreparedLineStringDistance op(prep);
+        return op.isWithinDistance(geom, dist);
+    }
+
     PreparedLineStringDistance(const PreparedLineString& prep)
         : prepLine(prep)
     { }
 
     double distance(const geom::Geometry* g) const;
 
+    bool isWithinDistance(const geom::Geometry* g, double dist) const;
+
 protected:
 
     const PreparedLineString& prepLine;
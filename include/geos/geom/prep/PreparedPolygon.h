@@ -26,6 +26,7 @@
 #include <geos/operation/distance/IndexedFacetDistance.h>
 
 #include <memory>
+#include <mutex>
 
 namespace geos {
 namespace noding {
@@ -55,22 +56,24 @@ private:
     mutable std::unique_ptr<noding::FastSegmentSetIntersectionFinder> segIntFinder;
     mutable std::unique_ptr<algorithm::locate::PointOnGeometryLocator> ptOnGeomLoc;
     mutable noding::SegmentString::ConstVect segStrings;
-    mutable std::unique_ptr<operation::distance::IndexedFacetDistance> indexedDistance;
 
-protected:
+    // the indexes are built on first use, once even for concurrent calls
+    mutable std::once_flag segIntFinderFlag;
+    mutable std::once_flag ptOnGeomLocFlag;
+
 public:
     PreparedPolygon(const geom::Geometry* geom);
     ~PreparedPolygon() override;
 
     noding::FastSegmentSetIntersectionFinder* getIntersectionFinder() const;
-    algorithm::locate::PointOnGeometryLocator* getPointLocator() const;
-    operation::distance::IndexedFacetDistance* getIndexedFacetDistance() const;
+    algorithm::locate::PointOnGeometryLocator* getPointLocator() const override;
 
     bool contains(const geom::Geometry* g) const override;
     bool containsProperly(const geom::Geometry* g) const override;
     bool covers(const geom::Geometry* g) const override;
     bool intersects(const geom::Geometry* g) const override;
     double distance(const geom::Geometry* g) const override;
+    bool isWithinDistance(const geom::Geometry* g, double dist) const override;
 
 };
 
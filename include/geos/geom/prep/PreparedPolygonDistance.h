@@ -45,12 +45,20 @@ public:
         return op.distance(geom);
     }
 
+    static bool isWithinDistance(const PreparedPolygon& prep, const geom::Geometry* geom, double dist)
+    {
+        PreparedPolygonDistance op(prep);
+        return op.isWithinDistance(geom, dist);
+    }
+
     PreparedPolygonDistance(const PreparedPolygon& prep)
         : prepPoly(prep)
     { }
 
     double distance(const geom::Geometry* g) const;
 
+    bool isWithinDistance(const geom::Geometry* g, double dist) const;
+
 protected:
 
     const PreparedPolygon& prepPoly;
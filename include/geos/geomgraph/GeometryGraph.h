@@ -110,10 +110,15 @@ private:
 
     bool hasTooFewPointsVar;
 
+    bool hasSelfNodesVar;
+
     geom::Coordinate invalidPoint;
 
     /// Allocates a new EdgeSetIntersector. Remember to delete it!
-    index::EdgeSetIntersector* createEdgeSetIntersector();
+    /// If env is not null, only the intersections within it are
+    /// required.
+    index::EdgeSetIntersector* createEdgeSetIntersector(
+        const geom::Envelope* env = nullptr);
 
     void add(const geom::Geometry* g);
     // throw(UnsupportedOperationException);
@@ -204,7 +209,9 @@ public:
      * @param li the LineIntersector to use
      * @param computeRingSelfNodes if `false`, intersection checks are optimized
      *                             to not test rings for self-intersection
-     * @param env an Envelope
+     * @param env an Envelope restricting the nodes to compute, or nullptr.
+     *            The monotone chains of the edges outside it are not
+     *            tested, so nodes outside it may be missing.
      *
      * @return the SegmentIntersector used, containing information about
      *         the intersections found
@@ -238,10 +245,38 @@ public:
         algorithm::LineIntersector& li,
         bool computeRingSelfNodes, bool isDoneIfProperInt, const geom::Envelope* env = nullptr);
 
+    /** \brief
+     * Adds the self-intersection nodes found by computeSelfNodes on
+     * another graph of the same geometry, instead of computing them.
+     *
+     * This saves noding a geometry again each time it is related
+     * to another one.
+     *
+     * @param noded a graph of the same geometry with the same argument
+     *              index, with self-nodes computed
+     */
+    void addSelfNodes(const GeometryGraph& noded);
+
+    /// Tests whether the self-intersection nodes have been computed or added
+    bool
+    hasSelfNodes() const
+    {
+        return hasSelfNodesVar;
+    }
+
     std::unique_ptr<index::SegmentIntersector> computeEdgeIntersections(GeometryGraph* g,
             algorithm::LineIntersector* li, bool includeProper,
             const geom::Envelope* env = nullptr);
 
+    /**
+     * Computes the intersections of the edges of this graph and another,
+     * stopping at the first proper intersection if isDoneIfProperInt
+     * is true.
+     */
+    std::unique_ptr<index::SegmentIntersector> computeEdgeIntersections(GeometryGraph* g,
+            algorithm::LineIntersector* li, bool includeProper,
+            bool isDoneIfProperInt, const geom::Envelope* env = nullptr);
+
     std::vector<Edge*>* getEdges();
 
     bool hasTooFewPoints();
@@ -53,6 +53,9 @@ public:
     double getMinX(std::size_t chainIndex);
     double getMaxX(std::size_t chainIndex);
 
+    /// Tests whether the envelope of a chain intersects an envelope
+    bool intersects(std::size_t chainIndex, const geom::Envelope& env) const;
+
     void computeIntersects(const MonotoneChainEdge& mce,
                            SegmentIntersector& si);
 
@@ -32,6 +32,9 @@
 
 // Forward declarations
 namespace geos {
+namespace geom {
+class Envelope;
+}
 namespace geomgraph {
 class Edge;
 }
@@ -54,7 +57,27 @@ class GEOS_DLL SimpleMCSweepLineIntersector: public EdgeSetIntersector {
 
 public:
 
-    SimpleMCSweepLineIntersector() = default;
+    SimpleMCSweepLineIntersector()
+        : nOverlaps(0)
+        , env(nullptr)
+    {}
+
+    /**
+     * Creates an intersector which only finds the intersections
+     * within an envelope.
+     *
+     * Only the monotone chains whose envelope intersects it
+     * are swept, so the cost depends on the part of the edges
+     * within the envelope rather than on the whole edges.
+     * Intersections outside the envelope may or may not be found.
+     *
+     * @param newEnv the envelope, which must outlive the intersector,
+     *               or nullptr to find all the intersections
+     */
+    explicit SimpleMCSweepLineIntersector(const geom::Envelope* newEnv)
+        : nOverlaps(0)
+        , env(newEnv)
+    {}
 
     ~SimpleMCSweepLineIntersector() override = default;
 
@@ -81,6 +104,8 @@ protected:
     int nOverlaps;
 
 private:
+    const geom::Envelope* env;
+
     void add(std::vector<Edge*>* edges);
 
     void add(std::vector<Edge*>* edges, void* edgeSet);
@@ -103,6 +103,17 @@ public:
      */
     void query(double min, double max, index::ItemVisitor* visitor);
 
+    /**
+     * Builds the tree, which is otherwise built on the first query.
+     * A built tree is not modified by queries, so it can be queried
+     * from several threads at once.
+     */
+    void
+    build()
+    {
+        init();
+    }
+
 };
 
 } // geos::intervalrtree
@@ -81,8 +81,6 @@ private:
     SimpleSTRnode* createNode(int newLevel);
 
 
-    void build();
-
     static void sortNodesY(std::vector<SimpleSTRnode*>& nodeList);
     static void sortNodesX(std::vector<SimpleSTRnode*>& nodeList);
 
@@ -140,6 +138,13 @@ public:
         return built;
     }
 
+    /**
+     * Builds the tree, which is otherwise built on the first query.
+     * A built tree is not modified by queries, so it can be queried
+     * from several threads at once.
+     */
+    void build();
+
     SimpleSTRnode* getRoot() {
         build();
         return root;
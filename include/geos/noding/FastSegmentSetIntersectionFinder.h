@@ -46,12 +46,14 @@ namespace noding { // geos::noding
  * against a target set of lines.
  * Short-circuited to return as soon an intersection is found.
  *
+ * The index is built on construction and only read by the tests,
+ * so a finder can be used from several threads at once.
+ *
  * @version 1.7
  */
 class FastSegmentSetIntersectionFinder {
 private:
     std::unique_ptr<MCIndexSegmentSetMutualIntersector> segSetMutInt;
-    std::unique_ptr<geos::algorithm::LineIntersector> lineIntersector;
 
 protected:
 public:
@@ -71,8 +73,8 @@ public:
         return segSetMutInt.get();
     }
 
-    bool intersects(SegmentString::ConstVect* segStrings);
-    bool intersects(SegmentString::ConstVect* segStrings, SegmentIntersectionDetector* intDetector);
+    bool intersects(SegmentString::ConstVect* segStrings) const;
+    bool intersects(SegmentString::ConstVect* segStrings, SegmentIntersectionDetector* intDetector) const;
 
 };
 
@@ -79,6 +79,27 @@ public:
     // NOTE: re-populates the MonotoneChain vector with newly created chains
     void process(SegmentString::ConstVect* segStrings) override;
 
+    /**
+     * Builds the index of the base segments, which is otherwise built
+     * by the first call to process.
+     */
+    void buildIndex();
+
+    /**
+     * Computes the intersections of segment strings with the base
+     * segments, reporting them to the given segment intersector.
+     *
+     * Unlike process(SegmentString::ConstVect*), this leaves the
+     * intersector unchanged, so once the index is built it can be
+     * called from several threads at once.
+     *
+     * @param segStrings the segment strings to intersect
+     * @param segInt the segment intersector to report intersections to
+     *
+     * @throws util::IllegalStateException if the index is not built
+     */
+    void process(SegmentString::ConstVect* segStrings, SegmentIntersector* segInt) const;
+
     class SegmentOverlapAction : public index::chain::MonotoneChainOverlapAction {
     private:
         SegmentIntersector& si;
@@ -113,7 +134,7 @@ private:
      * envelope (range) queries efficiently (such as a index::quadtree::Quadtree
      * or index::strtree::STRtree).
      */
-    std::unique_ptr<index::SpatialIndex> index;
+    std::unique_ptr<index::strtree::SimpleSTRtree> index;
     int indexCounter;
     int processCounter;
     // statistics
@@ -129,6 +150,8 @@ private:
 
     void intersectChains();
 
+    int intersectChains(MonoChains& chains, SegmentIntersector& si) const;
+
     void addToMonoChains(SegmentString* segStr);
 
 };
@@ -0,0 +1,167 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2021 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_OPERATION_DISTANCE_DISTANCEMATRIX_H
+#define GEOS_OPERATION_DISTANCE_DISTANCEMATRIX_H
+
+#include <geos/export.h>
+#include <geos/index/strtree/STRtree.h> // for composition
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251) // warning C4251: needs to have dll-interface to be used by clients of class
+#endif
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class Geometry;
+namespace prep {
+class PreparedGeometry;
+}
+}
+}
+
+namespace geos {
+namespace operation { // geos::operation
+namespace distance { // geos::operation::distance
+
+/** \brief
+ * Computes the distances between the geometries of two sets which lie
+ * within a maximum distance of each other.
+ *
+ * The geometries of the second set are indexed by envelope in an STRtree,
+ * which is queried with the envelope of each geometry of the first set
+ * expanded by the maximum distance. Each candidate of the second set is
+ * measured through a PreparedGeometry, prepared on first use and reused
+ * for all the geometries of the first set, which caches an STRtree of
+ * the FacetSequences of the candidate.
+ *
+ * The rows of the matrix, one per geometry of the first set, can be
+ * computed by several threads.
+ * The distances are those of geom::Geometry::distance, up to rounding,
+ * except that an empty geometry is at an infinite distance from any other.
+ */
+class GEOS_DLL DistanceMatrix {
+public:
+
+    /// A pair of geometries within the maximum distance
+    struct Entry {
+        /// index of the geometry in the first set
+        std::size_t index1;
+        /// index of the geometry in the second set
+        std::size_t index2;
+        double distance;
+    };
+
+    /**
+     * Creates a matrix of the distances between two sets of geometries.
+     * The geometries must outlive the matrix.
+     *
+     * @param geoms1 the geometries of the rows
+     * @param geoms2 the geometries of the columns, which are indexed
+     */
+    DistanceMatrix(const std::vector<const geom::Geometry*>& geoms1,
+                   const std::vector<const geom::Geometry*>& geoms2);
+
+    ~DistanceMatrix();
+
+    /**
+     * Sets the maximum distance of the pairs computed.
+     * The default is infinity, which computes all the pairs.
+     *
+     * @param d the maximum distance
+     */
+    void
+    setMaxDistance(double d)
+    {
+        maxDistance = d;
+    }
+
+    /**
+     * Sets the number of threads used to compute the rows.
+     * The result is the same whatever the number of threads.
+     * The default is 1.
+     *
+     * @param n the number of threads
+     */
+    void
+    setNumThreads(std::size_t n)
+    {
+        numThreads = n < 1 ? 1 : n;
+    }
+
+    /**
+     * Computes the pairs of geometries within the maximum distance.
+     *
+     * @return the pairs, ordered by index in the first set and then
+     *         by index in the second set
+     */
+    std::vector<Entry> getSparse();
+
+    /**
+     * Computes the distances of all the pairs of geometries.
+     *
+     * @param distances receives the distance from geometry i of the
+     *                  first set to geometry j of the second set at
+     *                  index i * n2 + j, where n2 is the size of the
+     *                  second set, or infinity for the pairs farther
+     *                  than the maximum distance.
+     *                  Must hold n1 * n2 values.
+     */
+    void getDense(double* distances);
+
+private:
+
+    std::vector<const geom::Geometry*> geoms1;
+
+    std::vector<const geom::Geometry*> geoms2;
+
+    double maxDistance;
+
+    std::size_t numThreads;
+
+    index::strtree::STRtree index2;
+
+    // the geometries of the second set are prepared on first use,
+    // once even for concurrent rows
+    std::vector<std::unique_ptr<geom::prep::PreparedGeometry>> prepGeoms2;
+
+    std::unique_ptr<std::once_flag[]> prepFlags2;
+
+    const geom::prep::PreparedGeometry* getPrepared2(std::size_t j);
+
+    /// Appends the pairs of the row of geometry i of the first set
+    void computeRow(std::size_t i, std::vector<void*>& candidates,
+                    std::vector<Entry>& entries);
+
+    // Declare type as noncopyable
+    DistanceMatrix(const DistanceMatrix& other) = delete;
+    DistanceMatrix& operator=(const DistanceMatrix& rhs) = delete;
+};
+
+} // namespace geos::operation::distance
+} // namespace geos::operation
+} // namespace geos
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#endif // GEOS_OPERATION_DISTANCE_DISTANCEMATRIX_H
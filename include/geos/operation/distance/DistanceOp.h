@@ -67,8 +67,10 @@ namespace distance { // geos::operation::distance
  * Empty geometry collection components are ignored.
  *
  * The algorithms used are straightforward O(n^2)
- * comparisons.  This worst-case performance could be improved on
- * by using Voronoi techniques or spatial indexes.
+ * comparisons, except that large sets of points, and of points
+ * against lines, are compared through spatial indexes.
+ * This worst-case performance could be improved on further
+ * by using Voronoi techniques.
  *
  */
 class GEOS_DLL DistanceOp {
@@ -95,10 +97,14 @@ public:
      * Test whether two geometries lie within a given distance of
      * each other.
      *
+     * The search stops at the first locations found within the
+     * distance, rather than computing the minimum distance.
+     *
      * @param g0 a {@link geom::Geometry}
      * @param g1 another {@link geom::Geometry}
      * @param distance the distance to test
-     * @return true if g0.distance(g1) <= distance
+     * @return true if g0.distance(g1) <= distance,
+     *         false if either geometry is empty
      */
     static bool isWithinDistance(const geom::Geometry& g0,
                                  const geom::Geometry& g1,
@@ -209,6 +215,26 @@ private:
         const std::vector<const geom::Point*>& points1,
         std::array<std::unique_ptr<GeometryLocation>, 2> & locGeom);
 
+    /**
+     * Computes the same locations as computeMinDistancePoints,
+     * comparing only the points found near each other by an STRtree
+     * of the second set.
+     */
+    void computeMinDistancePointsIndexed(
+        const std::vector<const geom::Point*>& points0,
+        const std::vector<const geom::Point*>& points1,
+        std::array<std::unique_ptr<GeometryLocation>, 2> & locGeom);
+
+    /**
+     * Computes the same locations as computeMinDistanceLinesPoints,
+     * comparing only the segments and points found near each other
+     * by an STRtree of the points.
+     */
+    void computeMinDistanceLinesPointsIndexed(
+        const std::vector<const geom::LineString*>& lines,
+        const std::vector<const geom::Point*>& points,
+        std::array<std::unique_ptr<GeometryLocation>, 2> & locGeom);
+
     void computeMinDistance(const geom::LineString* line0,
                             const geom::LineString* line1,
                             std::array<std::unique_ptr<GeometryLocation>, 2> & locGeom);
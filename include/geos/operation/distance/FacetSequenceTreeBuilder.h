@@ -41,6 +41,7 @@ private:
                                   std::vector<FacetSequence> & sections);
     static std::vector<FacetSequence> computeFacetSequences(const geom::Geometry* g);
 
+public:
     class FacetSequenceTree : public geos::index::strtree::STRtree {
     public:
         FacetSequenceTree(std::vector<FacetSequence> &&seq) : STRtree(STR_TREE_NODE_CAPACITY), sequences(seq) {
@@ -49,18 +50,47 @@ private:
             }
         }
 
+        /** \brief
+         * Computes the distance from a point facet to the nearest
+         * facet of the tree, or infinity if the tree is empty.
+         *
+         * The nodes are searched depth first, nearest first, so unlike
+         * nearestNeighbour nothing is allocated for the nodes visited.
+         * The tree must be built. Several threads may search it at once.
+         *
+         * @param pointFacet the facet of the point
+         * @param stopDistance the search stops as soon as a facet within
+         *                     this distance is found, whose distance
+         *                     is returned
+         */
+        double nearestFacetDistance(const FacetSequence& pointFacet,
+                                    double stopDistance = 0.0);
+
+        /** \brief
+         * Finds the nearest facet to a point facet, searching the tree
+         * as nearestFacetDistance does.
+         *
+         * @param pointFacet the facet of the point
+         * @param stopDistance the search stops as soon as a facet within
+         *                     this distance is found, which is returned
+         * @param minDist receives the distance to the returned facet,
+         *                or infinity if the tree is empty
+         * @return the nearest facet, or nullptr if the tree is empty
+         */
+        const FacetSequence* nearestFacet(const FacetSequence& pointFacet,
+                                          double stopDistance, double& minDist);
+
     private:
         std::vector<FacetSequence> sequences;
     };
 
-public:
     /** \brief
      * Return a tree of FacetSequences constructed from the supplied Geometry.
      *
      * The FacetSequences are owned by the tree and are automatically deleted by
      * the tree on destruction.
      */
-    static std::unique_ptr<geos::index::strtree::STRtree> build(const geom::Geometry* g);
+    static std::unique_ptr<FacetSequenceTree> build(const geom::Geometry* g);
 };
 }
 }
@@ -59,6 +59,7 @@ public:
     ///
     /// \param g a Geometry, which may be of any type.
     IndexedFacetDistance(const geom::Geometry* g) :
+        baseGeometry(g),
         cachedTree(FacetSequenceTreeBuilder::build(g))
     {}
 
@@ -86,6 +87,33 @@ public:
     /// \return the computed distance
     double distance(const geom::Geometry* g) const;
 
+    /// \brief Computes the distance from the base geometry to a point.
+    ///
+    /// This avoids building an index of the facets of a point geometry,
+    /// so it suits computing the distance of many points to the base
+    /// geometry. It may be called by several threads at once.
+    ///
+    /// \param p the point to compute the distance to
+    ///
+    /// \return the computed distance, or infinity if the base geometry
+    ///         is empty
+    double distance(const geom::Coordinate& p) const;
+
+    /// \brief Tests whether the base geometry lies within a given distance
+    /// of the given geometry.
+    ///
+    /// The search stops as soon as a pair of facets within the distance
+    /// is found, so it is cheaper than computing the distance.
+    /// As for distance, only the facets are considered, so a geometry
+    /// inside a polygon is only within the distance of its boundary.
+    ///
+    /// \param g the geometry to test
+    /// \param maxDistance the distance to test
+    ///
+    /// \return true if the facets are within the distance,
+    ///         false if either geometry is empty
+    bool isWithinDistance(const geom::Geometry* g, double maxDistance) const;
+
     /// \brief Computes the nearest locations on the base geometry and the given geometry.
     ///
     /// \param g the geometry to compute the nearest location to
@@ -99,7 +127,8 @@ public:
     std::vector<geom::Coordinate> nearestPoints(const geom::Geometry* g) const;
 
 private:
-    std::unique_ptr<geos::index::strtree::STRtree> cachedTree;
+    const geom::Geometry* baseGeometry;
+    std::unique_ptr<FacetSequenceTreeBuilder::FacetSequenceTree> cachedTree;
 
 };
 }
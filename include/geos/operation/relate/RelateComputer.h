@@ -31,6 +31,7 @@
 
 #include <vector>
 #include <memory>
+#include <string>
 
 #ifdef _MSC_VER
 #pragma warning(push)
@@ -39,6 +40,11 @@
 
 // Forward declarations
 namespace geos {
+namespace algorithm {
+namespace locate {
+class PointOnGeometryLocator;
+}
+}
 namespace geom {
 class Geometry;
 }
@@ -77,13 +83,42 @@ public:
     RelateComputer(std::vector<geomgraph::GeometryGraph*>* newArg);
     ~RelateComputer() = default;
 
+    /** \brief
+     * Sets a locator for points in an argument geometry, to use
+     * instead of a PointLocator when labelling isolated components.
+     *
+     * The locator must give the same locations as a PointLocator,
+     * as an IndexedPointInAreaLocator does for polygonal geometry.
+     *
+     * @param argIndex the index of the geometry
+     * @param locator the locator, or nullptr for a PointLocator.
+     *                Ownership left to caller.
+     */
+    void setLocator(int argIndex, algorithm::locate::PointOnGeometryLocator* locator);
+
     std::unique_ptr<geom::IntersectionMatrix> computeIM();
+
+    /** \brief
+     * Tests whether the IntersectionMatrix matches a pattern.
+     *
+     * The matrix only grows as it is computed, and its entries are
+     * bounded by the dimensions of the geometries. The computation
+     * stops as soon as these bounds decide the pattern, in particular at
+     * the first proper intersection of the edges when that decides it.
+     *
+     * @param pattern a DE-9IM pattern of 9 characters
+     * @return true if the IntersectionMatrix matches the pattern
+     */
+    bool matches(const std::string& pattern);
+
 private:
 
     algorithm::LineIntersector li;
 
     algorithm::PointLocator ptLocator;
 
+    algorithm::locate::PointOnGeometryLocator* locators[2];
+
     /// the arg(s) of the operation
     std::vector<geomgraph::GeometryGraph*>* arg;
 
@@ -97,12 +132,27 @@ private:
     /// the intersection point found (if any)
     geom::Coordinate invalidPoint;
 
+    /// the pattern to match, or nullptr to compute the whole matrix
+    const std::string* requiredPattern;
+
+    /**
+     * Tests whether the final IntersectionMatrix is sure to match, or
+     * sure not to match, the required pattern, given a lower bound of it.
+     */
+    bool isDecided(const geom::IntersectionMatrix& imX) const;
+
     void insertEdgeEnds(std::vector<geomgraph::EdgeEnd*>* ee);
 
     void computeProperIntersectionIM(
         geomgraph::index::SegmentIntersector* intersector,
         geom::IntersectionMatrix* imX);
 
+    /**
+     * Tests whether a proper intersection of the edges, if one is found,
+     * decides the required pattern.
+     */
+    bool isDecidedByProperIntersection() const;
+
     void copyNodesAndLabels(int argIndex);
     void computeIntersectionNodes(int argIndex);
     void labelIntersectionNodes(int argIndex);
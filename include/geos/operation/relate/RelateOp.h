@@ -25,6 +25,8 @@
 #include <geos/operation/GeometryGraphOperation.h> // for inheritance
 #include <geos/operation/relate/RelateComputer.h> // for composition
 
+#include <string>
+
 // Forward declarations
 namespace geos {
 namespace algorithm {
@@ -90,6 +92,24 @@ public:
         const geom::Geometry* b,
         const algorithm::BoundaryNodeRule& boundaryNodeRule);
 
+    /** \brief
+     * Tests whether the geom::IntersectionMatrix for the spatial
+     * relationship between two geom::Geometry objects matches a pattern,
+     * using the default (OGC SFS) Boundary Node Rule.
+     *
+     * The computation stops as soon as the pattern is decided.
+     *
+     * @param a a Geometry to test. Ownership left to caller.
+     * @param b a Geometry to test. Ownership left to caller.
+     * @param pattern a DE-9IM pattern of 9 characters
+     *
+     * @return true if the IntersectionMatrix matches the pattern
+     */
+    static bool relate(
+        const geom::Geometry* a,
+        const geom::Geometry* b,
+        const std::string& pattern);
+
     /** \brief
      * Creates a new Relate operation, using the default (OGC SFS)
      * Boundary Node Rule.
@@ -124,6 +144,16 @@ public:
      */
     std::unique_ptr<geom::IntersectionMatrix> getIntersectionMatrix();
 
+    /** \brief
+     * Tests whether the IntersectionMatrix for the spatial relationship
+     * between the input geometries matches a pattern, computing it only
+     * until the pattern is decided.
+     *
+     * @param pattern a DE-9IM pattern of 9 characters
+     * @return true if the IntersectionMatrix matches the pattern
+     */
+    bool matches(const std::string& pattern);
+
 private:
 
     RelateComputer relateComp;
@@ -61,6 +61,19 @@ public:
         const CoordsVect& nPts,
         double distanceTolerance);
 
+    /** \brief
+     * Computes the effective tolerance of every vertex.
+     *
+     * The effective tolerance of a vertex is the largest distance
+     * tolerance at which simplify() retains it. The first and last
+     * vertices have infinite effective tolerance.
+     *
+     * @param nPts the vertices of the linestring
+     * @return the effective tolerance of each vertex
+     */
+    static std::vector<double> computeEffectiveTolerances(
+        const CoordsVect& nPts);
+
     DouglasPeuckerLineSimplifier(const CoordsVect& nPts);
 
     /** \brief
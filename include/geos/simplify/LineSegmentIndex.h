@@ -26,6 +26,7 @@
 #include <geos/export.h>
 #include <geos/geom/Envelope.h>
 #include <geos/index/quadtree/Quadtree.h>
+#include <cstddef>
 #include <vector>
 #include <memory> // for unique_ptr
 
@@ -47,11 +48,25 @@ class TaggedLineString;
 namespace geos {
 namespace simplify { // geos::simplify
 
+/** \brief
+ * An index of LineSegments supporting bulk loading, removal
+ * and incremental insertion.
+ *
+ * Segments added before the first query or removal are packed into a
+ * static, Hilbert-sorted R-tree stored in flat arrays. This matches the
+ * access pattern of TopologyPreservingSimplifier, whose input index is
+ * fully populated before simplification starts and afterwards only
+ * shrinks. Removed segments are tombstoned and a live count is kept
+ * for every node so that emptied subtrees are skipped by queries.
+ *
+ * Segments added after the packed tree has been built (as happens for
+ * the output index of the simplifier) are kept in a Quadtree.
+ */
 class GEOS_DLL LineSegmentIndex {
 
 public:
 
-    LineSegmentIndex() = default;
+    LineSegmentIndex();
 
     ~LineSegmentIndex() = default;
 
@@ -64,10 +79,81 @@ public:
     std::unique_ptr< std::vector<geom::LineSegment*> >
     query(const geom::LineSegment* seg);
 
+    /** \brief
+     * Finds the segments whose envelopes intersect the envelope
+     * of the given segment.
+     *
+     * @param seg the query segment
+     * @param result vector the segments found are appended to
+     */
+    void query(const geom::LineSegment* seg,
+               std::vector<geom::LineSegment*>& result);
+
+    /// Number of segments currently in the index
+    std::size_t size() const
+    {
+        return count;
+    }
+
+    /** \brief
+     * Packs the segments added so far into the static tree.
+     *
+     * This is done implicitly by the first query or removal.
+     * Once built, queries do not modify the index, so an index
+     * must be built explicitly before it is queried from
+     * several threads at once.
+     */
+    void build();
 
 private:
 
-    index::quadtree::Quadtree index;
+    struct PackedBox {
+        double minx;
+        double miny;
+        double maxx;
+        double maxy;
+
+        bool
+        intersects(const PackedBox& o) const
+        {
+            return !(o.minx > maxx || o.maxx < minx ||
+                     o.miny > maxy || o.maxy < miny);
+        }
+    };
+
+    static const std::size_t nodeCapacity = 16;
+
+    // enough for a full depth-first traversal of a tree over 2^64 items
+    static const std::size_t maxStackSize = 256;
+
+    static PackedBox boxOf(const geom::LineSegment* seg);
+
+    bool removePacked(const geom::LineSegment* seg);
+
+    // segments added before the packed tree is built
+    std::vector<const geom::LineSegment*> pending;
+
+    // boxes of all packed tree nodes, leaves first, root last
+    std::vector<PackedBox> boxes;
+
+    // number of live segments below each node (0 or 1 for leaves)
+    std::vector<std::size_t> liveCount;
+
+    // segment of each leaf node, nullptr once removed
+    std::vector<const geom::LineSegment*> leafSegs;
+
+    // start offset of each level in boxes, plus end sentinel
+    std::vector<std::size_t> levelStart;
+
+    bool built;
+
+    std::size_t count;
+
+    // segments added after the packed tree is built
+    index::quadtree::Quadtree overflow;
+
+    // Quadtree::size() walks the whole tree, so keep our own count
+    std::size_t overflowCount;
 
     std::vector<std::unique_ptr<geom::Envelope>> newEnvelopes;
 
@@ -0,0 +1,108 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2021 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_SIMPLIFY_MULTILEVELSIMPLIFIER_H
+#define GEOS_SIMPLIFY_MULTILEVELSIMPLIFIER_H
+
+#include <geos/export.h>
+#include <memory> // for unique_ptr
+#include <unordered_map>
+#include <vector>
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251) // warning C4251: needs to have dll-interface to be used by clients of class
+#endif
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class Geometry;
+}
+}
+
+namespace geos {
+namespace simplify { // geos::simplify
+
+/** \brief
+ * Simplifies a Geometry at many tolerances, computing the
+ * significance of every vertex only once.
+ *
+ * The significance of a vertex is the largest tolerance at which
+ * it is still retained by the Douglas-Peucker algorithm (the
+ * "effective tolerance"). It is the smallest of the distances
+ * which caused the enclosing sections to be split, so a vertex is
+ * kept at tolerance `t` exactly when its significance exceeds `t`.
+ *
+ * Once the significances are computed, each call to
+ * getResultGeometry() is linear in the number of vertices and
+ * gives the same result as DouglasPeuckerSimplifier at that
+ * tolerance. This is useful to produce the levels of a tile
+ * pyramid from a single geometry.
+ *
+ * The input geometry must outlive this object.
+ */
+class GEOS_DLL MultiLevelSimplifier {
+
+public:
+
+    /** \brief
+     * Computes the vertex significances of a geometry.
+     *
+     * @param geom the geometry to simplify
+     */
+    MultiLevelSimplifier(const geom::Geometry* geom);
+
+    ~MultiLevelSimplifier();
+
+    /** \brief
+     * Gets the geometry simplified to the given distance tolerance.
+     *
+     * @param tolerance the approximation tolerance to use,
+     *                  must be non-negative
+     * @return the simplified geometry
+     */
+    std::unique_ptr<geom::Geometry> getResultGeometry(double tolerance) const;
+
+    /** \brief
+     * Gets the significance of the vertices of a linear component
+     * of the input geometry.
+     *
+     * The first and last vertices have infinite significance.
+     *
+     * @param line a LineString or LinearRing of the input geometry
+     * @return the vertex significances, or nullptr if line is not a
+     *         component of the input geometry
+     */
+    const std::vector<double>* getVertexSignificance(const geom::Geometry* line) const;
+
+private:
+
+    const geom::Geometry* inputGeom;
+
+    std::unordered_map<const geom::Geometry*, std::vector<double>> significance;
+
+    // Declare type as noncopyable
+    MultiLevelSimplifier(const MultiLevelSimplifier& other) = delete;
+    MultiLevelSimplifier& operator=(const MultiLevelSimplifier& rhs) = delete;
+};
+
+} // namespace geos::simplify
+} // namespace geos
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#endif // GEOS_SIMPLIFY_MULTILEVELSIMPLIFIER_H
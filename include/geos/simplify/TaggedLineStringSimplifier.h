@@ -77,6 +77,21 @@ public:
      */
     void setDistanceTolerance(double d);
 
+    /** \brief
+     * Sets indexes of segments belonging to lines which are not
+     * being simplified by this object.
+     *
+     * They are checked for intersections together with the input
+     * and output indexes, but are never modified, so they may be
+     * shared between simplifiers running on different threads
+     * once they have been built.
+     *
+     * @param sharedInput additional indexes of input segments
+     * @param sharedOutput additional indexes of output segments
+     */
+    void setSharedIndexes(const std::vector<LineSegmentIndex*>& sharedInput,
+                          const std::vector<LineSegmentIndex*>& sharedOutput);
+
     /**
      * Simplifies the given {@link TaggedLineString}
      * using the distance tolerance specified.
@@ -94,6 +109,12 @@ private:
     // externally owned
     LineSegmentIndex* outputIndex;
 
+    // externally owned, only queried
+    std::vector<LineSegmentIndex*> sharedInputIndexes;
+
+    // externally owned, only queried
+    std::vector<LineSegmentIndex*> sharedOutputIndexes;
+
     std::unique_ptr<algorithm::LineIntersector> li;
 
     /// non-const as segments are possibly added to it
@@ -103,6 +124,9 @@ private:
 
     double distanceTolerance;
 
+    // reused buffer for segment index query results
+    std::vector<geom::LineSegment*> querySegs;
+
     void simplifySection(std::size_t i, std::size_t j,
                          std::size_t depth);
 
@@ -27,6 +27,7 @@
 #define GEOS_SIMPLIFY_TAGGEDLINESSIMPLIFIER_H
 
 #include <geos/export.h>
+#include <cstddef>
 #include <vector>
 #include <memory>
 #include <cassert>
@@ -69,6 +70,23 @@ public:
      */
     void setDistanceTolerance(double tolerance);
 
+    /** \brief
+     * Sets the number of threads used for the simplification.
+     *
+     * With more than one thread the extent of the lines is divided
+     * into a grid. Lines crossing cell borders are simplified first,
+     * sequentially. Lines whose envelope lies strictly inside a cell
+     * cannot interact with lines of other cells, so cells are then
+     * simplified concurrently.
+     *
+     * The result is topologically valid in both modes, but as lines
+     * are processed in a different order it may differ from the
+     * sequential result.
+     *
+     * @param n number of threads; 0 or 1 simplifies sequentially
+     */
+    void setNumThreads(std::size_t n);
+
     /** \brief
      * Simplify a set of {@link TaggedLineString}s
      *
@@ -84,6 +102,16 @@ public:
         iterator_type begin,
         iterator_type end)
     {
+        if(numThreads > 1) {
+            std::vector<TaggedLineString*> lines;
+            for(iterator_type it = begin; it != end; ++it) {
+                assert(*it);
+                lines.push_back(*it);
+            }
+            simplifyParallel(lines);
+            return;
+        }
+
         // add lines to the index
         for(iterator_type it = begin; it != end; ++it) {
             assert(*it);
@@ -102,11 +130,17 @@ private:
 
     void simplify(TaggedLineString& line);
 
+    void simplifyParallel(const std::vector<TaggedLineString*>& lines);
+
     std::unique_ptr<LineSegmentIndex> inputIndex;
 
     std::unique_ptr<LineSegmentIndex> outputIndex;
 
     std::unique_ptr<TaggedLineStringSimplifier> taggedlineSimplifier;
+
+    double distanceTolerance;
+
+    std::size_t numThreads;
 };
 
 } // namespace geos::simplify
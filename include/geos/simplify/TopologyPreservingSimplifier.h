@@ -26,6 +26,7 @@
 #include <geos/export.h>
 #include <geos/geom/Geometry.h>
 #include <geos/simplify/TaggedLinesSimplifier.h>
+#include <cstddef>
 #include <memory> // for unique_ptr
 #include <map>
 
@@ -64,6 +65,8 @@ public:
 
     TopologyPreservingSimplifier(const geom::Geometry* geom);
 
+    ~TopologyPreservingSimplifier();
+
     /** \brief
      * Sets the distance tolerance for the simplification.
      *
@@ -76,6 +79,15 @@ public:
      */
     void setDistanceTolerance(double tolerance);
 
+    /** \brief
+     * Sets the number of threads used for the simplification.
+     *
+     * See TaggedLinesSimplifier::setNumThreads.
+     *
+     * @param n number of threads; 0 or 1 simplifies sequentially
+     */
+    void setNumThreads(std::size_t n);
+
     std::unique_ptr<geom::Geometry> getResultGeometry();
 
 private:
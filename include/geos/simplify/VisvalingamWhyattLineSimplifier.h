@@ -0,0 +1,128 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2021 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************
+ *
+ * Last port: simplify/VWLineSimplifier.java (JTS-1.17)
+ *
+ **********************************************************************/
+
+#ifndef GEOS_SIMPLIFY_VISVALINGAMWHYATTLINESIMPLIFIER_H
+#define GEOS_SIMPLIFY_VISVALINGAMWHYATTLINESIMPLIFIER_H
+
+#include <geos/export.h>
+#include <cstddef>
+#include <vector>
+#include <memory> // for unique_ptr
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251) // warning C4251: needs to have dll-interface to be used by clients of class
+#endif
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class Coordinate;
+}
+}
+
+namespace geos {
+namespace simplify { // geos::simplify
+
+/** \brief
+ * Simplifies a linestring (sequence of points) using the
+ * Visvalingam-Whyatt algorithm.
+ *
+ * The vertex forming the triangle of smallest area with its
+ * neighbours is removed repeatedly, as long as that area is less
+ * than the square of the distance tolerance. The first and last
+ * vertices are never removed.
+ *
+ * The vertices are kept in an indexed binary min-heap keyed on
+ * their triangle area, and in a doubly-linked list giving the
+ * current neighbours of each vertex. Removing a vertex unlinks it
+ * and updates the heap position of its two neighbours, so the
+ * whole simplification is O(n log n).
+ */
+class GEOS_DLL VisvalingamWhyattLineSimplifier {
+
+public:
+
+    typedef std::vector<geom::Coordinate> CoordsVect;
+    typedef std::unique_ptr<CoordsVect> CoordsVectAutoPtr;
+
+    /** \brief
+     * Returns a newly allocated Coordinate vector, wrapped
+     * into an unique_ptr
+     */
+    static CoordsVectAutoPtr simplify(
+        const CoordsVect& nPts,
+        double distanceTolerance);
+
+    VisvalingamWhyattLineSimplifier(const CoordsVect& nPts);
+
+    /** \brief
+     * Sets the distance tolerance for the simplification.
+     *
+     * Vertices are removed while the area of the triangle they
+     * form with their neighbours is less than the square of
+     * this distance.
+     *
+     * @param nDistanceTolerance the approximation tolerance to use
+     */
+    void setDistanceTolerance(double nDistanceTolerance);
+
+    /** \brief
+     * Returns a newly allocated Coordinate vector, wrapped
+     * into an unique_ptr
+     */
+    CoordsVectAutoPtr simplify();
+
+private:
+
+    const CoordsVect& pts;
+    double areaTolerance;
+
+    // linked list of the remaining vertices
+    std::vector<std::size_t> prev;
+    std::vector<std::size_t> next;
+
+    // triangle area of each vertex
+    std::vector<double> area;
+
+    // indexed min-heap of vertices, and the heap position of each vertex
+    std::vector<std::size_t> heap;
+    std::vector<std::size_t> heapPos;
+
+    double triangleArea(std::size_t i) const;
+
+    bool heapLess(std::size_t a, std::size_t b) const;
+    void heapSwap(std::size_t a, std::size_t b);
+    void siftUp(std::size_t pos);
+    void siftDown(std::size_t pos);
+    void heapRemoveTop();
+    void updateArea(std::size_t i);
+
+    // Declare type as noncopyable
+    VisvalingamWhyattLineSimplifier(const VisvalingamWhyattLineSimplifier& other) = delete;
+    VisvalingamWhyattLineSimplifier& operator=(const VisvalingamWhyattLineSimplifier& rhs) = delete;
+};
+
+} // namespace geos::simplify
+} // namespace geos
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#endif // GEOS_SIMPLIFY_VISVALINGAMWHYATTLINESIMPLIFIER_H
@@ -0,0 +1,84 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2021 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************
+ *
+ * Last port: simplify/VWSimplifier.java (JTS-1.17)
+ *
+ **********************************************************************/
+
+#ifndef GEOS_SIMPLIFY_VISVALINGAMWHYATTSIMPLIFIER_H
+#define GEOS_SIMPLIFY_VISVALINGAMWHYATTSIMPLIFIER_H
+
+#include <geos/export.h>
+#include <memory> // for unique_ptr
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class Geometry;
+}
+}
+
+namespace geos {
+namespace simplify { // geos::simplify
+
+
+/** \brief
+ * Simplifies a Geometry using the Visvalingam-Whyatt area-based
+ * algorithm.
+ *
+ * Ensures that any polygonal geometries returned are valid.
+ * Simple lines are not guaranteed to remain simple after simplification.
+ *
+ * The tolerance is a distance: vertices are removed while the
+ * triangle they form with their neighbours has an area less than
+ * the square of the tolerance. Like Douglas-Peucker, this does not
+ * preserve topology; use TopologyPreservingSimplifier for that.
+ *
+ * @see VisvalingamWhyattLineSimplifier
+ */
+class GEOS_DLL VisvalingamWhyattSimplifier {
+
+public:
+
+    static std::unique_ptr<geom::Geometry> simplify(
+        const geom::Geometry* geom,
+        double tolerance);
+
+    VisvalingamWhyattSimplifier(const geom::Geometry* geom);
+
+    /** \brief
+     * Sets the distance tolerance for the simplification.
+     *
+     * The tolerance value must be non-negative.  A tolerance value
+     * of zero is effectively a no-op.
+     *
+     * @param tolerance the approximation tolerance to use
+     */
+    void setDistanceTolerance(double tolerance);
+
+    std::unique_ptr<geom::Geometry> getResultGeometry();
+
+
+private:
+
+    const geom::Geometry* inputGeom;
+
+    double distanceTolerance;
+};
+
+
+} // namespace geos::simplify
+} // namespace geos
+
+#endif // GEOS_SIMPLIFY_VISVALINGAMWHYATTSIMPLIFIER_H
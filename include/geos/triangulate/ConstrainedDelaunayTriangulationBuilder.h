@@ -0,0 +1,112 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2021 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_TRIANGULATE_CONSTRAINEDDELAUNAYTRIANGULATIONBUILDER_H
+#define GEOS_TRIANGULATE_CONSTRAINEDDELAUNAYTRIANGULATIONBUILDER_H
+
+#include <geos/export.h>
+#include <geos/geom/CoordinateSequence.h>
+
+#include <memory>
+#include <vector>
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251) // warning C4251: needs to have dll-interface to be used by clients of class
+#endif
+
+namespace geos {
+namespace geom {
+class Geometry;
+class GeometryCollection;
+class GeometryFactory;
+}
+namespace triangulate {
+namespace quadedge {
+class QuadEdge;
+class QuadEdgeSubdivision;
+}
+}
+}
+
+namespace geos {
+namespace triangulate { //geos.triangulate
+
+/** \brief
+ * A utility class which creates Constrained Delaunay Triangulations
+ * of polygons and extracts the triangles covering them as geometries.
+ *
+ * All vertices of the polygon rings are triangulated, and the ring
+ * segments are then inserted as constraints with
+ * ConstrainedDelaunayTriangulator, so that the triangles follow the
+ * polygon edges and holes. The triangulation takes O(n log n) time for
+ * n vertices, and is suitable for polygons of millions of vertices.
+ *
+ * The polygons must be valid and must not overlap each other. They may
+ * share edges, and lie in the holes of other polygons.
+ */
+class GEOS_DLL ConstrainedDelaunayTriangulationBuilder {
+private:
+    // the rings of each polygon, shell first, all counter-clockwise
+    std::vector<std::vector<std::unique_ptr<geom::CoordinateSequence>>> polygons;
+    std::unique_ptr<quadedge::QuadEdgeSubdivision> subdiv;
+    std::vector<quadedge::QuadEdge*> triangles;
+
+    void create();
+
+public:
+    /**
+     * Creates a new triangulation builder.
+     */
+    ConstrainedDelaunayTriangulationBuilder();
+
+    ~ConstrainedDelaunayTriangulationBuilder();
+
+    /**
+     * Sets the polygons to triangulate.
+     * The non-polygonal components of the geometry are ignored.
+     *
+     * @param geom the geometry from which the polygons will be extracted
+     */
+    void setConstraints(const geom::Geometry& geom);
+
+    /**
+     * Gets the triangles covering the polygons as a
+     * {@link geom::GeometryCollection} of {@link geom::Polygon}.
+     *
+     * The triangles of each polygon form a Constrained Delaunay
+     * Triangulation of its vertices, whose edges include the ring
+     * segments.
+     *
+     * @param geomFact the geometry factory to use to create the output
+     * @return the triangles, empty if there are no polygons
+     *
+     * @throws util::IllegalArgumentException if ring segments cross
+     */
+    std::unique_ptr<geom::GeometryCollection> getTriangles(const geom::GeometryFactory& geomFact);
+
+private:
+    // Declare type as noncopyable
+    ConstrainedDelaunayTriangulationBuilder(const ConstrainedDelaunayTriangulationBuilder& other) = delete;
+    ConstrainedDelaunayTriangulationBuilder& operator=(const ConstrainedDelaunayTriangulationBuilder& rhs) = delete;
+};
+
+} //namespace geos.triangulate
+} //namespace goes
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#endif //GEOS_TRIANGULATE_CONSTRAINEDDELAUNAYTRIANGULATIONBUILDER_H
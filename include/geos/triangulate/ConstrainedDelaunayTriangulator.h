@@ -0,0 +1,135 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2021 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_TRIANGULATE_CONSTRAINEDDELAUNAYTRIANGULATOR_H
+#define GEOS_TRIANGULATE_CONSTRAINEDDELAUNAYTRIANGULATOR_H
+
+#include <geos/export.h>
+
+#include <vector>
+
+namespace geos {
+namespace geom {
+class CoordinateSequence;
+}
+namespace triangulate {
+namespace quadedge {
+class QuadEdge;
+class QuadEdgeSubdivision;
+class Vertex;
+}
+}
+}
+
+namespace geos {
+namespace triangulate { //geos.triangulate
+
+/** \brief
+ * Turns a Delaunay triangulation into a Constrained Delaunay
+ * Triangulation, by inserting segments between its sites which must
+ * be edges of the result.
+ *
+ * The endpoints of the constraints must already be sites of the
+ * {@link quadedge::QuadEdgeSubdivision}, for instance inserted with
+ * IncrementalDelaunayTriangulator. A segment is recovered by swapping
+ * the edges crossing it (Sloan, 1993), and the new edges on both sides
+ * are then swapped until they are locally Delaunay. The cost
+ * of a segment is proportional to the number of edges crossing it,
+ * which is small when the segments are polygon edges whose vertices are
+ * all sites, so rings of millions of vertices are inserted in linear
+ * time once the sites are triangulated.
+ *
+ * Constraints must not cross each other. A site lying in the interior
+ * of a constraint splits it in two.
+ */
+class GEOS_DLL ConstrainedDelaunayTriangulator {
+private:
+    quadedge::QuadEdgeSubdivision* subdiv;
+
+    quadedge::QuadEdge* findCrossings(quadedge::QuadEdge& start, const quadedge::Vertex& end,
+                                      std::vector<quadedge::QuadEdge*>& crossings,
+                                      quadedge::Vertex& segEnd) const;
+
+    quadedge::QuadEdge* recoverSegment(const quadedge::Vertex& a, const quadedge::Vertex& b,
+                                       std::vector<quadedge::QuadEdge*>& crossings);
+
+    void restoreDelaunay(const std::vector<quadedge::QuadEdge*>& edges);
+
+    quadedge::QuadEdge& insertConstraint(quadedge::QuadEdge& start, const quadedge::Vertex& end,
+                                         std::vector<quadedge::QuadEdge*>* edges);
+
+public:
+    /**
+     * The constrained edges of the rings of a polygon, the shell first,
+     * each ring counter-clockwise and its edges directed along it, so
+     * that the interior of the ring is on the left of its edges.
+     */
+    typedef std::vector<std::vector<quadedge::QuadEdge*>> PolygonEdges;
+
+    /**
+     * Creates a new triangulator inserting constraints in the given
+     * {@link quadedge::QuadEdgeSubdivision}.
+     *
+     * @param subdiv a subdivision holding a Delaunay triangulation
+     *               of the constraint vertices
+     */
+    ConstrainedDelaunayTriangulator(quadedge::QuadEdgeSubdivision* subdiv);
+
+    /**
+     * Inserts a segment between two sites as a constraint.
+     *
+     * @param start an edge originating at the first site
+     * @param end the second site
+     * @return the constrained edge ending at `end`
+     *
+     * @throws util::IllegalArgumentException if the segment crosses
+     *         a constraint
+     */
+    quadedge::QuadEdge& insertConstraint(quadedge::QuadEdge& start, const quadedge::Vertex& end);
+
+    /**
+     * Inserts all segments of a line, such as a polygon ring,
+     * as constraints.
+     *
+     * @param line the vertices of the line, which must be sites
+     * @param edges receives the constrained edges along the line, in
+     *              order and directed along it. A segment split by sites
+     *              lying on it gives several edges.
+     *
+     * @throws util::IllegalArgumentException if a vertex is not a site,
+     *         or if a segment crosses a constraint
+     */
+    void insertConstraints(const geom::CoordinateSequence& line,
+                           std::vector<quadedge::QuadEdge*>& edges);
+
+    /**
+     * Gets the triangles covering the interiors of polygons whose rings
+     * have been inserted as constraints.
+     *
+     * The triangles of each polygon are those inside its shell, found
+     * without crossing the edges of the shell, less those inside its
+     * holes. Polygons may share edges, and may lie in the holes of
+     * others, but must not overlap.
+     * Uses the data of the edges as scratch space.
+     *
+     * @param polygons the constrained edges of the rings of each polygon
+     * @return for each triangle, the edge having the triangle on its left
+     */
+    std::vector<quadedge::QuadEdge*> getEnclosedTriangles(const std::vector<PolygonEdges>& polygons);
+};
+
+} //namespace geos.triangulate
+} //namespace goes
+
+#endif //GEOS_TRIANGULATE_CONSTRAINEDDELAUNAYTRIANGULATOR_H
@@ -20,6 +20,7 @@
 #define GEOS_TRIANGULATE_DELAUNAYTRIANGULATIONBUILDER_H
 
 #include <geos/triangulate/IncrementalDelaunayTriangulator.h>
+#include <geos/triangulate/quadedge/TriangleMesh.h>
 #include <geos/geom/CoordinateSequence.h>
 
 #include <memory>
@@ -31,9 +32,11 @@ class MultiLineString;
 class GeometryCollection;
 class GeometryFactory;
 class Envelope;
+class PointSet;
 }
 namespace triangulate {
 namespace quadedge {
+class HalfEdgeSubdivision;
 class QuadEdgeSubdivision;
 }
 }
@@ -54,6 +57,20 @@ namespace triangulate { //geos.triangulate
  */
 class GEOS_DLL DelaunayTriangulationBuilder {
 public:
+    /**
+     * The order in which the sites are inserted in the triangulation.
+     * The triangulation is the same for all orders, up to the choice
+     * of diagonals between cocircular sites.
+     */
+    enum class InsertionOrder {
+        /// Sites sorted by X then Y
+        LEXICOGRAPHIC,
+        /// Sites sorted along a Hilbert curve
+        HILBERT,
+        /// Biased randomized insertion order, Hilbert sorted within rounds
+        BRIO
+    };
+
     /**
      * Extracts the unique {@link geom::Coordinate}s from the given
      * {@link geom::Geometry}.
@@ -82,7 +99,11 @@ public:
 private:
     std::unique_ptr<geom::CoordinateSequence> siteCoords;
     double tolerance;
+    InsertionOrder insertionOrder;
+    std::size_t numThreads;
+    bool compact;
     std::unique_ptr<quadedge::QuadEdgeSubdivision> subdiv;
+    std::unique_ptr<quadedge::HalfEdgeSubdivision> halfEdgeSubdiv;
 
 public:
     /**
@@ -91,7 +112,7 @@ public:
      */
     DelaunayTriangulationBuilder();
 
-    ~DelaunayTriangulationBuilder() = default;
+    ~DelaunayTriangulationBuilder();
 
     /**
      * Sets the sites (vertices) which will be triangulated.
@@ -109,6 +130,15 @@ public:
      */
     void setSites(const geom::CoordinateSequence& coords);
 
+    /**
+     * Sets the sites (vertices) which will be triangulated
+     * from points given as arrays of ordinates, without building
+     * a Geometry. Duplicate points are removed.
+     *
+     * @param pts a PointSet.
+     */
+    void setSites(const geom::PointSet& pts);
+
     /**
      * Sets the snapping tolerance which will be used
      * to improved the robustness of the triangulation computation.
@@ -122,6 +152,59 @@ public:
         this->tolerance = p_tolerance;
     }
 
+    /**
+     * Sets the order in which the sites are inserted.
+     *
+     * The default, InsertionOrder::LEXICOGRAPHIC, degrades into long
+     * walks of the point locator on gridded or clustered input.
+     * InsertionOrder::HILBERT and InsertionOrder::BRIO keep consecutive
+     * sites close together and make large inputs practical.
+     *
+     * @param order the insertion order to use
+     */
+    void
+    setInsertionOrder(InsertionOrder order)
+    {
+        insertionOrder = order;
+    }
+
+    /**
+     * Sets the number of threads used to compute the triangulation.
+     *
+     * With more than one thread and no snapping tolerance, the sites are
+     * triangulated with DivideAndConquerDelaunayTriangulator. The result
+     * is the same as the sequential one, up to the choice of diagonals
+     * between cocircular sites. The insertion order is then irrelevant.
+     * The default is 1.
+     *
+     * @param n the number of threads
+     */
+    void
+    setNumThreads(std::size_t n)
+    {
+        numThreads = n < 1 ? 1 : n;
+    }
+
+    /**
+     * Sets whether the triangulation is built in a compact
+     * {@link quadedge::HalfEdgeSubdivision} rather than in a
+     * {@link quadedge::QuadEdgeSubdivision}.
+     *
+     * The compact subdivision stores 32-bit indices in contiguous arrays
+     * and takes several times less memory, which keeps the triangulation
+     * of millions of sites in cache. getTriangles() and getTriangleMesh()
+     * read it directly, while getSubdivision() and getEdges() first copy
+     * it into a QuadEdgeSubdivision. It is only used by the sequential
+     * triangulation. The default is `false`.
+     *
+     * @param p_compact `true` to use the compact subdivision
+     */
+    void
+    setCompact(bool p_compact)
+    {
+        compact = p_compact;
+    }
+
 private:
     void create();
 
@@ -150,6 +233,17 @@ public:
      */
     std::unique_ptr<geom::GeometryCollection> getTriangles(const geom::GeometryFactory& geomFact);
 
+    /**
+     * Gets the faces of the computed triangulation as an indexed mesh
+     * of vertex coordinates and vertex index triples, without creating
+     * any geometry.
+     *
+     * @param includeNeighbours `true` to also compute the index of the
+     *                          triangle adjacent to each triangle edge
+     * @return the triangulation mesh
+     */
+    quadedge::TriangleMesh getTriangleMesh(bool includeNeighbours = false);
+
     /**
      * Computes the {@link geom::Envelope} of a collection of
      * {@link geom::Coordinate}s.
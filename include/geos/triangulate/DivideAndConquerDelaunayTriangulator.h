@@ -0,0 +1,84 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2021 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_TRIANGULATE_DIVIDEANDCONQUERDELAUNAYTRIANGULATOR_H
+#define GEOS_TRIANGULATE_DIVIDEANDCONQUERDELAUNAYTRIANGULATOR_H
+
+#include <geos/export.h>
+#include <geos/triangulate/IncrementalDelaunayTriangulator.h>
+
+#include <cstddef>
+
+namespace geos {
+namespace triangulate { //geos.triangulate
+
+namespace quadedge {
+class QuadEdgeSubdivision;
+}
+
+/** \brief
+ * Computes a Delaunay Triangulation of a set of {@link quadedge::Vertex}es
+ * with the divide-and-conquer algorithm of Guibas and Stolfi, optionally
+ * on several threads.
+ *
+ * The sites and the frame vertices of the subdivision are sorted and split
+ * recursively. The top levels of the recursion run on separate threads,
+ * each building its part in its own QuadEdge container, and the parts are
+ * merged along their seams. The result is then copied into the subdivision.
+ *
+ * Since the frame vertices are triangulated along with the sites, the result
+ * is the same as with IncrementalDelaunayTriangulator, up to the choice of
+ * diagonals between cocircular sites. Unlike it, no snapping tolerance is
+ * applied.
+ */
+class GEOS_DLL DivideAndConquerDelaunayTriangulator {
+private:
+    quadedge::QuadEdgeSubdivision* subdiv;
+    std::size_t numThreads;
+
+public:
+    /**
+     * Creates a new triangulator for the given {@link quadedge::QuadEdgeSubdivision},
+     * which must not contain anything but its frame.
+     *
+     * @param subdiv a subdivision in which to build the TIN
+     */
+    DivideAndConquerDelaunayTriangulator(quadedge::QuadEdgeSubdivision* subdiv);
+
+    /**
+     * Sets the number of threads used to triangulate.
+     * The default is 1.
+     *
+     * @param n the number of threads
+     */
+    void
+    setNumThreads(std::size_t n)
+    {
+        numThreads = n < 1 ? 1 : n;
+    }
+
+    /**
+     * Triangulates a collection of sites, replacing the edges of the
+     * subdivision. The vertices <b>MUST</b> be unique, and lie within
+     * the subdivision frame.
+     *
+     * @param vertices a Collection of Vertex
+     */
+    void insertSites(const IncrementalDelaunayTriangulator::VertexList& vertices);
+};
+
+} //namespace geos.triangulate
+} //namespace goes
+
+#endif //GEOS_TRIANGULATE_DIVIDEANDCONQUERDELAUNAYTRIANGULATOR_H
@@ -0,0 +1,185 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2021 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_TRIANGULATE_DYNAMICDELAUNAYTRIANGULATION_H
+#define GEOS_TRIANGULATE_DYNAMICDELAUNAYTRIANGULATION_H
+
+#include <geos/export.h>
+#include <geos/geom/Envelope.h>
+#include <geos/triangulate/quadedge/TriangleMesh.h>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251) // warning C4251: needs to have dll-interface to be used by clients of class
+#endif
+
+namespace geos {
+namespace geom {
+class Coordinate;
+class CoordinateSequence;
+class GeometryCollection;
+class GeometryFactory;
+}
+}
+
+namespace geos {
+namespace triangulate { //geos.triangulate
+
+namespace quadedge {
+class QuadEdge;
+class QuadEdgeSubdivision;
+struct VoronoiCells;
+}
+
+/** \brief
+ * A Delaunay triangulation which is updated in place as sites
+ * are inserted and removed, for sites which move or appear and
+ * disappear over time.
+ *
+ * Sites are inserted incrementally, as by DelaunayTriangulationBuilder.
+ * A site is removed by flipping the edges of its star until it has
+ * only 3 neighbours, then deleting them: each flip cuts off an ear of
+ * the polygon of its neighbours, chosen so that the circumcircle of the
+ * ear holds none of the other neighbours, which leaves the polygon
+ * triangulated as the Delaunay triangulation of the remaining sites.
+ * Only the triangles around the site are changed.
+ *
+ * The sites must lie in the envelope given at construction, which
+ * fixes the frame of the triangulation. Removing sites leaves deleted
+ * edges in the subdivision, which are dropped when they outnumber
+ * the live ones, invalidating any reference to the edges.
+ */
+class GEOS_DLL DynamicDelaunayTriangulation {
+private:
+    geom::Envelope env;
+    std::unique_ptr<quadedge::QuadEdgeSubdivision> subdiv;
+    std::size_t numSites;
+    std::size_t numRemovedEdges;
+
+    quadedge::QuadEdge* findSite(const geom::Coordinate& p);
+    void removeStar(quadedge::QuadEdge& e);
+    void compact();
+
+public:
+    /**
+     * Creates an empty triangulation for sites lying in an envelope.
+     *
+     * @param env the envelope of all sites to be inserted
+     * @param tolerance the snapping tolerance
+     *
+     * @throws util::IllegalArgumentException if the envelope is null
+     *         or a single point
+     */
+    DynamicDelaunayTriangulation(const geom::Envelope& env, double tolerance = 0.0);
+
+    ~DynamicDelaunayTriangulation();
+
+    /**
+     * Inserts a site.
+     *
+     * @param p the site
+     * @return `false` if the site is already in the triangulation
+     *
+     * @throws util::IllegalArgumentException if the site is outside of
+     *         the envelope of the triangulation
+     */
+    bool insertSite(const geom::Coordinate& p);
+
+    /**
+     * Inserts the sites of a sequence, in an order which keeps the
+     * insertion local. Sites already in the triangulation are skipped.
+     *
+     * @param coords the sites
+     * @return the number of sites inserted
+     *
+     * @throws util::IllegalArgumentException if a site is outside of
+     *         the envelope of the triangulation
+     */
+    std::size_t insertSites(const geom::CoordinateSequence& coords);
+
+    /**
+     * Removes a site.
+     *
+     * @param p the site
+     * @return `false` if the site is not in the triangulation
+     */
+    bool removeSite(const geom::Coordinate& p);
+
+    /**
+     * Tests whether a site is in the triangulation.
+     */
+    bool containsSite(const geom::Coordinate& p);
+
+    std::size_t
+    getNumSites() const
+    {
+        return numSites;
+    }
+
+    const geom::Envelope&
+    getEnvelope() const
+    {
+        return env;
+    }
+
+    /**
+     * Gets the subdivision holding the triangulation, without any
+     * deleted edge.
+     *
+     * @return the subdivision
+     */
+    quadedge::QuadEdgeSubdivision& getSubdivision();
+
+    /**
+     * Gets the triangles of the current triangulation.
+     *
+     * @param geomFact the geometry factory to use to create the output
+     * @return a GeometryCollection of triangular polygons
+     */
+    std::unique_ptr<geom::GeometryCollection> getTriangles(const geom::GeometryFactory& geomFact);
+
+    /**
+     * Gets the triangles of the current triangulation as an indexed mesh.
+     *
+     * @param includeNeighbours `true` to compute the triangle adjacency
+     * @return the mesh
+     */
+    quadedge::TriangleMesh getTriangleMesh(bool includeNeighbours = false);
+
+    /**
+     * Gets the cells of the Voronoi diagram of the current sites,
+     * clipped to the envelope of the triangulation.
+     *
+     * @param cells the cells to fill; existing contents are replaced
+     */
+    void getVoronoiCells(quadedge::VoronoiCells& cells);
+
+private:
+    // Declare type as noncopyable
+    DynamicDelaunayTriangulation(const DynamicDelaunayTriangulation& other) = delete;
+    DynamicDelaunayTriangulation& operator=(const DynamicDelaunayTriangulation& rhs) = delete;
+};
+
+} //namespace geos.triangulate
+} //namespace goes
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#endif //GEOS_TRIANGULATE_DYNAMICDELAUNAYTRIANGULATION_H
@@ -19,7 +19,9 @@
 #ifndef GEOS_TRIANGULATE_INCREMENTALDELAUNAYTRIANGULATOR_H
 #define GEOS_TRIANGULATE_INCREMENTALDELAUNAYTRIANGULATOR_H
 
+#include <cstdint>
 #include <list>
+#include <vector>
 
 #include <geos/triangulate/quadedge/Vertex.h>
 
@@ -28,6 +30,7 @@ namespace geos {
 namespace triangulate { //geos.triangulate
 
 namespace quadedge {
+class HalfEdgeSubdivision;
 class QuadEdge;
 class QuadEdgeSubdivision;
 }
@@ -42,8 +45,12 @@ class QuadEdgeSubdivision;
 class GEOS_DLL IncrementalDelaunayTriangulator {
 private:
     quadedge::QuadEdgeSubdivision* subdiv;
+    quadedge::HalfEdgeSubdivision* halfEdgeSubdiv;
     bool isUsingTolerance;
 
+    void insertSite(quadedge::HalfEdgeSubdivision& heSubdiv, const quadedge::Vertex& v,
+                    std::vector<int32_t>& suspectEdges);
+
 public:
     /**
      * Creates a new triangulator using the given {@link quadedge::QuadEdgeSubdivision}.
@@ -54,6 +61,16 @@ public:
      */
     IncrementalDelaunayTriangulator(quadedge::QuadEdgeSubdivision* subdiv);
 
+    /**
+     * Creates a new triangulator building the TIN in the compact
+     * {@link quadedge::HalfEdgeSubdivision}, which suits large inputs.
+     * Sites can then only be inserted with insertSites().
+     *
+     * @param subdiv
+     *          a subdivision in which to build the TIN
+     */
+    IncrementalDelaunayTriangulator(quadedge::HalfEdgeSubdivision* subdiv);
+
     typedef std::vector<quadedge::Vertex> VertexList;
 
     /**
@@ -74,10 +91,35 @@ public:
      * triangulation, and fixes the affected edges so that the result
      * is still a Delaunay triangulation.
      * <p>
+     * Requires the triangulator to use a {@link quadedge::QuadEdgeSubdivision}.
      *
      * @return a quadedge containing the inserted vertex
      */
     quadedge::QuadEdge& insertSite(const quadedge::Vertex& v);
+
+    /**
+     * Sorts vertices along a Hilbert curve over their extent.
+     * Consecutive vertices are then spatially close, so the walk
+     * of the locator from the last inserted site is short.
+     *
+     * @param vertices the vertices to sort
+     */
+    static void sortHilbert(VertexList& vertices);
+
+    /**
+     * Sorts vertices in a Biased Randomized Insertion Order (BRIO).
+     *
+     * Vertices are assigned to rounds of geometrically increasing
+     * size, each holding about half of the remaining vertices, and are
+     * sorted along a Hilbert curve within each round. This keeps the
+     * expected cost of random insertion while preserving locality,
+     * and avoids the long thin fans produced by gridded input.
+     * The order is deterministic for a given seed.
+     *
+     * @param vertices the vertices to sort
+     * @param seed the seed of the random round assignment
+     */
+    static void sortBRIO(VertexList& vertices, unsigned int seed = 0);
 };
 
 } //namespace geos.triangulate
@@ -0,0 +1,104 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2021 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_TRIANGULATE_VORONOICELLLOCATOR_H
+#define GEOS_TRIANGULATE_VORONOICELLLOCATOR_H
+
+#include <geos/export.h>
+#include <geos/geom/Envelope.h>
+
+#include <cstddef>
+#include <vector>
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251) // warning C4251: needs to have dll-interface to be used by clients of class
+#endif
+
+namespace geos {
+namespace triangulate { //geos.triangulate
+
+namespace quadedge {
+struct VoronoiCells;
+}
+
+/** \brief
+ * Finds the Voronoi cell containing a point.
+ *
+ * The cells are bucketed by their envelopes in a uniform grid having
+ * about as many buckets as cells. A point is located in the cell of the
+ * nearest of the sites bucketed with it, which is exact since the cells
+ * are the regions closest to their sites.
+ *
+ * The locator keeps a reference to the cells, which must outlive it.
+ */
+class GEOS_DLL VoronoiCellLocator {
+private:
+    const quadedge::VoronoiCells& cells;
+    geom::Envelope extent;
+    std::size_t numCols;
+    std::size_t numRows;
+    double cellWidth;
+    double cellHeight;
+    // the cells of bucket `i` are bucketCells[bucketOffsets[i]] to
+    // bucketCells[bucketOffsets[i + 1] - 1]
+    std::vector<std::size_t> bucketOffsets;
+    std::vector<std::size_t> bucketCells;
+
+    std::size_t col(double x) const;
+    std::size_t row(double y) const;
+
+public:
+    /**
+     * Creates a locator for the given cells.
+     *
+     * @param cells the cells of a Voronoi diagram
+     */
+    VoronoiCellLocator(const quadedge::VoronoiCells& cells);
+
+    /**
+     * Finds the cell containing a point.
+     *
+     * A point on the boundary of several cells is located in one of them.
+     *
+     * @param x the X ordinate of the point
+     * @param y the Y ordinate of the point
+     * @param cell set to the index of the cell containing the point
+     * @return `false` if the point is outside of the diagram
+     */
+    bool locate(double x, double y, std::size_t& cell) const;
+
+    /**
+     * Gets the envelope of the cells.
+     */
+    const geom::Envelope&
+    getExtent() const
+    {
+        return extent;
+    }
+
+private:
+    // Declare type as noncopyable
+    VoronoiCellLocator(const VoronoiCellLocator& other) = delete;
+    VoronoiCellLocator& operator=(const VoronoiCellLocator& rhs) = delete;
+};
+
+} //namespace geos.triangulate
+} //namespace goes
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#endif //GEOS_TRIANGULATE_VORONOICELLLOCATOR_H
@@ -20,6 +20,7 @@
 #define GEOS_TRIANGULATE_VORONOIDIAGRAMBUILDER_H
 
 #include <geos/triangulate/quadedge/QuadEdgeSubdivision.h>
+#include <geos/triangulate/quadedge/VoronoiCells.h>
 #include <geos/geom/Envelope.h> // for composition
 #include <memory>
 #include <iostream>
@@ -116,9 +117,24 @@ public:
      */
     std::unique_ptr<geom::Geometry> getDiagramEdges(const geom::GeometryFactory& geomFact);
 
+    /** \brief
+     * Gets the faces of the computed diagram as flat coordinate runs,
+     * clipped as specified.
+     *
+     * This avoids creating a geometry for each cell, and clips the cells
+     * to the envelope directly rather than with an overlay operation.
+     * The `siteIndices` of the result hold the index of the site of each
+     * cell in the coordinates given to setSites(); when a site is repeated,
+     * this is the index of its first occurrence.
+     *
+     * @return the faces of the diagram
+     */
+    quadedge::VoronoiCells getDiagramCells();
+
 private:
 
     std::unique_ptr<geom::CoordinateSequence> siteCoords;
+    std::vector<std::size_t> siteInputIndex; // index in the input of each site coordinate
     double tolerance;
     std::unique_ptr<quadedge::QuadEdgeSubdivision> subdiv;
     const geom::Envelope* clipEnv; // externally owned
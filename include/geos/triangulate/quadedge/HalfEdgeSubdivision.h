@@ -0,0 +1,320 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2021 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_TRIANGULATE_QUADEDGE_HALFEDGESUBDIVISION_H
+#define GEOS_TRIANGULATE_QUADEDGE_HALFEDGESUBDIVISION_H
+
+#include <geos/export.h>
+#include <geos/geom/Envelope.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251) // warning C4251: needs to have dll-interface to be used by clients of class
+#endif
+
+namespace geos {
+namespace geom {
+class GeometryCollection;
+class GeometryFactory;
+}
+}
+
+namespace geos {
+namespace triangulate { //geos.triangulate
+namespace quadedge { //geos.triangulate.quadedge
+
+class QuadEdgeSubdivision;
+struct TriangleMesh;
+
+/** \brief
+ * A compact, index-based triangulation, holding the same triangulations
+ * as a {@link QuadEdgeSubdivision} in a fraction of its memory.
+ *
+ * Vertices are stored as separate arrays of X, Y (and, if any site has
+ * one, Z) ordinates. Each triangle is stored as 3 consecutive half-edges,
+ * in CCW order, so that half-edge `e` belongs to triangle `e / 3` and is
+ * followed by next(e) in it. Only the origin vertex and the opposite
+ * half-edge (`twin`) of each half-edge are stored, as 32-bit indices.
+ * Navigation is then arithmetic on indices into contiguous arrays,
+ * rather than pointer chasing between separately allocated quadedges.
+ *
+ * As in QuadEdgeSubdivision, the triangulation is enclosed in a frame
+ * triangle whose vertices are the first 3 vertices. The half-edges of
+ * the frame border have no twin. Triangles are never deleted, since
+ * insertion only splits and flips them.
+ *
+ * The Delaunay property is maintained by IncrementalDelaunayTriangulator;
+ * this class only provides the topological operations.
+ */
+class GEOS_DLL HalfEdgeSubdivision {
+private:
+    double tolerance;
+    double edgeCoincidenceTolerance;
+    geom::Envelope siteEnv;
+
+    std::vector<double> xs;
+    std::vector<double> ys;
+    std::vector<double> zs; // empty while all vertices are 2D
+
+    std::vector<int32_t> origins;
+    std::vector<int32_t> twins;
+
+    int32_t lastEdge;
+
+    void setTriangle(int32_t t, int32_t v0, int32_t v1, int32_t v2);
+
+    void
+    link(int32_t e, int32_t f)
+    {
+        twins[static_cast<std::size_t>(e)] = f;
+        if(f >= 0) {
+            twins[static_cast<std::size_t>(f)] = e;
+        }
+    }
+
+    int32_t newTriangle();
+
+    int orientation(int32_t e, double x, double y) const;
+
+public:
+    /**
+     * Creates a subdivision whose frame encloses an envelope,
+     * using the same frame as a {@link QuadEdgeSubdivision}.
+     *
+     * @param env the envelope of the sites to insert
+     * @param tolerance the snapping tolerance
+     */
+    HalfEdgeSubdivision(const geom::Envelope& env, double tolerance);
+
+    ~HalfEdgeSubdivision();
+
+    /**
+     * Reserves space for a number of sites.
+     */
+    void reserve(std::size_t numSites);
+
+    double
+    getTolerance() const
+    {
+        return tolerance;
+    }
+
+    std::size_t
+    getNumVertices() const
+    {
+        return xs.size();
+    }
+
+    std::size_t
+    getNumTriangles() const
+    {
+        return origins.size() / 3;
+    }
+
+    double
+    getX(int32_t v) const
+    {
+        return xs[static_cast<std::size_t>(v)];
+    }
+
+    double
+    getY(int32_t v) const
+    {
+        return ys[static_cast<std::size_t>(v)];
+    }
+
+    /**
+     * Gets the Z of a vertex, or NaN.
+     */
+    double getZ(int32_t v) const;
+
+    static bool
+    isFrameVertex(int32_t v)
+    {
+        return v < 3;
+    }
+
+    static int32_t
+    next(int32_t e)
+    {
+        return e % 3 == 2 ? e - 2 : e + 1;
+    }
+
+    static int32_t
+    prev(int32_t e)
+    {
+        return e % 3 == 0 ? e + 2 : e - 1;
+    }
+
+    /**
+     * Gets the origin vertex of a half-edge.
+     */
+    int32_t
+    orig(int32_t e) const
+    {
+        return origins[static_cast<std::size_t>(e)];
+    }
+
+    /**
+     * Gets the destination vertex of a half-edge.
+     */
+    int32_t
+    dest(int32_t e) const
+    {
+        return origins[static_cast<std::size_t>(next(e))];
+    }
+
+    /**
+     * Gets the opposite half-edge, or -1 on the frame border.
+     */
+    int32_t
+    twin(int32_t e) const
+    {
+        return twins[static_cast<std::size_t>(e)];
+    }
+
+    /**
+     * Adds a vertex, which is not connected to the triangulation
+     * until it is used to split a triangle or an edge.
+     *
+     * @return the index of the new vertex
+     *
+     * @throws util::IllegalArgumentException if there are too many
+     *         vertices for 32-bit indices
+     */
+    int32_t addVertex(double x, double y, double z);
+
+    /**
+     * Locates a point in the triangulation, walking from the last
+     * located triangle.
+     *
+     * @return a half-edge whose origin is the point, or which contains
+     *         the point, or whose triangle contains the point
+     *
+     * @throws LocateFailureException if the point is outside the frame
+     *         or the walk does not converge
+     */
+    int32_t locate(double x, double y);
+
+    /**
+     * Tests whether a point is an endpoint of a half-edge,
+     * up to the tolerance.
+     */
+    bool isVertexOfEdge(int32_t e, double x, double y) const;
+
+    /**
+     * Tests whether a point lies on a half-edge, exactly or up to the
+     * edge coincidence tolerance.
+     */
+    bool isOnEdge(int32_t e, double x, double y) const;
+
+    /**
+     * Connects a vertex to the corners of the triangle of a half-edge,
+     * splitting it in 3.
+     *
+     * @param e a half-edge of the triangle containing the vertex
+     * @param v the vertex
+     * @param opposite receives the 3 half-edges opposite to the vertex
+     */
+    void splitTriangle(int32_t e, int32_t v, std::vector<int32_t>& opposite);
+
+    /**
+     * Splits a half-edge and its twin at a vertex lying on them,
+     * turning their 2 triangles into 4.
+     *
+     * @param e a half-edge containing the vertex, which must have a twin
+     * @param v the vertex
+     * @param opposite receives the 4 half-edges opposite to the vertex
+     */
+    void splitEdge(int32_t e, int32_t v, std::vector<int32_t>& opposite);
+
+    /**
+     * Turns a half-edge and its twin counterclockwise inside the
+     * quadrilateral formed by their triangles.
+     *
+     * If the triangle of `e` is (a, b, c) and the one of its twin is
+     * (b, a, d), they become (d, c, a) and (c, d, b), keeping the
+     * positions of `e` and its twin.
+     *
+     * @param e a half-edge having a twin
+     */
+    void flip(int32_t e);
+
+    /**
+     * Visits each triangle, passing its first half-edge to the visitor.
+     * The triangles are visited in storage order.
+     *
+     * @param visitor a callable taking an `int32_t` half-edge
+     * @param includeFrame `true` to also visit the triangles having
+     *                     a frame vertex
+     */
+    template<typename TriangleVisitor>
+    void
+    visitTriangles(TriangleVisitor&& visitor, bool includeFrame) const
+    {
+        const int32_t n = static_cast<int32_t>(origins.size());
+        for(int32_t e = 0; e < n; e += 3) {
+            if(includeFrame || (!isFrameVertex(origins[static_cast<std::size_t>(e)])
+                                && !isFrameVertex(origins[static_cast<std::size_t>(e + 1)])
+                                && !isFrameVertex(origins[static_cast<std::size_t>(e + 2)]))) {
+                visitor(e);
+            }
+        }
+    }
+
+    /**
+     * Gets the triangles as triangular [Polygons](@ref geom::Polygon),
+     * in CCW order, excluding the frame triangles.
+     *
+     * @param geomFact the GeometryFactory to use
+     * @return a GeometryCollection of triangular polygons
+     */
+    std::unique_ptr<geom::GeometryCollection> getTriangles(const geom::GeometryFactory& geomFact) const;
+
+    /**
+     * Gets the triangles as an indexed mesh, excluding the frame
+     * triangles. The triangles are in the same order as in getTriangles().
+     *
+     * @param mesh the mesh to fill; existing contents are replaced
+     * @param includeNeighbours `true` to compute the triangle adjacency
+     */
+    void getTriangleMesh(TriangleMesh& mesh, bool includeNeighbours) const;
+
+    /**
+     * Copies the triangulation into a {@link QuadEdgeSubdivision}.
+     *
+     * @return a subdivision holding the same triangles
+     */
+    std::unique_ptr<QuadEdgeSubdivision> toQuadEdgeSubdivision() const;
+
+private:
+    // Declare type as noncopyable
+    HalfEdgeSubdivision(const HalfEdgeSubdivision& other) = delete;
+    HalfEdgeSubdivision& operator=(const HalfEdgeSubdivision& rhs) = delete;
+};
+
+} //namespace geos.triangulate.quadedge
+} //namespace geos.triangulate
+} //namespace goes
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#endif //GEOS_TRIANGULATE_QUADEDGE_HALFEDGESUBDIVISION_H
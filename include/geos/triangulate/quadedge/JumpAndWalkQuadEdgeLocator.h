@@ -0,0 +1,65 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2021 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_TRIANGULATE_QUADEDGE_JUMPANDWALKQUADEDGELOCATOR_H
+#define GEOS_TRIANGULATE_QUADEDGE_JUMPANDWALKQUADEDGELOCATOR_H
+
+#include <geos/triangulate/quadedge/QuadEdge.h>
+#include <geos/triangulate/quadedge/QuadEdgeLocator.h>
+
+#include <cstddef>
+#include <random>
+
+namespace geos {
+namespace triangulate { //geos.triangulate
+namespace quadedge { //geos.triangulate.quadedge
+
+//fwd declarations
+class QuadEdgeSubdivision;
+
+/** \brief
+ * Locates {@link QuadEdge}s in a {@link QuadEdgeSubdivision} using the
+ * jump-and-walk strategy of Mucke, Saias and Zhu.
+ *
+ * Before walking, a random sample of about the cube root of the number
+ * of edges is taken, and the walk starts from the sampled edge (or the
+ * last located edge) whose origin is closest to the vertex. The expected
+ * walk length is then independent of the order in which vertices are
+ * located, so this locator suits sites which are not inserted in a
+ * spatially coherent order.
+ */
+class GEOS_DLL JumpAndWalkQuadEdgeLocator : public QuadEdgeLocator {
+private:
+    QuadEdgeSubdivision* subdiv;
+    QuadEdge* lastEdge;
+    std::minstd_rand rng;
+
+public:
+    JumpAndWalkQuadEdgeLocator(QuadEdgeSubdivision* subdiv);
+
+    /**
+     * Locates an edge e, such that either v is on e, or e is an edge of a triangle containing v.
+     * @return The caller _does not_ take ownership of the returned object.
+     */
+    QuadEdge* locate(const Vertex& v) override;
+
+private:
+    static std::size_t sampleSize(std::size_t numEdges);
+};
+
+} //namespace geos.triangulate.quadedge
+} //namespace geos.triangulate
+} //namespace goes
+
+#endif //  GEOS_TRIANGULATE_QUADEDGE_JUMPANDWALKQUADEDGELOCATOR_H
@@ -21,6 +21,7 @@
 #define GEOS_TRIANGULATE_QUADEDGE_QUADEDGE_H
 
 #include <memory>
+#include <cstdint>
 
 #include <geos/triangulate/quadedge/Vertex.h>
 #include <geos/geom/LineSegment.h>
@@ -107,6 +108,9 @@ private:
 
     bool isAlive;
     bool visited;
+    bool constrained;
+
+    int32_t data;    // scratch value for algorithms, fits in the padding
 
     /**
      * Quadedges must be made using {@link QuadEdgeQuartet::makeEdge},
@@ -116,7 +120,9 @@ private:
         next(nullptr),
         num(_num),
         isAlive(true),
-        visited(false) {
+        visited(false),
+        constrained(false),
+        data(-1) {
     }
 
 public:
@@ -166,6 +172,50 @@ public:
         visited = v;
     }
 
+    /** \brief
+     * Tests whether this edge is a constraint of a constrained
+     * triangulation, which must not be swapped.
+     *
+     * @return `true` if this edge is constrained
+     */
+    inline bool
+    isConstrained() const
+    {
+        return constrained;
+    }
+
+    /** \brief
+     * Marks this edge and its `sym` as constrained or not.
+     *
+     * @param c `true` to mark the edge as constrained
+     */
+    inline void
+    setConstrained(bool c)
+    {
+        constrained = c;
+        sym().constrained = c;
+    }
+
+    /** \brief
+     * Gets the integer attached to this edge.
+     *
+     * Like the visited flag, this is scratch state for algorithms
+     * traversing the subdivision, such as the index of the origin
+     * vertex (or face, for a dual edge) when extracting a mesh.
+     *
+     * @return the value, -1 if none was set
+     */
+    inline int32_t
+    getData() const
+    {
+        return data;
+    }
+
+    inline void
+    setData(int32_t p_data) {
+        data = p_data;
+    }
+
     /** \brief
      * Sets the connected edge
      *
@@ -55,6 +55,12 @@ public:
         }
     }
 
+    void setData(int32_t data) {
+        for (auto& edge : e) {
+            edge.setData(data);
+        }
+    }
+
 private:
     std::array<QuadEdge, 4> e;
 };
@@ -49,6 +49,8 @@ namespace triangulate { //geos.triangulate
 namespace quadedge { //geos.triangulate.quadedge
 
 class TriangleVisitor;
+struct TriangleMesh;
+struct VoronoiCells;
 
 const double EDGE_COINCIDENCE_TOL_FACTOR = 1000;
 
@@ -147,6 +149,17 @@ public:
         return frameEnv;
     }
 
+    /** \brief
+     * Gets the vertices of the frame triangle, in CCW order.
+     *
+     * @return the frame vertices
+     */
+    inline const std::array<Vertex, 3>&
+    getFrameVertices() const
+    {
+        return frameVertex;
+    }
+
     /** \brief
      * Gets the collection of base {@link QuadEdge}s (one for every pair of
      * vertices which is connected).
@@ -159,6 +172,23 @@ public:
         return quadEdges;
     }
 
+    /** \brief
+     * Replaces the edges of this subdivision by copies of the live edges
+     * of a triangulation built in separate edge containers.
+     *
+     * The triangulation must have the frame triangle as its convex hull,
+     * so its vertices must include the frame vertices. The copies are
+     * relinked to each other, and the source containers can be discarded
+     * afterwards. The locator is reset to a LastFoundQuadEdgeLocator.
+     *
+     * @param edgeSets the containers holding the triangulation edges;
+     *                 the scratch data of their edges is overwritten
+     *
+     * @throws util::IllegalArgumentException if the frame edges are not
+     *         found, or there are too many edges
+     */
+    void setTriangulation(const std::vector<std::deque<QuadEdgeQuartet>*>& edgeSets);
+
     /** \brief
      * Sets the QuadEdgeLocator to use for locating containing triangles
      * in this subdivision.
@@ -391,6 +421,8 @@ private:
 private:
     class TriangleCoordinatesVisitor;
     class TriangleCircumcentreVisitor;
+    class TriangleMeshVisitor;
+    class TriangleNeighbourVisitor;
 
 public:
     /** \brief
@@ -415,6 +447,35 @@ public:
      */
     std::unique_ptr<geom::GeometryCollection> getTriangles(const geom::GeometryFactory& geomFact);
 
+    /** \brief
+     * Gets the triangles of a triangulated subdivision as an indexed mesh,
+     * without building any geometry.
+     *
+     * The frame triangles are not included. The triangles are in the same
+     * order as in getTriangles().
+     *
+     * @param mesh the mesh to fill; existing contents are replaced
+     * @param includeNeighbours `true` to compute the triangle adjacency
+     *
+     * @throws util::IllegalArgumentException if the subdivision is too
+     *         large for 32-bit indices
+     */
+    void getTriangleMesh(TriangleMesh& mesh, bool includeNeighbours);
+
+    /** \brief
+     * Gets the cells of the Voronoi diagram of this triangulation as flat
+     * coordinate runs, without building any geometry.
+     *
+     * Voronoi cells are convex, so they are clipped to the envelope
+     * directly, one half-plane at a time. Cells lying outside of the
+     * envelope are not included.
+     *
+     * @param cells the cells to fill; existing contents are replaced
+     * @param clipEnv the envelope to clip the cells to,
+     *                or `nullptr` for no clipping
+     */
+    void getVoronoiCells(VoronoiCells& cells, const geom::Envelope* clipEnv);
+
     /** \brief
      * Gets the cells in the Voronoi diagram for this triangulation.
      * The cells are returned as a [GeometryCollection](@ref geom::GeometryCollection)
@@ -0,0 +1,68 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2021 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_TRIANGULATE_QUADEDGE_TRIANGLEMESH_H
+#define GEOS_TRIANGULATE_QUADEDGE_TRIANGLEMESH_H
+
+#include <geos/export.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251) // warning C4251: needs to have dll-interface to be used by clients of class
+#endif
+
+namespace geos {
+namespace triangulate { //geos.triangulate
+namespace quadedge { //geos.triangulate.quadedge
+
+/** \brief
+ * The triangles of a {@link QuadEdgeSubdivision} as an indexed mesh.
+ *
+ * Vertices are stored once, as consecutive X, Y, Z triples (Z is NaN
+ * for 2D sites). Each triangle is a triple of vertex indices in CCW
+ * order. If neighbours are computed, `neighbours[3 * t + i]` is the
+ * index of the triangle sharing the edge from vertex `i` to vertex
+ * `(i + 1) % 3` of triangle `t`, or -1 on the convex hull.
+ */
+struct GEOS_DLL TriangleMesh {
+    std::vector<double> vertices;
+    std::vector<int32_t> triangles;
+    std::vector<int32_t> neighbours;
+
+    std::size_t
+    getNumVertices() const
+    {
+        return vertices.size() / 3;
+    }
+
+    std::size_t
+    getNumTriangles() const
+    {
+        return triangles.size() / 3;
+    }
+};
+
+} //namespace geos.triangulate.quadedge
+} //namespace geos.triangulate
+} //namespace goes
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#endif // GEOS_TRIANGULATE_QUADEDGE_TRIANGLEMESH_H
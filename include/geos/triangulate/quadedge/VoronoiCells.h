@@ -0,0 +1,70 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2021 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_TRIANGULATE_QUADEDGE_VORONOICELLS_H
+#define GEOS_TRIANGULATE_QUADEDGE_VORONOICELLS_H
+
+#include <geos/export.h>
+
+#include <cstddef>
+#include <vector>
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251) // warning C4251: needs to have dll-interface to be used by clients of class
+#endif
+
+namespace geos {
+namespace triangulate { //geos.triangulate
+namespace quadedge { //geos.triangulate.quadedge
+
+/** \brief
+ * The cells of a Voronoi diagram as flat coordinate runs.
+ *
+ * `sites` holds the X, Y of the site of each cell. The vertices of all
+ * cells are stored one cell after the other in `vertices`, as X, Y
+ * pairs: cell `i` has the vertices `offsets[i]` to `offsets[i + 1] - 1`,
+ * in CCW order, without repeating the first vertex at the end.
+ *
+ * `siteIndices`, when filled by VoronoiDiagramBuilder, holds the index
+ * of the site of each cell in the input coordinates.
+ */
+struct GEOS_DLL VoronoiCells {
+    std::vector<double> sites;
+    std::vector<double> vertices;
+    std::vector<std::size_t> offsets;
+    std::vector<std::size_t> siteIndices;
+
+    std::size_t
+    getNumCells() const
+    {
+        return sites.size() / 2;
+    }
+
+    std::size_t
+    getNumCellVertices(std::size_t cell) const
+    {
+        return offsets[cell + 1] - offsets[cell];
+    }
+};
+
+} //namespace geos.triangulate.quadedge
+} //namespace geos.triangulate
+} //namespace goes
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#endif // GEOS_TRIANGULATE_QUADEDGE_VORONOICELLS_H
@@ -0,0 +1,108 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2021 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_UTIL_CHUNKEDRANGE_H
+#define GEOS_UTIL_CHUNKEDRANGE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace geos {
+namespace util { // geos.util
+
+/** \brief
+ * Splits the range [0, n) into contiguous chunks of nearly equal size,
+ * computed by one thread each.
+ *
+ * Used by the multithreaded modes of the algorithms. There are at most
+ * as many chunks as threads, and no more than one chunk per
+ * `minChunkSize` items, so that each thread has enough work to pay
+ * for its start. There is always at least one chunk.
+ */
+class ChunkedRange {
+public:
+
+    /**
+     * @param p_n the size of the range
+     * @param minChunkSize the fewest items worth a thread
+     * @param numThreads the maximum number of threads
+     */
+    ChunkedRange(std::size_t p_n, std::size_t minChunkSize, std::size_t numThreads)
+        : n(p_n)
+        , numChunks(std::max<std::size_t>(1,
+                    std::min(numThreads, (p_n + minChunkSize - 1) / minChunkSize)))
+    {}
+
+    std::size_t
+    getNumChunks() const
+    {
+        return numChunks;
+    }
+
+    /// The first item of chunk c, or the end of the range for c == getNumChunks()
+    std::size_t
+    chunkBegin(std::size_t c) const
+    {
+        return n / numChunks * c + std::min(c, n % numChunks);
+    }
+
+    /**
+     * Calls f(c, begin, end) for each chunk c of items [begin, end),
+     * the first chunk on the calling thread and the others on threads
+     * of their own.
+     *
+     * Once all the chunks are done, rethrows the exception of the first
+     * chunk which threw one, if any.
+     */
+    template<typename F>
+    void
+    run(F&& f) const
+    {
+        std::vector<std::exception_ptr> errors(numChunks);
+        auto runChunk = [this, &f, &errors](std::size_t c) {
+            try {
+                f(c, chunkBegin(c), chunkBegin(c + 1));
+            }
+            catch(...) {
+                errors[c] = std::current_exception();
+            }
+        };
+
+        std::vector<std::thread> threads;
+        for(std::size_t c = 1; c < numChunks; c++) {
+            threads.emplace_back(runChunk, c);
+        }
+        runChunk(0);
+        for(std::thread& t : threads) {
+            t.join();
+        }
+        for(const std::exception_ptr& error : errors) {
+            if(error) {
+                std::rethrow_exception(error);
+            }
+        }
+    }
+
+private:
+    std::size_t n;
+    std::size_t numChunks;
+};
+
+} // namespace geos.util
+} // namespace geos
+
+#endif // GEOS_UTIL_CHUNKEDRANGE_H
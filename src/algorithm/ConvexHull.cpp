@@ -28,10 +28,19 @@
 #include <geos/geom/LineString.h>
 #include <geos/geom/CoordinateSequence.h>
 #include <geos/geom/CoordinateSequenceFactory.h>
+#include <geos/algorithm/CGAlgorithmsDD.h>
+#include <geos/geom/CoordinateArraySequence.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/PointSet.h>
+#include <geos/util/ChunkedRange.h>
+#include <geos/util/IllegalArgumentException.h>
 #include <geos/util/Interrupt.h>
+#include <geos/util.h>
 
 #include <typeinfo>
 #include <algorithm>
+#include <cmath>
+#include <limits>
 
 #ifndef GEOS_INLINE
 # include "geos/algorithm/ConvexHull.inl"
@@ -388,7 +397,288 @@ ConvexHull::cleanRing(const Coordinate::ConstVect& original,
 
 }
 
+namespace {
+
+/*
+ * The indices and key values of the extreme points of a range of
+ * points in 8 directions, in CCW order: E, NE, N, NW, W, SW, S, SE.
+ */
+struct OctExtremes {
+    double value[8];
+    std::size_t index[8];
+};
+
+inline void
+octKeys(double px, double py, double* key)
+{
+    key[0] = px;
+    key[1] = px + py;
+    key[2] = py;
+    key[3] = py - px;
+    key[4] = -px;
+    key[5] = -px - py;
+    key[6] = -py;
+    key[7] = px - py;
+}
+
+void
+findExtremes(const double* x, const double* y, std::size_t stride,
+             std::size_t begin, std::size_t end, OctExtremes& ext)
+{
+    const double inf = std::numeric_limits<double>::infinity();
+    for(std::size_t k = 0; k < 8; k++) {
+        ext.value[k] = -inf;
+        ext.index[k] = begin;
+    }
+
+    // The maxima of each block are found by branch-free loops, which
+    // vectorize. The block is scanned again for the index of a maximum
+    // only when it improves on the previous blocks, which is rare.
+    const std::size_t blockSize = 1024;
+    for(std::size_t b = begin; b < end; b += blockSize) {
+        const std::size_t e = std::min(b + blockSize, end);
+        double m0 = -inf, m1 = -inf, m2 = -inf, m3 = -inf;
+        double m4 = -inf, m5 = -inf, m6 = -inf, m7 = -inf;
+        for(std::size_t i = b; i < e; i++) {
+            const double px = x[i * stride];
+            const double py = y[i * stride];
+            m0 = std::max(m0, px);
+            m1 = std::max(m1, px + py);
+            m2 = std::max(m2, py);
+            m3 = std::max(m3, py - px);
+            m4 = std::max(m4, -px);
+            m5 = std::max(m5, -px - py);
+            m6 = std::max(m6, -py);
+            m7 = std::max(m7, px - py);
+        }
+
+        const double blockMax[8] = { m0, m1, m2, m3, m4, m5, m6, m7 };
+        for(std::size_t k = 0; k < 8; k++) {
+            if(!(blockMax[k] > ext.value[k])) {
+                continue;
+            }
+            ext.value[k] = blockMax[k];
+            double key[8];
+            for(std::size_t i = b; i < e; i++) {
+                octKeys(x[i * stride], y[i * stride], key);
+                if(key[k] == blockMax[k]) {
+                    ext.index[k] = i;
+                    break;
+                }
+            }
+        }
+    }
+}
+
+/*
+ * Tests whether a point is certainly strictly to the left of a line,
+ * with the error bound of CGAlgorithmsDD::orientationIndexFilter.
+ */
+inline bool
+isCertainlyLeft(double ax, double ay, double bx, double by, double px, double py)
+{
+    const double detLeft = (ax - px) * (by - py);
+    const double detRight = (ay - py) * (bx - px);
+    return detLeft - detRight > 1e-15 * (std::fabs(detLeft) + std::fabs(detRight));
+}
+
+/*
+ * Keeps the points of a range which are not strictly inside a convex
+ * polygon given in CCW order, skipping points with NaN ordinates.
+ */
+void
+filterPoints(const double* x, const double* y, std::size_t stride,
+             std::size_t begin, std::size_t end,
+             const std::vector<double>& polyX, const std::vector<double>& polyY,
+             std::vector<std::size_t>& kept)
+{
+    const std::size_t m = polyX.size();
+    for(std::size_t i = begin; i < end; i++) {
+        const double px = x[i * stride];
+        const double py = y[i * stride];
+        if(std::isnan(px) || std::isnan(py)) {
+            continue;
+        }
+        bool isInside = m >= 3;
+        for(std::size_t k = 0; k < m && isInside; k++) {
+            const std::size_t k1 = k + 1 < m ? k + 1 : 0;
+            isInside = isCertainlyLeft(polyX[k], polyY[k], polyX[k1], polyY[k1], px, py);
+        }
+        if(!isInside) {
+            kept.push_back(i);
+        }
+    }
+}
+
+} // anonymous namespace
+
+/* public static */
+void
+ConvexHull::computeHull(const double* x, const double* y,
+                        std::size_t n, std::size_t stride,
+                        std::vector<std::size_t>& hull,
+                        std::size_t numThreads)
+{
+    hull.clear();
+    if(n == 0) {
+        return;
+    }
+    if(stride == 0) {
+        throw util::IllegalArgumentException("Point stride must be positive");
+    }
+
+    const util::ChunkedRange chunks(n, 1 << 16, numThreads);
+    const std::size_t numChunks = chunks.getNumChunks();
+
+    std::vector<OctExtremes> chunkExtremes(numChunks);
+    chunks.run([&](std::size_t c, std::size_t begin, std::size_t end) {
+        findExtremes(x, y, stride, begin, end, chunkExtremes[c]);
+    });
+
+    OctExtremes ext = chunkExtremes[0];
+    for(std::size_t c = 1; c < numChunks; c++) {
+        for(std::size_t k = 0; k < 8; k++) {
+            if(chunkExtremes[c].value[k] > ext.value[k]) {
+                ext.value[k] = chunkExtremes[c].value[k];
+                ext.index[k] = chunkExtremes[c].index[k];
+            }
+        }
+    }
+
+    // the polygon of the extreme points, which is inside the hull
+    std::vector<double> polyX;
+    std::vector<double> polyY;
+    if(ext.value[0] > -std::numeric_limits<double>::infinity()) {
+        for(std::size_t k = 0; k < 8; k++) {
+            const double px = x[ext.index[k] * stride];
+            const double py = y[ext.index[k] * stride];
+            if(polyX.empty() || px != polyX.back() || py != polyY.back()) {
+                polyX.push_back(px);
+                polyY.push_back(py);
+            }
+        }
+        while(polyX.size() > 1 && polyX.front() == polyX.back() && polyY.front() == polyY.back()) {
+            polyX.pop_back();
+            polyY.pop_back();
+        }
+    }
+
+    GEOS_CHECK_FOR_INTERRUPTS();
+
+    std::vector<std::vector<std::size_t>> chunkPts(numChunks);
+    chunks.run([&](std::size_t c, std::size_t begin, std::size_t end) {
+        filterPoints(x, y, stride, begin, end, polyX, polyY, chunkPts[c]);
+    });
+
+    std::vector<std::size_t> pts;
+    for(std::vector<std::size_t>& kept : chunkPts) {
+        pts.insert(pts.end(), kept.begin(), kept.end());
+        std::vector<std::size_t>().swap(kept);
+    }
+
+    GEOS_CHECK_FOR_INTERRUPTS();
+
+    // monotone chain over the remaining points
+    auto lessXY = [x, y, stride](std::size_t a, std::size_t b) {
+        const double ax = x[a * stride];
+        const double bx = x[b * stride];
+        return ax < bx || (ax == bx && y[a * stride] < y[b * stride]);
+    };
+    auto equalsXY = [x, y, stride](std::size_t a, std::size_t b) {
+        return x[a * stride] == x[b * stride] && y[a * stride] == y[b * stride];
+    };
+    std::sort(pts.begin(), pts.end(), lessXY);
+    pts.erase(std::unique(pts.begin(), pts.end(), equalsXY), pts.end());
+
+    if(pts.size() <= 2) {
+        hull = pts;
+        return;
+    }
+
+    auto isLeftTurn = [x, y, stride](std::size_t a, std::size_t b, std::size_t c) {
+        return CGAlgorithmsDD::orientationIndex(x[a * stride], y[a * stride],
+                                                x[b * stride], y[b * stride],
+                                                x[c * stride], y[c * stride]) > 0;
+    };
+
+    for(std::size_t p : pts) {
+        while(hull.size() >= 2 && !isLeftTurn(hull[hull.size() - 2], hull.back(), p)) {
+            hull.pop_back();
+        }
+        hull.push_back(p);
+    }
+    const std::size_t lowerSize = hull.size();
+    for(std::size_t i = pts.size() - 1; i-- > 0;) {
+        const std::size_t p = pts[i];
+        while(hull.size() > lowerSize && !isLeftTurn(hull[hull.size() - 2], hull.back(), p)) {
+            hull.pop_back();
+        }
+        hull.push_back(p);
+    }
+    // the upper chain ends on the first point
+    hull.pop_back();
+}
+
+/* public static */
+void
+ConvexHull::computeHull(const PointSet& pts, std::vector<std::size_t>& hull,
+                        std::size_t numThreads)
+{
+    computeHull(pts.getXData(), pts.getYData(), pts.size(), pts.getStride(), hull, numThreads);
+}
+
+/* public static */
+std::unique_ptr<Geometry>
+ConvexHull::getConvexHull(const double* x, const double* y,
+                          std::size_t n, std::size_t stride,
+                          const GeometryFactory& geomFact,
+                          std::size_t numThreads)
+{
+    return getConvexHull(PointSet(x, y, n, stride), geomFact, numThreads);
+}
+
+/* public static */
+std::unique_ptr<Geometry>
+ConvexHull::getConvexHull(const PointSet& pts, const GeometryFactory& geomFact,
+                          std::size_t numThreads)
+{
+    std::vector<std::size_t> hull;
+    computeHull(pts, hull, numThreads);
+
+    const std::size_t m = hull.size();
+    if(m == 0) {
+        return geomFact.createEmptyGeometry();
+    }
+    if(m == 1) {
+        return std::unique_ptr<Geometry>(geomFact.createPoint(pts.getCoordinate(hull[0])));
+    }
+
+    const std::size_t dim = pts.hasZ() ? 3 : 2;
+    std::vector<Coordinate> coords;
+    if(m == 2) {
+        coords.push_back(pts.getCoordinate(hull[0]));
+        coords.push_back(pts.getCoordinate(hull[1]));
+        return geomFact.createLineString(
+                   detail::make_unique<CoordinateArraySequence>(std::move(coords), dim));
+    }
+
+    // clockwise from the lowest point, as the Graham scan gives it
+    std::size_t start = 0;
+    for(std::size_t i = 1; i < m; i++) {
+        const double yi = pts.getY(hull[i]);
+        const double ys = pts.getY(hull[start]);
+        if(yi < ys || (yi == ys && pts.getX(hull[i]) < pts.getX(hull[start]))) {
+            start = i;
+        }
+    }
+    coords.reserve(m + 1);
+    for(std::size_t k = 0; k <= m; k++) {
+        coords.push_back(pts.getCoordinate(hull[(start + m - k % m) % m]));
+    }
+    auto shell = geomFact.createLinearRing(
+                     detail::make_unique<CoordinateArraySequence>(std::move(coords), dim));
+    return geomFact.createPolygon(std::move(shell));
+}
 
 } // namespace geos.algorithm
 } // namespace geos
-
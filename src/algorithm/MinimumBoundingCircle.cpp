@@ -19,6 +19,7 @@
  **********************************************************************/
 
 #include <geos/algorithm/Angle.h>
+#include <geos/algorithm/ConvexHull.h>
 #include <geos/algorithm/MinimumBoundingCircle.h>
 #include <geos/geom/Coordinate.h>
 #include <geos/geom/CoordinateSequenceFactory.h>
@@ -50,9 +51,9 @@ MinimumBoundingCircle::getCircle()
 
     compute();
     if(centre.isNull()) {
-        return std::unique_ptr<Geometry>(input->getFactory()->createPolygon());
+        return std::unique_ptr<Geometry>(geomFactory->createPolygon());
     }
-    std::unique_ptr<Geometry> centrePoint(input->getFactory()->createPoint(centre));
+    std::unique_ptr<Geometry> centrePoint(geomFactory->createPoint(centre));
     if(radius == 0.0) {
         return centrePoint;
     }
@@ -64,25 +65,25 @@ std::unique_ptr<Geometry>
 MinimumBoundingCircle::getMaximumDiameter()
 {
     compute();
-    uint8_t dims = input->getCoordinateDimension();
+    uint8_t dims = getCoordinateDimension();
     std::size_t len = 2;
     switch(extremalPts.size()) {
         case 0:
-            return input->getFactory()->createLineString();
+            return geomFactory->createLineString();
         case 1:
-            return std::unique_ptr<Geometry>(input->getFactory()->createPoint(centre));
+            return std::unique_ptr<Geometry>(geomFactory->createPoint(centre));
         case 2: {
-            auto cs = input->getFactory()->getCoordinateSequenceFactory()->create(len, dims);
+            auto cs = geomFactory->getCoordinateSequenceFactory()->create(len, dims);
             cs->setAt(extremalPts.front(), 0);
             cs->setAt(extremalPts.back(), 1);
-            return input->getFactory()->createLineString(std::move(cs));
+            return geomFactory->createLineString(std::move(cs));
         }
         default: {
             std::vector<Coordinate> fp = farthestPoints(extremalPts);
-            auto cs = input->getFactory()->getCoordinateSequenceFactory()->create(len, dims);
+            auto cs = geomFactory->getCoordinateSequenceFactory()->create(len, dims);
             cs->setAt(fp.front(), 0);
             cs->setAt(fp.back(), 1);
-            return input->getFactory()->createLineString(std::move(cs));
+            return geomFactory->createLineString(std::move(cs));
         }
     }
 
@@ -118,18 +119,18 @@ MinimumBoundingCircle::getDiameter()
     compute();
     switch(extremalPts.size()) {
     case 0:
-        return input->getFactory()->createLineString();
+        return geomFactory->createLineString();
     case 1:
-        return std::unique_ptr<Geometry>(input->getFactory()->createPoint(centre));
+        return std::unique_ptr<Geometry>(geomFactory->createPoint(centre));
     }
-    uint8_t dims = input->getCoordinateDimension();
+    uint8_t dims = getCoordinateDimension();
     std::size_t len = 2;
-    auto cs = input->getFactory()->getCoordinateSequenceFactory()->create(len, dims);
+    auto cs = geomFactory->getCoordinateSequenceFactory()->create(len, dims);
     // TODO: handle case of 3 extremal points, by computing a line from one of
     // them through the centre point with len = 2*radius
     cs->setAt(extremalPts[0], 0);
     cs->setAt(extremalPts[1], 1);
-    return input->getFactory()->createLineString(std::move(cs));
+    return geomFactory->createLineString(std::move(cs));
 }
 
 
@@ -203,16 +204,38 @@ MinimumBoundingCircle::compute()
 }
 
 /*private*/
-void
-MinimumBoundingCircle::computeCirclePoints()
+uint8_t
+MinimumBoundingCircle::getCoordinateDimension() const
 {
+    if(input) {
+        return input->getCoordinateDimension();
+    }
+    return inputPts.hasZ() ? 3 : 2;
+}
+
+/*private*/
+std::vector<Coordinate>
+MinimumBoundingCircle::hullPoints()
+{
+    std::vector<Coordinate> pts;
+    if(!input) {
+        // the hull vertices of a point set are distinct
+        std::vector<std::size_t> hull;
+        ConvexHull::computeHull(inputPts, hull);
+        pts.reserve(hull.size());
+        for(std::size_t i : hull) {
+            pts.push_back(inputPts.getCoordinate(i));
+        }
+        return pts;
+    }
+
     // handle degenerate or trivial cases
     if(input->isEmpty()) {
-        return;
+        return pts;
     }
     if(input->getNumPoints() == 1) {
-        extremalPts.push_back(*(input->getCoordinate()));
-        return;
+        pts.push_back(*(input->getCoordinate()));
+        return pts;
     }
 
     /*
@@ -222,13 +245,20 @@ MinimumBoundingCircle::computeCirclePoints()
     std::unique_ptr<Geometry> convexHull(input->convexHull());
 
     std::unique_ptr<CoordinateSequence> cs(convexHull->getCoordinates());
-    std::vector<Coordinate> pts;
     cs->toVector(pts);
 
     // strip duplicate final point, if any
     if(pts.front().equals2D(pts.back())) {
         pts.pop_back();
     }
+    return pts;
+}
+
+/*private*/
+void
+MinimumBoundingCircle::computeCirclePoints()
+{
+    std::vector<Coordinate> pts = hullPoints();
 
     /*
      * Optimization for the trivial case where the CH has fewer than 3 points
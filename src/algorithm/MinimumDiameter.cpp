@@ -67,6 +67,7 @@ MinimumDiameter::MinimumDiameter(const Geometry* newInputGeom)
     minPtIndex = 0;
     minWidth = 0.0;
     inputGeom = newInputGeom;
+    geomFactory = newInputGeom->getFactory();
     isConvex = false;
     convexHullPts = nullptr;
 }
@@ -86,10 +87,29 @@ MinimumDiameter::MinimumDiameter(const Geometry* newInputGeom, const bool newIsC
     minWidthPt = Coordinate::getNull();
     minWidth = 0.0;
     inputGeom = newInputGeom;
+    geomFactory = newInputGeom->getFactory();
     isConvex = newIsConvex;
     convexHullPts = nullptr;
 }
 
+/**
+ * Compute a minimum diameter for points given as arrays of ordinates.
+ *
+ * @param pts the input points
+ * @param geomFact the factory of the output geometries
+ */
+MinimumDiameter::MinimumDiameter(const PointSet& pts, const GeometryFactory& geomFact)
+    : inputGeom(nullptr)
+    , inputPts(pts)
+    , geomFactory(&geomFact)
+    , isConvex(false)
+    , convexHullPts(nullptr)
+    , minPtIndex(0)
+    , minWidth(0.0)
+{
+    minWidthPt = Coordinate::getNull();
+}
+
 /**
  * Gets the length of the minimum diameter of the input Geometry
  *
@@ -123,8 +143,7 @@ std::unique_ptr<LineString>
 MinimumDiameter::getSupportingSegment()
 {
     computeMinimumDiameter();
-    const GeometryFactory* fact = inputGeom->getFactory();
-    return minBaseSeg.toGeometry(*fact);
+    return minBaseSeg.toGeometry(*geomFactory);
 }
 
 /**
@@ -138,16 +157,16 @@ MinimumDiameter::getDiameter()
     computeMinimumDiameter();
     // return empty linestring if no minimum width calculated
     if(minWidthPt.isNull()) {
-        return std::unique_ptr<LineString>(inputGeom->getFactory()->createLineString(nullptr));
+        return std::unique_ptr<LineString>(geomFactory->createLineString(nullptr));
     }
 
     Coordinate basePt;
     minBaseSeg.project(minWidthPt, basePt);
 
-    auto cl = inputGeom->getFactory()->getCoordinateSequenceFactory()->create(2);
+    auto cl = geomFactory->getCoordinateSequenceFactory()->create(2);
     cl->setAt(basePt, 0);
     cl->setAt(minWidthPt, 1);
-    return inputGeom->getFactory()->createLineString(std::move(cl));
+    return geomFactory->createLineString(std::move(cl));
 }
 
 /* private */
@@ -161,6 +180,10 @@ MinimumDiameter::computeMinimumDiameter()
     if(isConvex) {
         computeWidthConvex(inputGeom);
     }
+    else if(!inputGeom) {
+        std::unique_ptr<Geometry> convexGeom = ConvexHull::getConvexHull(inputPts, *geomFactory);
+        computeWidthConvex(convexGeom.get());
+    }
     else {
         ConvexHull ch(inputGeom);
         std::unique_ptr<Geometry> convexGeom = ch.getConvexHull();
@@ -270,15 +293,15 @@ MinimumDiameter::getMinimumRectangle()
 
     if(minWidthPt.isNull() || !convexHullPts) {
         //return empty polygon
-        return std::unique_ptr<Geometry>(inputGeom->getFactory()->createPolygon());
+        return std::unique_ptr<Geometry>(geomFactory->createPolygon());
     }
 
     // check if minimum rectangle is degenerate (a point or line segment)
     if(minWidth == 0.0) {
         if(minBaseSeg.p0.equals2D(minBaseSeg.p1)) {
-            return std::unique_ptr<Geometry>(inputGeom->getFactory()->createPoint(minBaseSeg.p0));
+            return std::unique_ptr<Geometry>(geomFactory->createPoint(minBaseSeg.p0));
         }
-        return minBaseSeg.toGeometry(*inputGeom->getFactory());
+        return minBaseSeg.toGeometry(*geomFactory);
     }
 
     // deltas for the base segment of the minimum diameter
@@ -324,7 +347,7 @@ MinimumDiameter::getMinimumRectangle()
     Coordinate p3 = maxParaLine.lineIntersection(minPerpLine);
 
     const CoordinateSequenceFactory* csf =
-        inputGeom->getFactory()->getCoordinateSequenceFactory();
+        geomFactory->getCoordinateSequenceFactory();
 
     auto seq = csf->create(5, 2);
     seq->setAt(p0, 0);
@@ -333,8 +356,8 @@ MinimumDiameter::getMinimumRectangle()
     seq->setAt(p3, 3);
     seq->setAt(p0, 4); // close
 
-    std::unique_ptr<LinearRing> shell = inputGeom->getFactory()->createLinearRing(std::move(seq));
-    return inputGeom->getFactory()->createPolygon(std::move(shell));
+    std::unique_ptr<LinearRing> shell = geomFactory->createLinearRing(std::move(seq));
+    return geomFactory->createPolygon(std::move(shell));
 }
 
 double
@@ -26,7 +26,7 @@
 #include <cassert>
 #include <vector>
 #include <algorithm>
-#include <iostream>
+#include <utility>
 using namespace geos::geom;
 
 namespace geos {
@@ -81,38 +81,26 @@ DiscreteFrechetDistance::getSegementAt(const CoordinateSequence& seq, std::size_
     }
 }
 
-PointPairDistance&
-DiscreteFrechetDistance::getFrecheDistance(std::vector< std::vector<PointPairDistance> >& ca, std::size_t i, std::size_t j,
-        const CoordinateSequence& p, const CoordinateSequence& q)
+std::vector<geom::Coordinate>
+DiscreteFrechetDistance::getDiscretePoints(const geom::Geometry& g)
 {
-    PointPairDistance p_ptDist;
-    if(! ca[i][j].getIsNull()) {
-        return ca[i][j];
+    auto seq = g.getCoordinates();
+    if(seq->isEmpty()) {
+        throw util::IllegalArgumentException("DiscreteFrechetDistance called with empty inputs.");
     }
-    p_ptDist.initialize(getSegementAt(p, i), getSegementAt(q, j));
-    if(i == 0 && j == 0) {
-        ca[i][j] = ptDist;
-    }
-    else if(i > 0 && j == 0) {
-        PointPairDistance nextDist = getFrecheDistance(ca, i - 1, 0, p, q);
-        ca[i][j] = (nextDist.getDistance() > p_ptDist.getDistance()) ? nextDist : p_ptDist;
-    }
-    else if(i == 0 && j > 0) {
-        PointPairDistance nextDist = getFrecheDistance(ca, 0, j - 1, p, q);
-        ca[i][j] = (nextDist.getDistance() > p_ptDist.getDistance()) ? nextDist : p_ptDist;
-    }
-    else {
-        PointPairDistance d1 = getFrecheDistance(ca, i - 1, j, p, q),
-                          d2 = getFrecheDistance(ca, i - 1, j - 1, p, q),
-                          d3 = getFrecheDistance(ca, i, j - 1, p, q);
-        PointPairDistance& minDist = (d1.getDistance() < d2.getDistance()) ? d1 : d2;
-        if(d3.getDistance() < minDist.getDistance()) {
-            minDist = d3;
-        }
-        ca[i][j] = (minDist.getDistance() > p_ptDist.getDistance()) ? minDist : p_ptDist;
+
+    std::size_t size = seq->size();
+    if(densifyFrac > 0) {
+        std::size_t numSubSegs =  std::size_t(util::round(1.0 / densifyFrac));
+        size = numSubSegs * (seq->size() - 1) + 1;
     }
 
-    return ca[i][j];
+    std::vector<geom::Coordinate> pts;
+    pts.reserve(size);
+    for(std::size_t i = 0; i < size; i++) {
+        pts.push_back(getSegementAt(*seq, i));
+    }
+    return pts;
 }
 
 void
@@ -120,25 +108,127 @@ DiscreteFrechetDistance::compute(
     const geom::Geometry& discreteGeom,
     const geom::Geometry& geom)
 {
-    auto lp = discreteGeom.getCoordinates();
-    auto lq = geom.getCoordinates();
-    std::size_t pSize, qSize;
-    if(densifyFrac > 0) {
-        std::size_t numSubSegs =  std::size_t(util::round(1.0 / densifyFrac));
-        pSize = numSubSegs * (lp->size() - 1) + 1;
-        qSize = numSubSegs * (lq->size() - 1) + 1;
+    std::vector<Coordinate> p = getDiscretePoints(discreteGeom);
+    std::vector<Coordinate> q = getDiscretePoints(geom);
+
+    /*
+     * The coupling distance of a pair of points is the larger of their
+     * distance and the smallest coupling distance of the pairs preceding
+     * them. A coupling is recorded as the squared distance of the pair
+     * which determines it, and the indexes of that pair.
+     * Only the previous row is needed to compute a row.
+     */
+    struct Coupling {
+        double distSq;
+        std::size_t i;
+        std::size_t j;
+    };
+    std::vector<Coupling> prev(q.size());
+    std::vector<Coupling> curr(q.size());
+
+    for(std::size_t i = 0; i < p.size(); i++) {
+        for(std::size_t j = 0; j < q.size(); j++) {
+            const Coupling* minPrev = nullptr;
+            if(i > 0) {
+                minPrev = &prev[j];
+                if(j > 0 && prev[j - 1].distSq < minPrev->distSq) {
+                    minPrev = &prev[j - 1];
+                }
+            }
+            if(j > 0 && (minPrev == nullptr || curr[j - 1].distSq < minPrev->distSq)) {
+                minPrev = &curr[j - 1];
+            }
+
+            double distSq = p[i].distanceSquared(q[j]);
+            if(minPrev != nullptr && minPrev->distSq > distSq) {
+                curr[j] = *minPrev;
+            }
+            else {
+                curr[j] = { distSq, i, j };
+            }
+        }
+        std::swap(prev, curr);
     }
-    else {
-        pSize = lp->size();
-        qSize = lq->size();
+
+    const Coupling& coupling = prev.back();
+    ptDist.initialize(p[coupling.i], q[coupling.j]);
+}
+
+bool
+DiscreteFrechetDistance::isWithinDistance(double maxDistance)
+{
+    std::vector<Coordinate> p = getDiscretePoints(g0);
+    std::vector<Coordinate> q = getDiscretePoints(g1);
+
+    // every coupling includes the first and the last pairs
+    if(p.front().distance(q.front()) > maxDistance ||
+            p.back().distance(q.back()) > maxDistance) {
+        return false;
     }
-    std::vector< std::vector<PointPairDistance> > ca(pSize, std::vector<PointPairDistance>(qSize));
-    for(std::size_t i = 0; i < pSize; i++) {
-        for(std::size_t j = 0; j < qSize; j++) {
-            ca[i][j].initialize();
+
+    /*
+     * A pair is reachable if its points are within maxDistance and a
+     * preceding pair is reachable. The reachable pairs of a row lie
+     * between the first reachable pair of the previous row and the end
+     * of the run of pairs following its last one, so only that band is
+     * swept, and the sweep stops when a row has no reachable pair.
+     */
+    std::vector<char> prev(q.size());
+    std::vector<char> curr(q.size());
+
+    std::size_t prevLo = 0;
+    std::size_t prevHi = 0;
+    for(std::size_t j = 0; j < q.size() && p[0].distance(q[j]) <= maxDistance; j++) {
+        prev[j] = true;
+        prevHi = j;
+    }
+
+    for(std::size_t i = 1; i < p.size(); i++) {
+        bool found = false;
+        std::size_t lo = 0;
+        std::size_t hi = 0;
+        bool left = false;
+        for(std::size_t j = prevLo; j < q.size(); j++) {
+            bool above = j <= prevHi && prev[j];
+            bool diagonal = j > prevLo && j - 1 <= prevHi && prev[j - 1];
+            if(!above && !diagonal && !left) {
+                if(j > prevHi) {
+                    break;
+                }
+                curr[j] = false;
+                continue;
+            }
+
+            bool reachable = p[i].distance(q[j]) <= maxDistance;
+            curr[j] = reachable;
+            if(reachable) {
+                if(!found) {
+                    lo = j;
+                    found = true;
+                }
+                hi = j;
+            }
+            left = reachable;
+        }
+        if(!found) {
+            return false;
         }
+        std::swap(prev, curr);
+        prevLo = lo;
+        prevHi = hi;
     }
-    ptDist = getFrecheDistance(ca, pSize - 1, qSize - 1, *lp, *lq);
+
+    return prevHi == q.size() - 1;
+}
+
+/* static public */
+bool
+DiscreteFrechetDistance::isWithinDistance(const geom::Geometry& g0,
+        const geom::Geometry& g1,
+        double maxDistance)
+{
+    DiscreteFrechetDistance dist(g0, g1);
+    return dist.isWithinDistance(maxDistance);
 }
 
 } // namespace geos.algorithm.distance
@@ -17,17 +17,104 @@
  **********************************************************************/
 
 #include <geos/algorithm/distance/DiscreteHausdorffDistance.h>
+#include <geos/geom/CoordinateArraySequence.h>
 #include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/LineSegment.h>
+#include <geos/operation/distance/FacetSequence.h>
+#include <geos/operation/distance/FacetSequenceTreeBuilder.h>
+#include <geos/util/ChunkedRange.h>
 
+#include <algorithm>
+#include <atomic>
 #include <typeinfo>
+#include <utility>
 #include <cassert>
 
 using namespace geos::geom;
+using geos::operation::distance::FacetSequence;
+using geos::operation::distance::FacetSequenceTreeBuilder;
 
 namespace geos {
 namespace algorithm { // geos.algorithm
 namespace distance { // geos.algorithm.distance
 
+namespace {
+
+// Number of points of the geometry measured against from which
+// indexing its facets is cheaper than scanning all its segments
+const std::size_t INDEX_MIN_POINTS = 32;
+
+class VertexCollector : public geom::CoordinateFilter {
+public:
+    VertexCollector(std::vector<const Coordinate*>& p_vertices)
+        : vertices(p_vertices)
+    {}
+
+    void
+    filter_ro(const Coordinate* pt) override
+    {
+        vertices.push_back(pt);
+    }
+
+private:
+    std::vector<const Coordinate*>& vertices;
+};
+
+class SegmentCollector : public geom::CoordinateSequenceFilter {
+public:
+    SegmentCollector(std::vector<std::pair<const Coordinate*, const Coordinate*>>& p_segments)
+        : segments(p_segments)
+    {}
+
+    void
+    filter_ro(const CoordinateSequence& seq, std::size_t index) override
+    {
+        // this also skips Point geometries
+        if(index > 0) {
+            segments.emplace_back(&seq.getAt(index - 1), &seq.getAt(index));
+        }
+    }
+
+    bool
+    isGeometryChanged() const override
+    {
+        return false;
+    }
+
+    bool
+    isDone() const override
+    {
+        return false;
+    }
+
+private:
+    std::vector<std::pair<const Coordinate*, const Coordinate*>>& segments;
+};
+
+/*
+ * Calls computeRange(begin, end, rangeMax) on chunks of [0, n), on up
+ * to numThreads threads, and merges the maxima of the chunks in order.
+ */
+template<typename F>
+void
+computeChunks(std::size_t n, std::size_t minChunkSize, std::size_t numThreads,
+              PointPairDistance& ptDist, F computeRange)
+{
+    const util::ChunkedRange chunks(n, minChunkSize, numThreads);
+    std::vector<PointPairDistance> chunkMax(chunks.getNumChunks());
+    chunks.run([&](std::size_t c, std::size_t begin, std::size_t end) {
+        computeRange(begin, end, chunkMax[c]);
+    });
+
+    for(PointPairDistance& max : chunkMax) {
+        if(!max.getIsNull()) {
+            ptDist.setMaximum(max);
+        }
+    }
+}
+
+} // anonymous namespace
+
 void
 DiscreteHausdorffDistance::MaxDensifiedByFractionDistanceFilter::filter_ro(
     const geom::CoordinateSequence& seq, std::size_t index)
@@ -83,6 +170,11 @@ DiscreteHausdorffDistance::computeOrientedDistance(
     const geom::Geometry& geom,
     PointPairDistance& p_ptDist)
 {
+    if(geom.getNumPoints() >= INDEX_MIN_POINTS) {
+        computeOrientedDistanceIndexed(discreteGeom, geom, p_ptDist);
+        return;
+    }
+
     MaxPointDistanceFilter distFilter(geom);
     discreteGeom.apply_ro(&distFilter);
     p_ptDist.setMaximum(distFilter.getMaxPointDistance());
@@ -95,6 +187,95 @@ DiscreteHausdorffDistance::computeOrientedDistance(
     }
 }
 
+/* private */
+void
+DiscreteHausdorffDistance::computeOrientedDistanceIndexed(
+    const geom::Geometry& discreteGeom,
+    const geom::Geometry& geom,
+    PointPairDistance& p_ptDist)
+{
+    std::unique_ptr<FacetSequenceTreeBuilder::FacetSequenceTree> tree =
+        FacetSequenceTreeBuilder::build(&geom);
+
+    std::vector<const Coordinate*> vertices;
+    VertexCollector vertexCollector(vertices);
+    discreteGeom.apply_ro(&vertexCollector);
+
+    std::vector<std::pair<const Coordinate*, const Coordinate*>> segments;
+    std::size_t numSubSegs = 0;
+    if(densifyFrac > 0) {
+        SegmentCollector segmentCollector(segments);
+        discreteGeom.apply_ro(segmentCollector);
+        numSubSegs = std::size_t(util::round(1.0 / densifyFrac));
+    }
+
+    // the maximum found so far, shared by the threads to stop their
+    // searches early
+    std::atomic<double> maxDist(p_ptDist.getIsNull() ? -1.0 : p_ptDist.getDistance());
+
+    // raises rangeMax to the distance from pt to geom, unless pt is
+    // no farther than the maximum found so far
+    auto update = [&](const Coordinate& pt, CoordinateArraySequence& ptSeq,
+    PointPairDistance & rangeMax) {
+        ptSeq.setAt(pt, 0);
+        FacetSequence pointFacet(&ptSeq, 0, 1);
+        double dist;
+        const FacetSequence* nearest = tree->nearestFacet(pointFacet, maxDist.load(), dist);
+        if(nearest == nullptr || dist <= maxDist.load()) {
+            return;
+        }
+
+        // the search was not stopped, so the facet is the nearest one
+        PointPairDistance minPtDist;
+        if(nearest->isPoint()) {
+            minPtDist.setMinimum(*nearest->getCoordinate(0), pt);
+        }
+        else {
+            Coordinate closestPt;
+            for(std::size_t i = 0; i + 1 < nearest->size(); i++) {
+                LineSegment seg(*nearest->getCoordinate(i), *nearest->getCoordinate(i + 1));
+                seg.closestPoint(pt, closestPt);
+                minPtDist.setMinimum(closestPt, pt);
+            }
+        }
+        rangeMax.setMaximum(minPtDist);
+
+        double current = maxDist.load();
+        while(dist > current && !maxDist.compare_exchange_weak(current, dist)) {}
+    };
+
+    // about a thousand nearest facet searches are worth a thread
+    const std::size_t minChunkSize = 1 << 10;
+
+    computeChunks(vertices.size(), minChunkSize, numThreads, p_ptDist,
+    [&](std::size_t begin, std::size_t end, PointPairDistance & rangeMax) {
+        CoordinateArraySequence ptSeq(1u, 2u);
+        for(std::size_t i = begin; i < end; i++) {
+            update(*vertices[i], ptSeq, rangeMax);
+        }
+    });
+
+    if(numSubSegs == 0) {
+        return;
+    }
+    computeChunks(segments.size(), std::max<std::size_t>(1, minChunkSize / numSubSegs),
+                  numThreads, p_ptDist,
+    [&](std::size_t begin, std::size_t end, PointPairDistance & rangeMax) {
+        CoordinateArraySequence ptSeq(1u, 2u);
+        for(std::size_t i = begin; i < end; i++) {
+            const Coordinate& p0 = *segments[i].first;
+            const Coordinate& p1 = *segments[i].second;
+            double delx = (p1.x - p0.x) / static_cast<double>(numSubSegs);
+            double dely = (p1.y - p0.y) / static_cast<double>(numSubSegs);
+            for(std::size_t j = 0; j < numSubSegs; ++j) {
+                double x = p0.x + static_cast<double>(j) * delx;
+                double y = p0.y + static_cast<double>(j) * dely;
+                update(Coordinate(x, y), ptSeq, rangeMax);
+            }
+        }
+    });
+}
+
 } // namespace geos.algorithm.distance
 } // namespace geos.algorithm
 } // namespace geos
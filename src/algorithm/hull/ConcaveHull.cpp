@@ -0,0 +1,316 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2021 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/algorithm/hull/ConcaveHull.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateArraySequence.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/Polygon.h>
+#include <geos/triangulate/DelaunayTriangulationBuilder.h>
+#include <geos/triangulate/quadedge/TriangleMesh.h>
+#include <geos/util/IllegalArgumentException.h>
+#include <geos/util.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <queue>
+#include <utility>
+
+using namespace geos::geom;
+using geos::triangulate::DelaunayTriangulationBuilder;
+using geos::triangulate::quadedge::TriangleMesh;
+
+namespace geos {
+namespace algorithm { // geos.algorithm
+namespace hull { // geos.algorithm.hull
+
+namespace {
+
+/*
+ * Navigates the triangles of a mesh as they are removed from the hull.
+ */
+class HullMesh {
+public:
+    const TriangleMesh& mesh;
+    const std::vector<bool>& isRemoved;
+
+    HullMesh(const TriangleMesh& p_mesh, const std::vector<bool>& p_isRemoved)
+        : mesh(p_mesh)
+        , isRemoved(p_isRemoved)
+    {}
+
+    int32_t
+    vertex(std::size_t t, std::size_t i) const
+    {
+        return mesh.triangles[3 * t + i % 3];
+    }
+
+    double
+    edgeLength(std::size_t t, std::size_t i) const
+    {
+        std::size_t a = static_cast<std::size_t>(vertex(t, i));
+        std::size_t b = static_cast<std::size_t>(vertex(t, i + 1));
+        return std::hypot(mesh.vertices[3 * a] - mesh.vertices[3 * b],
+                          mesh.vertices[3 * a + 1] - mesh.vertices[3 * b + 1]);
+    }
+
+    double
+    circumradius(std::size_t t) const
+    {
+        std::size_t a = static_cast<std::size_t>(vertex(t, 0));
+        std::size_t b = static_cast<std::size_t>(vertex(t, 1));
+        std::size_t c = static_cast<std::size_t>(vertex(t, 2));
+        double abx = mesh.vertices[3 * b] - mesh.vertices[3 * a];
+        double aby = mesh.vertices[3 * b + 1] - mesh.vertices[3 * a + 1];
+        double acx = mesh.vertices[3 * c] - mesh.vertices[3 * a];
+        double acy = mesh.vertices[3 * c + 1] - mesh.vertices[3 * a + 1];
+        double cross = std::fabs(abx * acy - aby * acx);
+        if(cross == 0) {
+            return std::numeric_limits<double>::infinity();
+        }
+        return edgeLength(t, 0) * edgeLength(t, 1) * edgeLength(t, 2) / (2 * cross);
+    }
+
+    bool
+    isBorderEdge(std::size_t t, std::size_t i) const
+    {
+        int32_t adj = mesh.neighbours[3 * t + i];
+        return adj < 0 || isRemoved[static_cast<std::size_t>(adj)];
+    }
+
+    std::size_t
+    numBorderEdges(std::size_t t) const
+    {
+        return static_cast<std::size_t>(isBorderEdge(t, 0))
+               + static_cast<std::size_t>(isBorderEdge(t, 1))
+               + static_cast<std::size_t>(isBorderEdge(t, 2));
+    }
+};
+
+} // anonymous namespace
+
+ConcaveHull::ConcaveHull(const Geometry* geom)
+    : inputGeom(geom)
+    , geomFactory(geom->getFactory())
+    , criterion(Criterion::LENGTH)
+    , threshold(std::numeric_limits<double>::infinity())
+{
+}
+
+/* public static */
+std::unique_ptr<Geometry>
+ConcaveHull::concaveHullByLength(const Geometry* geom, double maxLength)
+{
+    ConcaveHull hull(geom);
+    hull.setMaximumEdgeLength(maxLength);
+    return hull.getHull();
+}
+
+/* public static */
+std::unique_ptr<Geometry>
+ConcaveHull::concaveHullByLengthRatio(const Geometry* geom, double lengthRatio)
+{
+    ConcaveHull hull(geom);
+    hull.setMaximumEdgeLengthRatio(lengthRatio);
+    return hull.getHull();
+}
+
+/* public static */
+std::unique_ptr<Geometry>
+ConcaveHull::alphaShape(const Geometry* geom, double alpha)
+{
+    ConcaveHull hull(geom);
+    hull.setAlpha(alpha);
+    return hull.getHull();
+}
+
+void
+ConcaveHull::setMaximumEdgeLength(double length)
+{
+    if(!(length >= 0)) {
+        throw util::IllegalArgumentException("Edge length must be non-negative");
+    }
+    criterion = Criterion::LENGTH;
+    threshold = length;
+}
+
+void
+ConcaveHull::setMaximumEdgeLengthRatio(double ratio)
+{
+    if(!(ratio >= 0 && ratio <= 1)) {
+        throw util::IllegalArgumentException("Edge length ratio must be in range [0,1]");
+    }
+    criterion = Criterion::LENGTH_RATIO;
+    threshold = ratio;
+}
+
+void
+ConcaveHull::setAlpha(double alpha)
+{
+    if(!(alpha >= 0)) {
+        throw util::IllegalArgumentException("Alpha must be non-negative");
+    }
+    criterion = Criterion::ALPHA;
+    threshold = alpha;
+}
+
+std::unique_ptr<Geometry>
+ConcaveHull::getHull()
+{
+    if(inputGeom->isEmpty()) {
+        return geomFactory->createPolygon();
+    }
+
+    DelaunayTriangulationBuilder builder;
+    builder.setSites(*inputGeom);
+    builder.setCompact(true);
+    builder.setInsertionOrder(DelaunayTriangulationBuilder::InsertionOrder::BRIO);
+    TriangleMesh mesh = builder.getTriangleMesh(true);
+
+    const std::size_t numTri = mesh.getNumTriangles();
+    if(numTri == 0) {
+        return inputGeom->convexHull();
+    }
+
+    std::vector<bool> isRemoved(numTri, false);
+    HullMesh hm(mesh, isRemoved);
+
+    double maxSize = threshold;
+    if(criterion == Criterion::LENGTH_RATIO) {
+        double minLen = std::numeric_limits<double>::infinity();
+        double maxLen = 0;
+        for(std::size_t t = 0; t < numTri; t++) {
+            for(std::size_t i = 0; i < 3; i++) {
+                double len = hm.edgeLength(t, i);
+                minLen = std::min(minLen, len);
+                maxLen = std::max(maxLen, len);
+            }
+        }
+        maxSize = minLen + threshold * (maxLen - minLen);
+    }
+
+    auto size = [&hm, this](std::size_t t) {
+        if(criterion == Criterion::ALPHA) {
+            return hm.circumradius(t);
+        }
+        double len = 0;
+        for(std::size_t i = 0; i < 3; i++) {
+            if(hm.isBorderEdge(t, i)) {
+                len = std::max(len, hm.edgeLength(t, i));
+            }
+        }
+        return len;
+    };
+
+    // the vertices on the border of the hull
+    std::vector<bool> isBorderVertex(mesh.getNumVertices(), false);
+
+    std::priority_queue<std::pair<double, std::size_t>> queue;
+    for(std::size_t t = 0; t < numTri; t++) {
+        for(std::size_t i = 0; i < 3; i++) {
+            if(hm.isBorderEdge(t, i)) {
+                isBorderVertex[static_cast<std::size_t>(hm.vertex(t, i))] = true;
+                isBorderVertex[static_cast<std::size_t>(hm.vertex(t, i + 1))] = true;
+            }
+        }
+    }
+    for(std::size_t t = 0; t < numTri; t++) {
+        if(hm.numBorderEdges(t) > 0) {
+            queue.emplace(size(t), t);
+        }
+    }
+
+    while(!queue.empty() && queue.top().first > maxSize) {
+        std::size_t t = queue.top().second;
+        double key = queue.top().first;
+        queue.pop();
+
+        // skip entries made stale by the removal of a neighbour
+        if(isRemoved[t] || key != size(t)) {
+            continue;
+        }
+
+        // Only a triangle with a single border edge is removed, since
+        // removing one with more would drop a point from the hull.
+        // Its opposite vertex must not be on the border either, so the
+        // hull stays connected and without holes.
+        if(hm.numBorderEdges(t) != 1) {
+            continue;
+        }
+        std::size_t border = 0;
+        while(!hm.isBorderEdge(t, border)) {
+            border++;
+        }
+        if(isBorderVertex[static_cast<std::size_t>(hm.vertex(t, border + 2))]) {
+            continue;
+        }
+
+        isRemoved[t] = true;
+        for(std::size_t i = 0; i < 3; i++) {
+            isBorderVertex[static_cast<std::size_t>(hm.vertex(t, i))] = true;
+            int32_t adj = mesh.neighbours[3 * t + i];
+            if(adj >= 0 && !isRemoved[static_cast<std::size_t>(adj)]) {
+                queue.emplace(size(static_cast<std::size_t>(adj)), static_cast<std::size_t>(adj));
+            }
+        }
+    }
+
+    return toPolygon(mesh, isRemoved);
+}
+
+std::unique_ptr<Geometry>
+ConcaveHull::toPolygon(const TriangleMesh& mesh, const std::vector<bool>& isRemoved) const
+{
+    HullMesh hm(mesh, isRemoved);
+
+    // the border edges, in CCW order around the hull, are linked
+    // from their start vertex, which is on a single border edge
+    std::vector<int32_t> nextVertex(mesh.getNumVertices(), -1);
+    int32_t start = -1;
+    std::size_t numBorder = 0;
+    for(std::size_t t = 0; t < mesh.getNumTriangles(); t++) {
+        if(isRemoved[t]) {
+            continue;
+        }
+        for(std::size_t i = 0; i < 3; i++) {
+            if(hm.isBorderEdge(t, i)) {
+                start = hm.vertex(t, i);
+                nextVertex[static_cast<std::size_t>(start)] = hm.vertex(t, i + 1);
+                numBorder++;
+            }
+        }
+    }
+
+    std::vector<Coordinate> coords;
+    coords.reserve(numBorder + 1);
+    int32_t v = start;
+    do {
+        std::size_t k = static_cast<std::size_t>(v);
+        coords.emplace_back(mesh.vertices[3 * k], mesh.vertices[3 * k + 1], mesh.vertices[3 * k + 2]);
+        v = nextVertex[k];
+    }
+    while(v != start);
+    coords.push_back(coords.front());
+
+    auto seq = detail::make_unique<CoordinateArraySequence>(std::move(coords));
+    auto shell = geomFactory->createLinearRing(std::move(seq));
+    return geomFactory->createPolygon(std::move(shell));
+}
+
+} // namespace geos.algorithm.hull
+} // namespace geos.algorithm
+} // namespace geos
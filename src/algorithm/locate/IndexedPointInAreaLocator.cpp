@@ -29,6 +29,7 @@
 #include <geos/index/ItemVisitor.h>
 
 #include <algorithm>
+#include <cmath>
 #include <typeinfo>
 
 namespace geos {
@@ -71,6 +72,7 @@ IndexedPointInAreaLocator::IntervalIndexedGeometry::init(const geom::Geometry& g
             std::max(seg.p0.y, seg.p1.y),
             &seg);
     }
+    index.build();
 }
 
 void
@@ -82,6 +84,28 @@ IndexedPointInAreaLocator::IntervalIndexedGeometry::addLine(const geom::Coordina
 }
 
 
+const std::vector<IndexedPointInAreaLocator::IntervalIndexedGeometry::SweepSegment>&
+IndexedPointInAreaLocator::IntervalIndexedGeometry::getSweepSegments()
+{
+    std::call_once(sweepFlag, [this]() {
+        sweepSegments.reserve(segments.size());
+        for(const geom::LineSegment& seg : segments) {
+            sweepSegments.push_back({
+                std::min(seg.p0.y, seg.p1.y),
+                std::max(seg.p0.y, seg.p1.y),
+                std::max(seg.p0.x, seg.p1.x),
+                &seg
+            });
+        }
+        std::sort(sweepSegments.begin(), sweepSegments.end(),
+        [](const SweepSegment& a, const SweepSegment& b) {
+            return a.minY < b.minY;
+        });
+    });
+    return sweepSegments;
+}
+
+
 void
 IndexedPointInAreaLocator::buildIndex(const geom::Geometry& g)
 {
@@ -110,9 +134,9 @@ IndexedPointInAreaLocator::IndexedPointInAreaLocator(const geom::Geometry& g)
 geom::Location
 IndexedPointInAreaLocator::locate(const geom::Coordinate* /*const*/ p)
 {
-    if (index == nullptr) {
+    std::call_once(indexFlag, [this]() {
         buildIndex(areaGeom);
-    }
+    });
 
     algorithm::RayCrossingCounter rcc(*p);
 
@@ -123,6 +147,64 @@ IndexedPointInAreaLocator::locate(const geom::Coordinate* /*const*/ p)
     return rcc.getLocation();
 }
 
+void
+IndexedPointInAreaLocator::locate(const double* xs, const double* ys, std::size_t n, geom::Location* out)
+{
+    std::call_once(indexFlag, [this]() {
+        buildIndex(areaGeom);
+    });
+
+    // Points with NaN ordinates can't be ordered, locate them one by one.
+    std::vector<std::size_t> order;
+    order.reserve(n);
+    for(std::size_t i = 0; i < n; i++) {
+        if(std::isnan(xs[i]) || std::isnan(ys[i])) {
+            geom::Coordinate p(xs[i], ys[i]);
+            out[i] = locate(&p);
+        }
+        else {
+            order.push_back(i);
+        }
+    }
+    std::sort(order.begin(), order.end(), [ys](std::size_t a, std::size_t b) {
+        return ys[a] < ys[b];
+    });
+
+    // Sweep a horizontal line upwards through the points. The active list
+    // holds the segments whose Y interval contains the scan line, which are
+    // exactly those the interval tree would return for a single point.
+    using SweepSegment = IntervalIndexedGeometry::SweepSegment;
+    const std::vector<SweepSegment>& sweepSegs = index->getSweepSegments();
+    std::vector<SweepSegment> active;
+    std::size_t next = 0;
+
+    for(std::size_t i : order) {
+        geom::Coordinate p(xs[i], ys[i]);
+
+        while(next < sweepSegs.size() && sweepSegs[next].minY <= p.y) {
+            active.push_back(sweepSegs[next++]);
+        }
+
+        algorithm::RayCrossingCounter rcc(p);
+        std::size_t nActive = 0;
+        for(const SweepSegment& s : active) {
+            // the scan line has passed above this segment
+            if(s.maxY < p.y) {
+                continue;
+            }
+            active[nActive++] = s;
+
+            // segments entirely to the left of the point are not counted
+            if(s.maxX >= p.x) {
+                rcc.countSegment(s.seg->p0, s.seg->p1);
+            }
+        }
+        active.resize(nActive);
+
+        out[i] = rcc.getLocation();
+    }
+}
+
 void
 IndexedPointInAreaLocator::SegmentVisitor::visitItem(void* item)
 {
@@ -33,6 +33,7 @@
 #include <geos/geom/MultiLineString.h>
 #include <geos/geom/MultiPolygon.h>
 #include <geos/geom/IntersectionMatrix.h>
+#include <geos/geom/Dimension.h>
 #include <geos/util/IllegalArgumentException.h>
 #include <geos/algorithm/Centroid.h>
 #include <geos/algorithm/InteriorPointPoint.h>
@@ -151,19 +152,7 @@ Geometry::hasNullElements(const CoordinateSequence* list)
 bool
 Geometry::isWithinDistance(const Geometry* geom, double cDistance) const
 {
-    const Envelope* env0 = getEnvelopeInternal();
-    const Envelope* env1 = geom->getEnvelopeInternal();
-    double envDist = env0->distance(*env1);
-
-    if(envDist > cDistance) {
-        return false;
-    }
-    // NOTE: this could be implemented more efficiently
-    double geomDist = distance(geom);
-    if(geomDist > cDistance) {
-        return false;
-    }
-    return true;
+    return DistanceOp::isWithinDistance(*this, *geom, cDistance);
 }
 
 /*public*/
@@ -274,9 +263,7 @@ Geometry::disjoint(const Geometry* g) const
         return true;
     }
 #endif
-    std::unique_ptr<IntersectionMatrix> im(relate(g));
-    bool res = im->isDisjoint();
-    return res;
+    return relate(g, "FF*FF****");
 }
 
 bool
@@ -329,9 +316,7 @@ Geometry::intersects(const Geometry* g) const
         return predicate::RectangleIntersects::intersects(*p, *this);
     }
 
-    std::unique_ptr<IntersectionMatrix> im(relate(g));
-    bool res = im->isIntersects();
-    return res;
+    return !relate(g, "FF*FF****");
 }
 
 /*public*/
@@ -377,9 +362,23 @@ Geometry::crosses(const Geometry* g) const
         return false;
     }
 #endif
-    std::unique_ptr<IntersectionMatrix> im(relate(g));
-    bool res = im->isCrosses(getDimension(), g->getDimension());
-    return res;
+    // the pattern of IntersectionMatrix::isCrosses for the dimensions
+    const int dimA = getDimension();
+    const int dimB = g->getDimension();
+    if((dimA == Dimension::P && dimB == Dimension::L) ||
+            (dimA == Dimension::P && dimB == Dimension::A) ||
+            (dimA == Dimension::L && dimB == Dimension::A)) {
+        return relate(g, "T*T******");
+    }
+    if((dimA == Dimension::L && dimB == Dimension::P) ||
+            (dimA == Dimension::A && dimB == Dimension::P) ||
+            (dimA == Dimension::A && dimB == Dimension::L)) {
+        return relate(g, "T*****T**");
+    }
+    if(dimA == Dimension::L && dimB == Dimension::L) {
+        return relate(g, "0********");
+    }
+    return false;
 }
 
 bool
@@ -420,9 +419,7 @@ Geometry::contains(const Geometry* g) const
     //	return predicate::RectangleContains::contains((const Polygon&)*g, *this);
     //}
 
-    std::unique_ptr<IntersectionMatrix> im(relate(g));
-    bool res = im->isContains();
-    return res;
+    return relate(g, "T*****FF*");
 }
 
 bool
@@ -434,17 +431,23 @@ Geometry::overlaps(const Geometry* g) const
         return false;
     }
 #endif
-    std::unique_ptr<IntersectionMatrix> im(relate(g));
-    bool res = im->isOverlaps(getDimension(), g->getDimension());
-    return res;
+    // the pattern of IntersectionMatrix::isOverlaps for the dimensions
+    const int dimA = getDimension();
+    const int dimB = g->getDimension();
+    if((dimA == Dimension::P && dimB == Dimension::P) ||
+            (dimA == Dimension::A && dimB == Dimension::A)) {
+        return relate(g, "T*T***T**");
+    }
+    if(dimA == Dimension::L && dimB == Dimension::L) {
+        return relate(g, "1*T***T**");
+    }
+    return false;
 }
 
 bool
 Geometry::relate(const Geometry* g, const std::string& intersectionPattern) const
 {
-    std::unique_ptr<IntersectionMatrix> im(relate(g));
-    bool res = im->matches(intersectionPattern);
-    return res;
+    return RelateOp::relate(this, g, intersectionPattern);
 }
 
 bool
@@ -464,9 +467,10 @@ Geometry::equals(const Geometry* g) const
         return isEmpty();
     }
 
-    std::unique_ptr<IntersectionMatrix> im(relate(g));
-    bool res = im->isEquals(getDimension(), g->getDimension());
-    return res;
+    if(getDimension() != g->getDimension()) {
+        return false;
+    }
+    return relate(g, "T*F**FFF*");
 }
 
 std::unique_ptr<IntersectionMatrix>
@@ -19,14 +19,119 @@
 
 #include <geos/geom/prep/BasicPreparedGeometry.h>
 #include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/Dimension.h>
+#include <geos/geom/GeometryComponentFilter.h>
+#include <geos/geom/IntersectionMatrix.h>
+#include <geos/geom/LineString.h>
+#include <geos/geom/Point.h>
+#include <geos/geom/PointSet.h>
+#include <geos/algorithm/LineIntersector.h>
 #include <geos/algorithm/PointLocator.h>
+#include <geos/algorithm/locate/PointOnGeometryLocator.h>
 #include <geos/geom/util/ComponentCoordinateExtracter.h>
+#include <geos/geomgraph/GeometryGraph.h>
+#include <geos/geomgraph/index/SegmentIntersector.h>
 #include <geos/operation/distance/DistanceOp.h>
+#include <geos/operation/distance/IndexedFacetDistance.h>
+#include <geos/operation/relate/RelateComputer.h>
+#include <geos/util/ChunkedRange.h>
+
+#include <algorithm>
+#include <limits>
 
 namespace geos {
 namespace geom { // geos.geom
 namespace prep { // geos.geom.prep
 
+namespace {
+
+/*
+ * Computes the values which the components of a geometry cache on
+ * first use, so that concurrent queries of it only read them.
+ */
+class CacheFiller : public geom::GeometryComponentFilter {
+public:
+    void
+    filter_ro(const geom::Geometry* g) override
+    {
+        g->getEnvelopeInternal();
+        if(const geom::LineString* line = dynamic_cast<const geom::LineString*>(g)) {
+            line->getCoordinatesRO()->getDimension();
+        }
+        else if(const geom::Point* pt = dynamic_cast<const geom::Point*>(g)) {
+            pt->getCoordinatesRO()->getDimension();
+        }
+    }
+};
+
+} // anonymous namespace
+
+/*          *
+ * private: *
+ *          */
+
+const geomgraph::GeometryGraph&
+BasicPreparedGeometry::getNodedGraph() const
+{
+    std::call_once(nodedGraphFlag, [this]() {
+        nodedGraph.reset(new geomgraph::GeometryGraph(0, baseGeom));
+        algorithm::LineIntersector li;
+        nodedGraph->computeSelfNodes(li, false);
+    });
+    return *nodedGraph;
+}
+
+std::unique_ptr<geom::IntersectionMatrix>
+BasicPreparedGeometry::disjointIM(const geom::Geometry* g) const
+{
+    std::unique_ptr<geom::IntersectionMatrix> im(new geom::IntersectionMatrix("FFFFFFFF2"));
+    if(!baseGeom->isEmpty()) {
+        im->set(Location::INTERIOR, Location::EXTERIOR, baseGeom->getDimension());
+        im->set(Location::BOUNDARY, Location::EXTERIOR, baseGeom->getBoundaryDimension());
+    }
+    if(!g->isEmpty()) {
+        im->set(Location::EXTERIOR, Location::INTERIOR, g->getDimension());
+        im->set(Location::EXTERIOR, Location::BOUNDARY, g->getBoundaryDimension());
+    }
+    return im;
+}
+
+bool
+BasicPreparedGeometry::isPatternPossible(const geom::Geometry* g, const std::string& pattern) const
+{
+    if(pattern.size() != 9) {
+        return true;
+    }
+
+    // the dimensions of the interior, boundary and exterior of each geometry
+    const int dimA[3] = {
+        baseGeom->isEmpty() ? Dimension::False : baseGeom->getDimension(),
+        baseGeom->isEmpty() ? Dimension::False : baseGeom->getBoundaryDimension(),
+        Dimension::A
+    };
+    const int dimB[3] = {
+        g->isEmpty() ? Dimension::False : g->getDimension(),
+        g->isEmpty() ? Dimension::False : g->getBoundaryDimension(),
+        Dimension::A
+    };
+
+    for(std::size_t i = 0; i < 3; i++) {
+        for(std::size_t j = 0; j < 3; j++) {
+            // the intersection of two point sets is no larger than either
+            const int maxDim = std::min(dimA[i], dimB[j]);
+            const char c = pattern[3 * i + j];
+            if(c == 'T' && maxDim == Dimension::False) {
+                return false;
+            }
+            if(c >= '0' && c <= '2' && c - '0' > maxDim) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
 /*            *
  * protected: *
  *            */
@@ -36,6 +141,9 @@ BasicPreparedGeometry::setGeometry(const geom::Geometry* geom)
 {
     baseGeom = geom;
     geom::util::ComponentCoordinateExtracter::getCoordinates(*baseGeom, representativePts);
+
+    CacheFiller filler;
+    baseGeom->apply_ro(&filler);
 }
 
 bool
@@ -66,6 +174,8 @@ BasicPreparedGeometry::BasicPreparedGeometry(const Geometry* geom)
     setGeometry(geom);
 }
 
+BasicPreparedGeometry::~BasicPreparedGeometry() = default;
+
 bool
 BasicPreparedGeometry::isAnyTargetComponentInTest(const geom::Geometry* testGeom) const
 {
@@ -80,6 +190,15 @@ BasicPreparedGeometry::isAnyTargetComponentInTest(const geom::Geometry* testGeom
     return false;
 }
 
+operation::distance::IndexedFacetDistance*
+BasicPreparedGeometry::getIndexedFacetDistance() const
+{
+    std::call_once(indexedDistanceFlag, [this]() {
+        indexedDistance.reset(new operation::distance::IndexedFacetDistance(baseGeom));
+    });
+    return indexedDistance.get();
+}
+
 bool
 BasicPreparedGeometry::contains(const geom::Geometry* g) const
 {
@@ -148,6 +267,48 @@ BasicPreparedGeometry::within(const geom::Geometry* g) const
     return baseGeom->within(g);
 }
 
+std::unique_ptr<geom::IntersectionMatrix>
+BasicPreparedGeometry::relate(const geom::Geometry* g) const
+{
+    // The matrix of disjoint geometries needs no graph.
+    // The intersects test of a collection is not indexed, but a relate.
+    if(baseGeom->isEmpty() || g->isEmpty() || !envelopesIntersect(g)) {
+        return disjointIM(g);
+    }
+    if(baseGeom->getGeometryTypeId() != GEOS_GEOMETRYCOLLECTION && !intersects(g)) {
+        return disjointIM(g);
+    }
+
+    geomgraph::GeometryGraph graph0(0, baseGeom);
+    graph0.addSelfNodes(getNodedGraph());
+    geomgraph::GeometryGraph graph1(1, g);
+
+    std::vector<geomgraph::GeometryGraph*> arg { &graph0, &graph1 };
+    operation::relate::RelateComputer relateComp(&arg);
+    relateComp.setLocator(0, getPointLocator());
+    return relateComp.computeIM();
+}
+
+bool
+BasicPreparedGeometry::relate(const geom::Geometry* g, const std::string& pattern) const
+{
+    // patterns of predicates with prepared implementations
+    if(pattern == "T*****FF*") {
+        return contains(g);
+    }
+    if(pattern == "T**FF*FF*") {
+        return containsProperly(g);
+    }
+    if(pattern == "FF*FF****") {
+        return disjoint(g);
+    }
+
+    if(!isPatternPossible(g, pattern)) {
+        return false;
+    }
+    return relate(g)->matches(pattern);
+}
+
 std::unique_ptr<geom::CoordinateSequence>
 BasicPreparedGeometry::nearestPoints(const geom::Geometry* g) const
 {
@@ -163,6 +324,51 @@ BasicPreparedGeometry::distance(const geom::Geometry* g) const
     return coords->getAt(0).distance( coords->getAt(1) );
 }
 
+bool
+BasicPreparedGeometry::isWithinDistance(const geom::Geometry* g, double dist) const
+{
+    return baseGeom->isWithinDistance(g, dist);
+}
+
+void
+BasicPreparedGeometry::distance(const geom::PointSet& pts, double* distances,
+                                std::size_t numThreads) const
+{
+    const std::size_t n = pts.size();
+    if(baseGeom->isEmpty()) {
+        std::fill(distances, distances + n, std::numeric_limits<double>::infinity());
+        return;
+    }
+
+    // build the shared indexes before the threads start
+    const operation::distance::IndexedFacetDistance* ifd = getIndexedFacetDistance();
+    const bool isAreal = baseGeom->getDimension() == Dimension::A;
+    algorithm::locate::PointOnGeometryLocator* locator = isAreal ? getPointLocator() : nullptr;
+
+    auto computeRange = [&](std::size_t begin, std::size_t end) {
+        algorithm::PointLocator ptLocator;
+        for(std::size_t i = begin; i < end; i++) {
+            const geom::Coordinate p(pts.getX(i), pts.getY(i));
+            // the points in an area are at distance zero from it
+            if(isAreal) {
+                const geom::Location loc = locator ? locator->locate(&p)
+                                           : ptLocator.locate(p, baseGeom);
+                if(loc != geom::Location::EXTERIOR) {
+                    distances[i] = 0.0;
+                    continue;
+                }
+            }
+            distances[i] = ifd->distance(p);
+        }
+    };
+
+    // a few thousand facet distances are worth a thread
+    const geos::util::ChunkedRange chunks(n, 1 << 12, numThreads);
+    chunks.run([&](std::size_t, std::size_t begin, std::size_t end) {
+        computeRange(begin, end);
+    });
+}
+
 std::string
 BasicPreparedGeometry::toString()
 {
@@ -47,10 +47,10 @@ PreparedLineString::~PreparedLineString()
 noding::FastSegmentSetIntersectionFinder*
 PreparedLineString::getIntersectionFinder()
 {
-    if(! segIntFinder) {
+    std::call_once(segIntFinderFlag, [this]() {
         noding::SegmentStringUtil::extractSegmentStrings(&getGeometry(), segStrings);
         segIntFinder.reset(new noding::FastSegmentSetIntersectionFinder(&segStrings));
-    }
+    });
 
     return segIntFinder.get();
 }
@@ -67,17 +67,6 @@ PreparedLineString::intersects(const geom::Geometry* g) const
     return PreparedLineStringIntersects::intersects(prep, g);
 }
 
-/* public */
-operation::distance::IndexedFacetDistance*
-PreparedLineString::
-getIndexedFacetDistance() const
-{
-    if(! indexedDistance ) {
-        indexedDistance.reset(new operation::distance::IndexedFacetDistance(&getGeometry()));
-    }
-    return indexedDistance.get();
-}
-
 
 std::unique_ptr<geom::CoordinateSequence>
 PreparedLineString::nearestPoints(const geom::Geometry* g) const
@@ -91,6 +80,12 @@ PreparedLineString::distance(const geom::Geometry* g) const
     return PreparedLineStringDistance::distance(*this, g);
 }
 
+bool
+PreparedLineString::isWithinDistance(const geom::Geometry* g, double dist) const
+{
+    return PreparedLineStringDistance::isWithinDistance(*this, g, dist);
+}
+
 
 } // namespace geos.geom.prep
 } // namespace geos.geom
@@ -19,6 +19,9 @@
 
 #include <geos/geom/prep/PreparedLineString.h>
 #include <geos/geom/prep/PreparedLineStringDistance.h>
+#include <geos/geom/Dimension.h>
+#include <geos/geom/Envelope.h>
+#include <geos/geom/Geometry.h>
 
 namespace geos {
 namespace geom { // geos.geom
@@ -35,11 +38,37 @@ PreparedLineStringDistance::distance(const geom::Geometry* g) const
     // TODO: test if this shortcut be any useful
     //if ( prepLine.intersects(g) ) return 0.0;
 
+    // the facets miss a line inside an area
+    if ( g->getDimension() == Dimension::A && prepLine.intersects(g) ) return 0.0;
+
     /* Not intersecting, compute distance from facets */
     operation::distance::IndexedFacetDistance *idf = prepLine.getIndexedFacetDistance();
+    if ( g->getGeometryTypeId() == GEOS_POINT )
+    {
+        // no need to index the facet of a point
+        return idf->distance(*g->getCoordinate());
+    }
     return idf->distance(g);
 }
 
+bool
+PreparedLineStringDistance::isWithinDistance(const geom::Geometry* g, double dist) const
+{
+    if ( prepLine.getGeometry().isEmpty() || g->isEmpty() )
+    {
+        return false;
+    }
+
+    // short-circuit check
+    const Envelope* env0 = prepLine.getGeometry().getEnvelopeInternal();
+    if ( env0->distance(*g->getEnvelopeInternal()) > dist ) return false;
+
+    // the facets miss a line inside an area
+    if ( g->getDimension() == Dimension::A && prepLine.intersects(g) ) return true;
+
+    return prepLine.getIndexedFacetDistance()->isWithinDistance(g, dist);
+}
+
 
 } // namespace geos.geom.prep
 } // namespace geos.geom
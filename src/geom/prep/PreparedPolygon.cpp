@@ -57,10 +57,10 @@ noding::FastSegmentSetIntersectionFinder*
 PreparedPolygon::
 getIntersectionFinder() const
 {
-    if(! segIntFinder) {
+    std::call_once(segIntFinderFlag, [this]() {
         noding::SegmentStringUtil::extractSegmentStrings(&getGeometry(), segStrings);
         segIntFinder.reset(new noding::FastSegmentSetIntersectionFinder(&segStrings));
-    }
+    });
     return segIntFinder.get();
 }
 
@@ -68,9 +68,9 @@ algorithm::locate::PointOnGeometryLocator*
 PreparedPolygon::
 getPointLocator() const
 {
-    if(! ptOnGeomLoc) {
+    std::call_once(ptOnGeomLocFlag, [this]() {
         ptOnGeomLoc.reset(new algorithm::locate::IndexedPointInAreaLocator(getGeometry()));
-    }
+    });
 
     return ptOnGeomLoc.get();
 }
@@ -144,23 +144,18 @@ intersects(const geom::Geometry* g) const
     return PreparedPolygonIntersects::intersects(this, g);
 }
 
-/* public */
-operation::distance::IndexedFacetDistance*
-PreparedPolygon::
-getIndexedFacetDistance() const
-{
-    if(! indexedDistance ) {
-        indexedDistance.reset(new operation::distance::IndexedFacetDistance(&getGeometry()));
-    }
-    return indexedDistance.get();
-}
-
 double
 PreparedPolygon::distance(const geom::Geometry* g) const
 {
     return PreparedPolygonDistance::distance(*this, g);
 }
 
+bool
+PreparedPolygon::isWithinDistance(const geom::Geometry* g, double dist) const
+{
+    return PreparedPolygonDistance::isWithinDistance(*this, g, dist);
+}
+
 } // namespace geos.geom.prep
 } // namespace geos.geom
 } // namespace geos
@@ -20,6 +20,7 @@
 #include <geos/geom/prep/PreparedPolygon.h>
 #include <geos/algorithm/locate/IndexedPointInAreaLocator.h>
 #include <geos/geom/Geometry.h>
+#include <geos/geom/Envelope.h>
 
 // std
 #include <cstddef>
@@ -40,9 +41,32 @@ PreparedPolygonDistance::distance(const geom::Geometry* g) const
 
     /* Not intersecting, compute distance from facets */
     operation::distance::IndexedFacetDistance *idf = prepPoly.getIndexedFacetDistance();
+    if ( g->getGeometryTypeId() == GEOS_POINT )
+    {
+        // no need to index the facet of a point
+        return idf->distance(*g->getCoordinate());
+    }
     return idf->distance(g);
 }
 
+bool
+PreparedPolygonDistance::isWithinDistance(const geom::Geometry* g, double dist) const
+{
+    if ( prepPoly.getGeometry().isEmpty() || g->isEmpty() )
+    {
+        return false;
+    }
+
+    // short-circuit check
+    const Envelope* env0 = prepPoly.getGeometry().getEnvelopeInternal();
+    if ( env0->distance(*g->getEnvelopeInternal()) > dist ) return false;
+
+    if ( prepPoly.intersects(g) ) return true;
+
+    /* Not intersecting, test the facets up to the distance */
+    return prepPoly.getIndexedFacetDistance()->isWithinDistance(g, dist);
+}
+
 } // namespace geos.geom.prep
 } // namespace geos.geom
 } // namespace geos
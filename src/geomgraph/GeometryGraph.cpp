@@ -21,6 +21,7 @@
 #include <geos/algorithm/Orientation.h>
 #include <geos/algorithm/BoundaryNodeRule.h>
 
+#include <geos/util/IllegalArgumentException.h>
 #include <geos/util/UnsupportedOperationException.h>
 #include <geos/util.h>
 
@@ -99,7 +100,7 @@ GeometryGraph::determineBoundary(int boundaryCount)
 
 
 EdgeSetIntersector*
-GeometryGraph::createEdgeSetIntersector()
+GeometryGraph::createEdgeSetIntersector(const Envelope* env)
 {
     // various options for computing intersections, from slowest to fastest
 
@@ -110,7 +111,7 @@ GeometryGraph::createEdgeSetIntersector()
     //private EdgeSetIntersector esi = new MCSweepLineIntersector();
 
     //return new SimpleEdgeSetIntersector();
-    return new SimpleMCSweepLineIntersector();
+    return new SimpleMCSweepLineIntersector(env);
 }
 
 /*public*/
@@ -364,7 +365,6 @@ GeometryGraph::computeSelfNodes(LineIntersector& li,
 {
     auto si = detail::make_unique<SegmentIntersector>(&li, true, false);
     si->setIsDoneIfProperInt(isDoneIfProperInt);
-    std::unique_ptr<EdgeSetIntersector> esi(createEdgeSetIntersector());
 
     typedef std::vector<Edge*> EC;
     EC* se = edges;
@@ -375,6 +375,11 @@ GeometryGraph::computeSelfNodes(LineIntersector& li,
         //cerr << "(computeSelfNodes) Self edges reduced from " << se->size() << " to " << self_edges_copy.size() << std::endl;
         se = &self_edges_copy;
     }
+    else {
+        env = nullptr;
+    }
+    // the chains of the edges outside env are skipped too
+    std::unique_ptr<EdgeSetIntersector> esi(createEdgeSetIntersector(env));
 
     bool isRings = dynamic_cast<const LinearRing*>(parentGeom)
                    || dynamic_cast<const Polygon*>(parentGeom)
@@ -389,20 +394,48 @@ GeometryGraph::computeSelfNodes(LineIntersector& li,
 #endif // GEOS_DEBUG
 
     addSelfIntersectionNodes(argIndex);
+    hasSelfNodesVar = true;
     return si;
 }
 
+/*public*/
+void
+GeometryGraph::addSelfNodes(const GeometryGraph& noded)
+{
+    if(noded.parentGeom != parentGeom || noded.argIndex != argIndex
+            || noded.edges->size() != edges->size()) {
+        throw util::IllegalArgumentException("Self-nodes must come from a graph of the same geometry");
+    }
+
+    for(std::size_t i = 0, n = edges->size(); i < n; ++i) {
+        EdgeIntersectionList& eiL = (*edges)[i]->eiList;
+        for(const EdgeIntersection& ei : (*noded.edges)[i]->eiList) {
+            eiL.add(ei.coord, ei.segmentIndex, ei.dist);
+        }
+    }
+    addSelfIntersectionNodes(argIndex);
+    hasSelfNodesVar = true;
+}
+
 std::unique_ptr<SegmentIntersector>
 GeometryGraph::computeEdgeIntersections(GeometryGraph* g,
                                         LineIntersector* li, bool includeProper, const Envelope* env)
+{
+    return computeEdgeIntersections(g, li, includeProper, false, env);
+}
+
+std::unique_ptr<SegmentIntersector>
+GeometryGraph::computeEdgeIntersections(GeometryGraph* g,
+                                        LineIntersector* li, bool includeProper,
+                                        bool isDoneIfProperInt, const Envelope* env)
 {
 #if GEOS_DEBUG
     std::cerr << "GeometryGraph::computeEdgeIntersections call" << std::endl;
 #endif
     std::unique_ptr<SegmentIntersector> si(new SegmentIntersector(li, includeProper, true));
+    si->setIsDoneIfProperInt(isDoneIfProperInt);
 
     si->setBoundaryNodes(getBoundaryNodes(), g->getBoundaryNodes());
-    std::unique_ptr<EdgeSetIntersector> esi(createEdgeSetIntersector());
 
     typedef std::vector<Edge*> EC;
 
@@ -421,6 +454,9 @@ GeometryGraph::computeEdgeIntersections(GeometryGraph* g,
         //cerr << "Other edges reduced from " << oe->size() << " to " << other_edges_copy.size() << std::endl;
         oe = &other_edges_copy;
     }
+    // the chains of the edges outside env are skipped too
+    std::unique_ptr<EdgeSetIntersector> esi(createEdgeSetIntersector(
+        se != edges || oe != g->edges ? env : nullptr));
     esi->computeIntersections(se, oe, si.get());
 #if GEOS_DEBUG
     std::cerr << "GeometryGraph::computeEdgeIntersections returns" << std::endl;
@@ -532,7 +568,8 @@ GeometryGraph::GeometryGraph(int newArgIndex,
     useBoundaryDeterminationRule(true),
     boundaryNodeRule(algorithm::BoundaryNodeRule::getBoundaryOGCSFS()),
     argIndex(newArgIndex),
-    hasTooFewPointsVar(false)
+    hasTooFewPointsVar(false),
+    hasSelfNodesVar(false)
 {
     if(parentGeom != nullptr) {
         add(parentGeom);
@@ -548,7 +585,8 @@ GeometryGraph::GeometryGraph(int newArgIndex,
     useBoundaryDeterminationRule(true),
     boundaryNodeRule(bnr),
     argIndex(newArgIndex),
-    hasTooFewPointsVar(false)
+    hasTooFewPointsVar(false),
+    hasSelfNodesVar(false)
 {
     if(parentGeom != nullptr) {
         add(parentGeom);
@@ -562,7 +600,8 @@ GeometryGraph::GeometryGraph()
     useBoundaryDeterminationRule(true),
     boundaryNodeRule(algorithm::BoundaryNodeRule::getBoundaryOGCSFS()),
     argIndex(-1),
-    hasTooFewPointsVar(false)
+    hasTooFewPointsVar(false),
+    hasSelfNodesVar(false)
 {
 }
 
@@ -87,6 +87,14 @@ MonotoneChainEdge::getMaxX(std::size_t chainIndex)
     return x1 > x2 ? x1 : x2;
 }
 
+bool
+MonotoneChainEdge::intersects(std::size_t chainIndex, const Envelope& env) const
+{
+    // the envelope of a chain is the envelope of its end points
+    return env.intersects(pts->getAt(startIndex[chainIndex]),
+                          pts->getAt(startIndex[chainIndex + 1]));
+}
+
 void
 MonotoneChainEdge::computeIntersects(const MonotoneChainEdge& mce,
                                      SegmentIntersector& si)
@@ -77,6 +77,9 @@ SimpleMCSweepLineIntersector::add(Edge* edge, void* edgeSet)
 
     for(std::size_t i = 0; i < n; ++i) {
         GEOS_CHECK_FOR_INTERRUPTS();
+        if(env && !mce->intersects(i, *env)) {
+            continue;
+        }
         chains.emplace_back(mce, i);
         MonotoneChain* mc = &chains.back();
 
@@ -59,6 +59,10 @@ AbstractSTRtree::build()
     }
 
     root = (itemBoundables->empty() ? createNode(0) : createHigherLevels(itemBoundables, -1));
+    // The bounds of the other nodes are computed while packing them.
+    // Computing those of the root too leaves nothing for queries to
+    // write, so a built tree can be queried concurrently.
+    root->getBounds();
     built = true;
 }
 
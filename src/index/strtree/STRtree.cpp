@@ -195,6 +195,9 @@ STRtree::nearestNeighbour(BoundablePair* initBndPair, double maxDistance)
          */
         if(bndPair->isLeaves()) {
             distanceLowerBound = currentDistance;
+            if(minPair && minPair != initBndPair) {
+                delete minPair;
+            }
             minPair = bndPair;
         }
         else {
@@ -245,6 +248,7 @@ STRtree::isWithinDistance(STRtree* tree, ItemDistance* itemDist, double maxDista
 bool STRtree::isWithinDistance(BoundablePair* initBndPair, double maxDistance)
 {
     double distanceUpperBound = std::numeric_limits<double>::infinity();
+    bool isWithin = false;
 
     // initialize search queue
     BoundablePair::BoundablePairQueue priQ;
@@ -262,7 +266,7 @@ bool STRtree::isWithinDistance(BoundablePair* initBndPair, double maxDistance)
          * and terminate with false
          */
         if (currentDistance > maxDistance)
-            return false;
+            break;
 
         /*
          * There must be some pair of items in the nodes which
@@ -272,21 +276,21 @@ bool STRtree::isWithinDistance(BoundablePair* initBndPair, double maxDistance)
          * NOTE: using the Envelope MinMaxDistance would provide a tighter bound,
          * but not sure how to compute this!
          */
-        if (bndPair->maximumDistance() <= maxDistance)
-            return true;
+        if (bndPair->maximumDistance() <= maxDistance) {
+            isWithin = true;
+            break;
+        }
+
+        priQ.pop();
 
         /*
          * If the pair members are leaves
-         * then their distance is an upper bound.
-         * Update the distanceUpperBound to reflect this
+         * then their distance is exact, and
+         * within maxDistance after the test above,
+         * so can terminate with true
          */
         if (bndPair->isLeaves()) {
-            distanceUpperBound = currentDistance;
-
-            // Current pair is closer than maxDistance
-            // so can terminate with true
-            if (distanceUpperBound <= maxDistance)
-                return true;
+            isWithin = true;
         }
         else {
             /*
@@ -296,8 +300,25 @@ bool STRtree::isWithinDistance(BoundablePair* initBndPair, double maxDistance)
              */
             bndPair->expandToQueue(priQ, distanceUpperBound);
         }
+
+        if(bndPair != initBndPair) {
+            delete bndPair;
+        }
+        if(isWithin) {
+            break;
+        }
     }
-    return false;
+
+    /* Free any remaining BoundablePairs in the queue */
+    while(!priQ.empty()) {
+        BoundablePair* bndPair = priQ.top();
+        priQ.pop();
+        if(bndPair != initBndPair) {
+            delete bndPair;
+        }
+    }
+
+    return isWithin;
 }
 
 
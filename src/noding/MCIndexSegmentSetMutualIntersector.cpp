@@ -25,6 +25,7 @@
 #include <geos/index/chain/MonotoneChainBuilder.h>
 #include <geos/index/chain/MonotoneChainOverlapAction.h>
 #include <geos/index/strtree/SimpleSTRtree.h>
+#include <geos/util/IllegalStateException.h>
 // std
 #include <cstddef>
 
@@ -58,10 +59,18 @@ MCIndexSegmentSetMutualIntersector::addToMonoChains(SegmentString* segStr)
 void
 MCIndexSegmentSetMutualIntersector::intersectChains()
 {
-    MCIndexSegmentSetMutualIntersector::SegmentOverlapAction overlapAction(*segInt);
+    nOverlaps += intersectChains(monoChains, *segInt);
+}
+
+/*private*/
+int
+MCIndexSegmentSetMutualIntersector::intersectChains(MonoChains& chains, SegmentIntersector& si) const
+{
+    MCIndexSegmentSetMutualIntersector::SegmentOverlapAction overlapAction(si);
 
+    int numOverlaps = 0;
     std::vector<void*> overlapChains;
-    for(auto& queryChain : monoChains) {
+    for(auto& queryChain : chains) {
         overlapChains.clear();
 
         index->query(&(queryChain.getEnvelope()), overlapChains);
@@ -70,12 +79,13 @@ MCIndexSegmentSetMutualIntersector::intersectChains()
             MonotoneChain* testChain = (MonotoneChain*)(overlapChains[j]);
 
             queryChain.computeOverlaps(testChain, &overlapAction);
-            nOverlaps++;
-            if(segInt->isDone()) {
-                return;
+            numOverlaps++;
+            if(si.isDone()) {
+                return numOverlaps;
             }
         }
     }
+    return numOverlaps;
 }
 
 
@@ -93,14 +103,23 @@ MCIndexSegmentSetMutualIntersector::setBaseSegments(SegmentString::ConstVect* se
 
 /*public*/
 void
-MCIndexSegmentSetMutualIntersector::process(SegmentString::ConstVect* segStrings)
+MCIndexSegmentSetMutualIntersector::buildIndex()
 {
-    if (!indexBuilt) {
-        for (auto& mc: indexChains) {
-            index->insert(&(mc.getEnvelope()), &mc);
-        }
-        indexBuilt = true;
+    if(indexBuilt) {
+        return;
     }
+    for(auto& mc : indexChains) {
+        index->insert(&(mc.getEnvelope()), &mc);
+    }
+    index->build();
+    indexBuilt = true;
+}
+
+/*public*/
+void
+MCIndexSegmentSetMutualIntersector::process(SegmentString::ConstVect* segStrings)
+{
+    buildIndex();
 
     // Reset counters for new inputs
     monoChains.clear();
@@ -114,6 +133,23 @@ MCIndexSegmentSetMutualIntersector::process(SegmentString::ConstVect* segStrings
     intersectChains();
 }
 
+/*public*/
+void
+MCIndexSegmentSetMutualIntersector::process(SegmentString::ConstVect* segStrings,
+        SegmentIntersector* p_segInt) const
+{
+    if(!indexBuilt) {
+        throw util::IllegalStateException("Segment index must be built before shared processing");
+    }
+
+    MonoChains chains;
+    for(const SegmentString* css : *segStrings) {
+        SegmentString* ss = const_cast<SegmentString*>(css);
+        MonotoneChainBuilder::getChains(ss->getCoordinates(), ss, chains);
+    }
+    intersectChains(chains, *p_segInt);
+}
+
 
 /* public */
 void
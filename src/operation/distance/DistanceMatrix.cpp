@@ -0,0 +1,151 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2021 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/operation/distance/DistanceMatrix.h>
+#include <geos/geom/Envelope.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/prep/PreparedGeometry.h>
+#include <geos/geom/prep/PreparedGeometryFactory.h>
+#include <geos/util/ChunkedRange.h>
+
+#include <algorithm>
+#include <limits>
+
+using geos::geom::Envelope;
+using geos::geom::Geometry;
+using geos::geom::prep::PreparedGeometry;
+using geos::geom::prep::PreparedGeometryFactory;
+
+namespace geos {
+namespace operation { // geos.operation
+namespace distance { // geos.operation.distance
+
+namespace {
+
+// a row computes the distances to its nearby geometries, so a few
+// rows are worth a thread
+const std::size_t minRowsPerThread = 16;
+
+} // anonymous namespace
+
+DistanceMatrix::DistanceMatrix(const std::vector<const Geometry*>& p_geoms1,
+                               const std::vector<const Geometry*>& p_geoms2)
+    : geoms1(p_geoms1)
+    , geoms2(p_geoms2)
+    , maxDistance(std::numeric_limits<double>::infinity())
+    , numThreads(1)
+    , prepGeoms2(p_geoms2.size())
+    , prepFlags2(new std::once_flag[p_geoms2.size()])
+{
+    for(const Geometry*& g : geoms2) {
+        // the items are the elements of geoms2, to recover their index
+        if(!g->isEmpty()) {
+            index2.insert(g->getEnvelopeInternal(), &g);
+        }
+    }
+    // the tree is built before the rows query it concurrently
+    index2.build();
+}
+
+DistanceMatrix::~DistanceMatrix() = default;
+
+const PreparedGeometry*
+DistanceMatrix::getPrepared2(std::size_t j)
+{
+    std::call_once(prepFlags2[j], [this, j]() {
+        prepGeoms2[j] = PreparedGeometryFactory::prepare(geoms2[j]);
+    });
+    return prepGeoms2[j].get();
+}
+
+void
+DistanceMatrix::computeRow(std::size_t i, std::vector<void*>& candidates,
+                           std::vector<Entry>& entries)
+{
+    const Geometry* g1 = geoms1[i];
+    if(g1->isEmpty()) {
+        return;
+    }
+
+    const Envelope* env1 = g1->getEnvelopeInternal();
+    Envelope searchEnv(*env1);
+    searchEnv.expandBy(maxDistance);
+
+    candidates.clear();
+    index2.query(&searchEnv, candidates);
+
+    std::vector<std::size_t> indexes;
+    indexes.reserve(candidates.size());
+    for(void* item : candidates) {
+        indexes.push_back(static_cast<std::size_t>(static_cast<const Geometry**>(item) - geoms2.data()));
+    }
+    std::sort(indexes.begin(), indexes.end());
+
+    for(std::size_t j : indexes) {
+        const Geometry* g2 = geoms2[j];
+        // the expanded envelope also finds envelopes beyond the distance
+        // near its corners
+        if(env1->distance(*g2->getEnvelopeInternal()) > maxDistance) {
+            continue;
+        }
+        double d = getPrepared2(j)->distance(g1);
+        if(d <= maxDistance) {
+            entries.push_back({ i, j, d });
+        }
+    }
+}
+
+std::vector<DistanceMatrix::Entry>
+DistanceMatrix::getSparse()
+{
+    const util::ChunkedRange chunks(geoms1.size(), minRowsPerThread, numThreads);
+    std::vector<std::vector<Entry>> chunkEntries(chunks.getNumChunks());
+    chunks.run([&](std::size_t c, std::size_t begin, std::size_t end) {
+        std::vector<void*> candidates;
+        for(std::size_t i = begin; i < end; i++) {
+            computeRow(i, candidates, chunkEntries[c]);
+        }
+    });
+
+    // the chunks are in row order
+    std::vector<Entry> entries;
+    for(auto& chunk : chunkEntries) {
+        entries.insert(entries.end(), chunk.begin(), chunk.end());
+    }
+    return entries;
+}
+
+void
+DistanceMatrix::getDense(double* distances)
+{
+    const std::size_t n2 = geoms2.size();
+    const util::ChunkedRange chunks(geoms1.size(), minRowsPerThread, numThreads);
+    chunks.run([&](std::size_t, std::size_t begin, std::size_t end) {
+        std::vector<void*> candidates;
+        std::vector<Entry> entries;
+        for(std::size_t i = begin; i < end; i++) {
+            double* row = distances + i * n2;
+            std::fill(row, row + n2, std::numeric_limits<double>::infinity());
+            entries.clear();
+            computeRow(i, candidates, entries);
+            for(const Entry& e : entries) {
+                row[e.index2] = e.distance;
+            }
+        }
+    });
+}
+
+} // namespace geos.operation.distance
+} // namespace geos.operation
+} // namespace geos
@@ -35,8 +35,13 @@
 #include <geos/geom/util/PolygonExtracter.h>
 #include <geos/geom/util/LinearComponentExtracter.h>
 #include <geos/geom/util/PointExtracter.h>
+#include <geos/index/strtree/ItemDistance.h>
+#include <geos/index/strtree/STRtree.h>
 #include <geos/util/IllegalArgumentException.h>
 
+#include <algorithm>
+#include <array>
+#include <limits>
 #include <vector>
 #include <iostream>
 
@@ -55,6 +60,150 @@ namespace distance { // geos.operation.distance
 using namespace geom;
 //using namespace geom::util;
 
+namespace {
+
+/*
+ * Building and querying the index of the points costs about as much
+ * per point or segment as this many point-point or point-segment
+ * distance computations, so the facets are indexed when each is compared
+ * to more facets than that on average.
+ */
+const std::size_t POINT_INDEX_MIN_COMPARISONS = 2048;
+const std::size_t SEGMENT_INDEX_MIN_COMPARISONS = 512;
+
+bool
+isIndexed(std::size_t n0, std::size_t n1, std::size_t minComparisons)
+{
+    return n0 * n1 > minComparisons * (n0 + n1);
+}
+
+/*
+ * Slightly enlarges a search distance, so that rounding cannot exclude
+ * from the queries the facets at exactly that distance.
+ */
+double
+queryDistance(double searchDistance)
+{
+    return searchDistance * (1 + 1e-9);
+}
+
+/*
+ * Selects the pair a pairwise loop visiting the pairs in key order
+ * ends on, whatever the order the pairs are added in: the first within
+ * the terminating distance, or else the first at the minimum distance.
+ */
+class NearestPairSelector {
+public:
+    typedef std::array<std::size_t, 3> Key;
+
+    explicit NearestPairSelector(double p_terminateDistance)
+        : terminateDistance(p_terminateDistance)
+        , found(false)
+        , within(false)
+        , selectedDist(0.0)
+        , minDist(std::numeric_limits<double>::infinity())
+    {}
+
+    void
+    add(double dist, const Key& key)
+    {
+        minDist = std::min(minDist, dist);
+        bool isWithin = dist <= terminateDistance;
+        if(found) {
+            if(isWithin != within) {
+                if(!isWithin) {
+                    return;
+                }
+            }
+            else if(!isWithin && dist != selectedDist) {
+                if(dist > selectedDist) {
+                    return;
+                }
+            }
+            else if(!(key < selectedKey)) {
+                return;
+            }
+        }
+        found = true;
+        within = isWithin;
+        selectedDist = dist;
+        selectedKey = key;
+    }
+
+    /*
+     * The distance below which pairs may still be selected, given
+     * the distance of a pair still to be added.
+     */
+    double
+    searchDistance(double pairDist) const
+    {
+        return std::max(terminateDistance, std::min(minDist, pairDist));
+    }
+
+    bool isFound() const { return found; }
+    bool isWithin() const { return within; }
+    double getDistance() const { return selectedDist; }
+    const Key& getKey() const { return selectedKey; }
+
+private:
+    double terminateDistance;
+    bool found;
+    bool within;
+    double selectedDist;
+    Key selectedKey;
+    double minDist;
+};
+
+// Tree items are elements of a Point vector, query items Coordinates
+class PointCoordinateDistance : public index::strtree::ItemDistance {
+public:
+    double
+    distance(const index::strtree::ItemBoundable* item1,
+             const index::strtree::ItemBoundable* item2) override
+    {
+        const Point* pt = *static_cast<const Point* const*>(item1->getItem());
+        const Coordinate* coord = static_cast<const Coordinate*>(item2->getItem());
+        return pt->getCoordinate()->distance(*coord);
+    }
+};
+
+/*
+ * Builds an STRtree of the non-empty points, whose items are the
+ * elements of the vector.
+ */
+std::size_t
+insertPoints(const Point::ConstVect& points, index::strtree::STRtree& tree)
+{
+    std::size_t numPoints = 0;
+    for(const Point* const& pt : points) {
+        if(!pt->isEmpty()) {
+            tree.insert(pt->getEnvelopeInternal(), const_cast<const Point**>(&pt));
+            numPoints++;
+        }
+    }
+    if(numPoints > 0) {
+        tree.build();
+    }
+    return numPoints;
+}
+
+// the nearest point to a coordinate, in a tree of insertPoints
+const Point*
+nearestPoint(index::strtree::STRtree& tree, const Coordinate& coord)
+{
+    PointCoordinateDistance itemDist;
+    Envelope env(coord);
+    const void* item = tree.nearestNeighbour(&env, &coord, &itemDist);
+    return *static_cast<const Point* const*>(item);
+}
+
+std::size_t
+pointIndex(const Point::ConstVect& points, const void* item)
+{
+    return static_cast<std::size_t>(static_cast<const Point* const*>(item) - points.data());
+}
+} // anonymous namespace
+
 /*public static (deprecated)*/
 double
 DistanceOp::distance(const Geometry* g0, const Geometry* g1)
@@ -377,6 +526,11 @@ DistanceOp::computeMinDistancePoints(
     const Point::ConstVect& points1,
     std::array<std::unique_ptr<GeometryLocation>, 2> & locGeom)
 {
+    if(isIndexed(points0.size(), points1.size(), POINT_INDEX_MIN_COMPARISONS)) {
+        computeMinDistancePointsIndexed(points0, points1, locGeom);
+        return;
+    }
+
     for(const Point* pt0 : points0) {
         for(const Point* pt1 : points1) {
             double dist = pt0->getCoordinate()->distance(*(pt1->getCoordinate()));
@@ -410,6 +564,16 @@ DistanceOp::computeMinDistanceLinesPoints(
     const Point::ConstVect& points,
     std::array<std::unique_ptr<GeometryLocation>, 2> & locGeom)
 {
+    std::size_t numSegments = 0;
+    for(const LineString* line : lines) {
+        std::size_t npts = line->getNumPoints();
+        numSegments += npts > 0 ? npts - 1 : 0;
+    }
+    if(isIndexed(numSegments, points.size(), SEGMENT_INDEX_MIN_COMPARISONS)) {
+        computeMinDistanceLinesPointsIndexed(lines, points, locGeom);
+        return;
+    }
+
     for(const LineString* line : lines) {
         for(const Point* pt : points) {
             computeMinDistance(line, pt, locGeom);
@@ -420,6 +584,123 @@ DistanceOp::computeMinDistanceLinesPoints(
     }
 }
 
+/*
+ * The indexed computations find, for each facet of one side, the
+ * facets of the other side within the distance of a nearby pair, and
+ * select among these pairs the one the pairwise loops end on.
+ */
+
+/*private*/
+void
+DistanceOp::computeMinDistancePointsIndexed(
+    const Point::ConstVect& points0,
+    const Point::ConstVect& points1,
+    std::array<std::unique_ptr<GeometryLocation>, 2> & locGeom)
+{
+    index::strtree::STRtree tree1;
+    if(insertPoints(points1, tree1) == 0) {
+        return;
+    }
+
+    NearestPairSelector selector(terminateDistance);
+    std::vector<void*> candidates;
+    for(std::size_t i = 0; i < points0.size(); i++) {
+        const Point* pt0 = points0[i];
+        if(pt0->isEmpty()) {
+            continue;
+        }
+        const Coordinate* coord0 = pt0->getCoordinate();
+        double nearestDist = nearestPoint(tree1, *coord0)->getCoordinate()->distance(*coord0);
+        double searchDistance = selector.searchDistance(nearestDist);
+        if(nearestDist > searchDistance) {
+            continue;
+        }
+
+        Envelope searchEnv(*coord0);
+        searchEnv.expandBy(queryDistance(searchDistance));
+        candidates.clear();
+        tree1.query(&searchEnv, candidates);
+        for(const void* item : candidates) {
+            std::size_t j = pointIndex(points1, item);
+            selector.add(coord0->distance(*(points1[j]->getCoordinate())), {{ i, j, 0 }});
+        }
+
+        // the later points come after the selected pair
+        if(selector.isWithin()) {
+            break;
+        }
+    }
+
+    if(!selector.isFound() || (!selector.isWithin() && selector.getDistance() >= minDistance)) {
+        return;
+    }
+    const Point* pt0 = points0[selector.getKey()[0]];
+    const Point* pt1 = points1[selector.getKey()[1]];
+    minDistance = selector.getDistance();
+    locGeom[0].reset(new GeometryLocation(pt0, 0, *(pt0->getCoordinate())));
+    locGeom[1].reset(new GeometryLocation(pt1, 0, *(pt1->getCoordinate())));
+}
+
+/*private*/
+void
+DistanceOp::computeMinDistanceLinesPointsIndexed(
+    const LineString::ConstVect& lines,
+    const Point::ConstVect& points,
+    std::array<std::unique_ptr<GeometryLocation>, 2> & locGeom)
+{
+    using geos::algorithm::Distance;
+
+    index::strtree::STRtree ptTree;
+    if(insertPoints(points, ptTree) == 0) {
+        return;
+    }
+
+    // the pairwise loop visits the pairs by line, point, then segment
+    NearestPairSelector selector(terminateDistance);
+    std::vector<void*> candidates;
+    for(std::size_t l = 0; l < lines.size(); l++) {
+        const CoordinateSequence* seq = lines[l]->getCoordinatesRO();
+        for(std::size_t i = 1; i < seq->getSize(); i++) {
+            const Coordinate& p0 = seq->getAt(i - 1);
+            const Coordinate& p1 = seq->getAt(i);
+
+            Coordinate mid((p0.x + p1.x) / 2, (p0.y + p1.y) / 2);
+            const Point* nearest = nearestPoint(ptTree, mid);
+            double nearestDist = Distance::pointToSegment(*(nearest->getCoordinate()), p0, p1);
+
+            Envelope searchEnv(p0, p1);
+            searchEnv.expandBy(queryDistance(selector.searchDistance(nearestDist)));
+            candidates.clear();
+            ptTree.query(&searchEnv, candidates);
+            for(const void* item : candidates) {
+                std::size_t j = pointIndex(points, item);
+                double dist = Distance::pointToSegment(*(points[j]->getCoordinate()), p0, p1);
+                selector.add(dist, {{ l, j, i - 1 }});
+            }
+        }
+
+        // the later lines come after the selected pair
+        if(selector.isWithin()) {
+            break;
+        }
+    }
+
+    if(!selector.isFound() || (!selector.isWithin() && selector.getDistance() >= minDistance)) {
+        return;
+    }
+    const LineString* line = lines[selector.getKey()[0]];
+    const Point* pt = points[selector.getKey()[1]];
+    std::size_t segIndex = selector.getKey()[2];
+    const CoordinateSequence* seq = line->getCoordinatesRO();
+    LineSegment seg(seq->getAt(segIndex), seq->getAt(segIndex + 1));
+    Coordinate segClosestPoint;
+    seg.closestPoint(*(pt->getCoordinate()), segClosestPoint);
+
+    minDistance = selector.getDistance();
+    locGeom[0].reset(new GeometryLocation(line, segIndex, segClosestPoint));
+    locGeom[1].reset(new GeometryLocation(pt, 0, *(pt->getCoordinate())));
+}
+
 /*private*/
 void
 DistanceOp::computeMinDistance(
@@ -527,6 +808,18 @@ DistanceOp::isWithinDistance(const geom::Geometry& g0,
                              const geom::Geometry& g1,
                              double distance)
 {
+    if(g0.isEmpty() || g1.isEmpty()) {
+        return false;
+    }
+
+    // check envelope distance for a short-circuit negative result
+    const Envelope* env0 = g0.getEnvelopeInternal();
+    const Envelope* env1 = g1.getEnvelopeInternal();
+    if(env0->distance(*env1) > distance) {
+        return false;
+    }
+
+    // the search stops at the first locations within the distance
     DistanceOp distOp(g0, g1, distance);
     return distOp.distance() <= distance;
 }
@@ -20,6 +20,13 @@
 #include <geos/geom/LineString.h>
 #include <geos/geom/Point.h>
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+
 using namespace geos::geom;
 using namespace geos::index::strtree;
 
@@ -27,10 +34,70 @@ namespace geos {
 namespace operation {
 namespace distance {
 
-std::unique_ptr<STRtree>
+namespace {
+
+/*
+ * Lowers minDist to the distance from a point to the nearest facet
+ * under a node, if it is nearer, and sets nearest to that facet.
+ * The children are visited nearest first and skipped once their
+ * envelope is no nearer than minDist, which prunes as well as the
+ * branch-and-bound search of STRtree without allocating a pair of
+ * boundables for each node visited. The children of the nodes on the
+ * current path are stacked in candidates, so the whole search
+ * allocates at most once.
+ * The search stops once minDist is no more than stopDistance.
+ */
+void
+searchNearestFacet(const AbstractNode& node, const FacetSequence& pointFacet,
+                   double stopDistance, double& minDist, const FacetSequence*& nearest,
+                   std::vector<std::pair<double, const Boundable*>>& candidates)
+{
+    const Coordinate& p = *pointFacet.getCoordinate(0);
+    const std::size_t begin = candidates.size();
+    for(const Boundable* child : *node.getChildBoundables()) {
+        const Envelope* env = static_cast<const Envelope*>(child->getBounds());
+        const double dx = std::max({ env->getMinX() - p.x, p.x - env->getMaxX(), 0.0 });
+        const double dy = std::max({ env->getMinY() - p.y, p.y - env->getMaxY(), 0.0 });
+        const double envDist = std::sqrt(dx * dx + dy * dy);
+        if(envDist < minDist) {
+            candidates.emplace_back(envDist, child);
+        }
+    }
+    const std::size_t end = candidates.size();
+    std::sort(candidates.begin() + static_cast<std::ptrdiff_t>(begin), candidates.end(),
+    [](const std::pair<double, const Boundable*>& a, const std::pair<double, const Boundable*>& b) {
+        return a.first < b.first;
+    });
+
+    for(std::size_t i = begin; i < end; i++) {
+        // copied, as the recursion may reallocate the candidates
+        const std::pair<double, const Boundable*> child = candidates[i];
+        if(child.first >= minDist || minDist <= stopDistance) {
+            break;
+        }
+        if(child.second->isLeaf()) {
+            const ItemBoundable* item = static_cast<const ItemBoundable*>(child.second);
+            const FacetSequence* fs = static_cast<const FacetSequence*>(item->getItem());
+            double dist = fs->distance(pointFacet);
+            if(dist < minDist) {
+                minDist = dist;
+                nearest = fs;
+            }
+        }
+        else {
+            searchNearestFacet(*static_cast<const AbstractNode*>(child.second), pointFacet,
+                               stopDistance, minDist, nearest, candidates);
+        }
+    }
+    candidates.resize(begin);
+}
+
+} // anonymous namespace
+
+std::unique_ptr<FacetSequenceTreeBuilder::FacetSequenceTree>
 FacetSequenceTreeBuilder::build(const Geometry* g)
 {
-    auto tree = std::unique_ptr<STRtree>(new FacetSequenceTree(computeFacetSequences(g)));
+    auto tree = std::unique_ptr<FacetSequenceTree>(new FacetSequenceTree(computeFacetSequences(g)));
 
     tree->build();
     return tree;
@@ -87,7 +154,30 @@ FacetSequenceTreeBuilder::addFacetSequences(const Geometry* geom, const Coordina
     }
 }
 
+double
+FacetSequenceTreeBuilder::FacetSequenceTree::nearestFacetDistance(const FacetSequence& pointFacet,
+        double stopDistance)
+{
+    double minDist;
+    nearestFacet(pointFacet, stopDistance, minDist);
+    return minDist;
 }
-}
+
+const FacetSequence*
+FacetSequenceTreeBuilder::FacetSequenceTree::nearestFacet(const FacetSequence& pointFacet,
+        double stopDistance, double& minDist)
+{
+    minDist = std::numeric_limits<double>::infinity();
+    const FacetSequence* nearest = nullptr;
+    const AbstractNode* rootNode = getRoot();
+    if(rootNode->getBounds() != nullptr) {
+        std::vector<std::pair<double, const Boundable*>> candidates;
+        candidates.reserve(64);
+        searchNearestFacet(*rootNode, pointFacet, stopDistance, minDist, nearest, candidates);
+    }
+    return nearest;
 }
 
+}
+}
+}
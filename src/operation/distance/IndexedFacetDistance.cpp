@@ -17,6 +17,7 @@
  **********************************************************************/
 
 #include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateArraySequence.h>
 #include <geos/index/strtree/STRtree.h>
 #include <geos/operation/distance/IndexedFacetDistance.h>
 
@@ -27,6 +28,19 @@ namespace geos {
 namespace operation {
 namespace distance {
 
+namespace {
+
+struct FacetSequenceDistance : public ItemDistance {
+    double
+    distance(const ItemBoundable* item1, const ItemBoundable* item2) override
+    {
+        return static_cast<const FacetSequence*>(item1->getItem())->distance(*static_cast<const FacetSequence*>
+                (item2->getItem()));
+    }
+};
+
+} // anonymous namespace
+
 /*public static*/
 double
 IndexedFacetDistance::distance(const Geometry* g1, const Geometry* g2)
@@ -46,14 +60,7 @@ IndexedFacetDistance::nearestPoints(const geom::Geometry* g1, const geom::Geomet
 double
 IndexedFacetDistance::distance(const Geometry* g) const
 {
-    struct : public ItemDistance {
-        double
-        distance(const ItemBoundable* item1, const ItemBoundable* item2) override
-        {
-            return static_cast<const FacetSequence*>(item1->getItem())->distance(*static_cast<const FacetSequence*>
-                    (item2->getItem()));
-        }
-    } itemDistance;
+    FacetSequenceDistance itemDistance;
 
     std::unique_ptr<STRtree> tree2(FacetSequenceTreeBuilder::build(g));
 
@@ -68,17 +75,45 @@ IndexedFacetDistance::distance(const Geometry* g) const
     return p_distance;
 }
 
+double
+IndexedFacetDistance::distance(const Coordinate& p) const
+{
+    CoordinateArraySequence pts(1u, 2u);
+    pts.setAt(p, 0);
+    FacetSequence pointFacet(&pts, 0, 1);
+
+    return cachedTree->nearestFacetDistance(pointFacet);
+}
+
+bool
+IndexedFacetDistance::isWithinDistance(const Geometry* g, double maxDistance) const
+{
+    if(baseGeometry->isEmpty() || g->isEmpty()) {
+        return false;
+    }
+
+    // short-circuit check
+    double envDist = baseGeometry->getEnvelopeInternal()->distance(*g->getEnvelopeInternal());
+    if(envDist > maxDistance) {
+        return false;
+    }
+
+    if(g->getGeometryTypeId() == GEOS_POINT) {
+        CoordinateArraySequence pts(1u, 2u);
+        pts.setAt(*g->getCoordinate(), 0);
+        FacetSequence pointFacet(&pts, 0, 1);
+        return cachedTree->nearestFacetDistance(pointFacet, maxDistance) <= maxDistance;
+    }
+
+    FacetSequenceDistance itemDistance;
+    std::unique_ptr<STRtree> tree2(FacetSequenceTreeBuilder::build(g));
+    return cachedTree->isWithinDistance(tree2.get(), &itemDistance, maxDistance);
+}
+
 std::vector<GeometryLocation>
 IndexedFacetDistance::nearestLocations(const geom::Geometry* g) const
 {
-    struct : public ItemDistance {
-        double
-        distance(const ItemBoundable* item1, const ItemBoundable* item2) override
-        {
-            return static_cast<const FacetSequence*>(item1->getItem())->distance(*static_cast<const FacetSequence*>
-                    (item2->getItem()));
-        }
-    } itemDistance;
+    FacetSequenceDistance itemDistance;
     std::unique_ptr<STRtree> tree2(FacetSequenceTreeBuilder::build(g));
     std::pair<const void*, const void*> obj = cachedTree->nearestNeighbour(tree2.get(),
             dynamic_cast<ItemDistance*>(&itemDistance));
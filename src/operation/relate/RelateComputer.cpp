@@ -24,7 +24,9 @@
 #include <geos/operation/relate/EdgeEndBuilder.h>
 #include <geos/algorithm/LineIntersector.h>
 #include <geos/algorithm/PointLocator.h>
+#include <geos/algorithm/locate/PointOnGeometryLocator.h>
 #include <geos/geom/IntersectionMatrix.h>
+#include <geos/geom/Dimension.h>
 #include <geos/geom/Geometry.h>
 #include <geos/geom/Envelope.h>
 #include <geos/geomgraph/index/SegmentIntersector.h>
@@ -39,6 +41,7 @@
 #include <geos/util/Interrupt.h>
 #include <geos/util.h>
 
+#include <algorithm>
 #include <vector>
 #include <cassert>
 
@@ -62,8 +65,17 @@ namespace relate { // geos.operation.relate
 RelateComputer::RelateComputer(std::vector<GeometryGraph*>* newArg):
     arg(newArg),
     nodes(RelateNodeFactory::instance()),
-    im(new IntersectionMatrix())
+    im(new IntersectionMatrix()),
+    requiredPattern(nullptr)
 {
+    locators[0] = nullptr;
+    locators[1] = nullptr;
+}
+
+void
+RelateComputer::setLocator(int argIndex, algorithm::locate::PointOnGeometryLocator* locator)
+{
+    locators[argIndex] = locator;
 }
 
 std::unique_ptr<IntersectionMatrix>
@@ -79,15 +91,31 @@ RelateComputer::computeIM()
         return std::move(im);
     }
 
+    // the dimensions of the geometries may decide the pattern
+    if(isDecided(*im)) {
+        return std::move(im);
+    }
+
 #if GEOS_DEBUG
     std::cerr << "RelateComputer::computeIM: "
               << "computing self nodes 1"
               << std::endl;
 #endif
 
-    std::unique_ptr<SegmentIntersector> si1(
-        (*arg)[0]->computeSelfNodes(&li, false)
-    );
+    /*
+     * Only the edges within the envelope intersection can interact.
+     * The self-nodes outside it only add dimension 0 entries with the
+     * exterior of the other geometry, which the edges through them
+     * already set to a higher dimension, so they are not computed.
+     */
+    Envelope env;
+    e1->intersection(*e2, env);
+
+    // a graph may come with its self-nodes already added
+    std::unique_ptr<SegmentIntersector> si1;
+    if(!(*arg)[0]->hasSelfNodes()) {
+        si1 = (*arg)[0]->computeSelfNodes(&li, false, &env);
+    }
 
     GEOS_CHECK_FOR_INTERRUPTS();
 
@@ -97,9 +125,10 @@ RelateComputer::computeIM()
               << std::endl;
 #endif
 
-    std::unique_ptr<SegmentIntersector> si2(
-        (*arg)[1]->computeSelfNodes(&li, false)
-    );
+    std::unique_ptr<SegmentIntersector> si2;
+    if(!(*arg)[1]->hasSelfNodes()) {
+        si2 = (*arg)[1]->computeSelfNodes(&li, false, &env);
+    }
 
     GEOS_CHECK_FOR_INTERRUPTS();
 
@@ -109,13 +138,24 @@ RelateComputer::computeIM()
               << std::endl;
 #endif
 
-    // compute intersections between edges of the two input geometries
+    // compute intersections between edges of the two input geometries,
+    // up to the first proper one if that decides the pattern
     std::unique_ptr< SegmentIntersector> intersector(
-        (*arg)[0]->computeEdgeIntersections((*arg)[1], &li, false)
+        (*arg)[0]->computeEdgeIntersections((*arg)[1], &li, false,
+                                            isDecidedByProperIntersection(), &env)
     );
 
     GEOS_CHECK_FOR_INTERRUPTS();
 
+    /*
+     * If a proper intersection was found, we can set a lower bound
+     * on the IM.
+     */
+    computeProperIntersectionIM(intersector.get(), im.get());
+    if(isDecided(*im)) {
+        return std::move(im);
+    }
+
 #if GEOS_DEBUG
     std::cerr << "RelateComputer::computeIM: "
               << "copying intersection nodes"
@@ -159,18 +199,6 @@ RelateComputer::computeIM()
     labelIsolatedNodes();
     //Debug.printWatch();
 
-#if GEOS_DEBUG
-    std::cerr << "RelateComputer::computeIM: "
-              << "computing proper intersection matrix"
-              << std::endl;
-#endif
-
-    /*
-     * If a proper intersection was found, we can set a lower bound
-     * on the IM.
-     */
-    computeProperIntersectionIM(intersector.get(), im.get());
-
 #if GEOS_DEBUG
     std::cerr << "RelateComputer::computeIM: "
               << "computing improper intersections"
@@ -231,6 +259,101 @@ RelateComputer::computeIM()
     return std::move(im);
 }
 
+bool
+RelateComputer::matches(const std::string& pattern)
+{
+    requiredPattern = &pattern;
+    std::unique_ptr<IntersectionMatrix> imX = computeIM();
+    requiredPattern = nullptr;
+    // a partial matrix is only returned when it decides the pattern
+    return imX->matches(pattern);
+}
+
+/* private */
+bool
+RelateComputer::isDecided(const IntersectionMatrix& imX) const
+{
+    if(requiredPattern == nullptr || requiredPattern->size() != 9) {
+        return false;
+    }
+
+    // upper bounds of the dimensions of the interior, boundary and
+    // exterior of each geometry, under any boundary node rule
+    int maxDim[2][3];
+    for(int i = 0; i < 2; i++) {
+        const Geometry* g = (*arg)[i]->getGeometry();
+        const int dim = g->isEmpty() ? Dimension::False : g->getDimension();
+        maxDim[i][0] = dim;
+        maxDim[i][1] = dim - 1 >= 0 ? dim - 1 : Dimension::False;
+        maxDim[i][2] = Dimension::A;
+    }
+
+    bool isSatisfied = true;
+    for(int ai = 0; ai < 3; ai++) {
+        for(int bi = 0; bi < 3; bi++) {
+            const char c = (*requiredPattern)[static_cast<std::size_t>(3 * ai + bi)];
+            if(c == '*') {
+                continue;
+            }
+            // the final value is between these bounds
+            const int lower = imX.get(static_cast<Location>(ai), static_cast<Location>(bi));
+            const int upper = std::min(maxDim[0][ai], maxDim[1][bi]);
+            if(c == 'T') {
+                if(upper == Dimension::False) {
+                    return true;
+                }
+                isSatisfied &= lower >= 0;
+            }
+            else if(c == 'F') {
+                if(lower >= 0) {
+                    return true;
+                }
+                isSatisfied &= upper == Dimension::False;
+            }
+            else if(c >= '0' && c <= '2') {
+                const int d = c - '0';
+                if(lower > d || upper < d) {
+                    return true;
+                }
+                isSatisfied &= lower == d && upper == d;
+            }
+            else {
+                // left to IntersectionMatrix::matches
+                return false;
+            }
+        }
+    }
+    return isSatisfied;
+}
+
+/* private */
+bool
+RelateComputer::isDecidedByProperIntersection() const
+{
+    if(requiredPattern == nullptr) {
+        return false;
+    }
+
+    // the lower bound computeProperIntersectionIM sets for a proper
+    // intersection, which may not be an interior one
+    int dimA = (*arg)[0]->getGeometry()->getDimension();
+    int dimB = (*arg)[1]->getGeometry()->getDimension();
+    IntersectionMatrix imX(*im);
+    if(dimA == 2 && dimB == 2) {
+        imX.setAtLeast("212101212");
+    }
+    else if(dimA == 2 && dimB == 1) {
+        imX.setAtLeast("FFF0FFFF2");
+    }
+    else if(dimA == 1 && dimB == 2) {
+        imX.setAtLeast("F0FFFFFF2");
+    }
+    else {
+        return false;
+    }
+    return isDecided(imX);
+}
+
 void
 RelateComputer::insertEdgeEnds(std::vector<EdgeEnd*>* ee)
 {
@@ -451,7 +574,9 @@ RelateComputer::labelIsolatedEdge(Edge* e, int targetIndex, const Geometry* targ
         // since edge is not in boundary, may not need the full generality of PointLocator?
         // Possibly should use ptInArea locator instead?  We probably know here
         // that the edge does not touch the bdy of the target Geometry
-        Location loc = ptLocator.locate(e->getCoordinate(), target);
+        Location loc = locators[targetIndex]
+                       ? locators[targetIndex]->locate(&e->getCoordinate())
+                       : ptLocator.locate(e->getCoordinate(), target);
         e->getLabel().setAllLocations(targetIndex, loc);
     }
     else {
@@ -484,8 +609,10 @@ RelateComputer::labelIsolatedNodes()
 void
 RelateComputer::labelIsolatedNode(Node* n, int targetIndex)
 {
-    Location loc = ptLocator.locate(n->getCoordinate(),
-                               (*arg)[targetIndex]->getGeometry());
+    Location loc = locators[targetIndex]
+                   ? locators[targetIndex]->locate(&n->getCoordinate())
+                   : ptLocator.locate(n->getCoordinate(),
+                                      (*arg)[targetIndex]->getGeometry());
     n->getLabel().setAllLocations(targetIndex, loc);
     //debugPrintln(n.getLabel());
 }
@@ -50,6 +50,14 @@ RelateOp::relate(const Geometry* a, const Geometry* b,
     return relOp.getIntersectionMatrix();
 }
 
+bool
+RelateOp::relate(const Geometry* a, const Geometry* b,
+                 const std::string& pattern)
+{
+    RelateOp relOp(a, b);
+    return relOp.matches(pattern);
+}
+
 RelateOp::RelateOp(const Geometry* g0, const Geometry* g1):
     GeometryGraphOperation(g0, g1),
     relateComp(&arg)
@@ -70,7 +78,12 @@ RelateOp::getIntersectionMatrix()
     return relateComp.computeIM();
 }
 
+bool
+RelateOp::matches(const std::string& pattern)
+{
+    return relateComp.matches(pattern);
+}
+
 } // namespace geos.operation.relate
 } // namespace geos.operation
 } // namespace geos
-
@@ -20,6 +20,8 @@
 #include <geos/geom/Coordinate.h>
 #include <geos/geom/LineSegment.h>
 
+#include <algorithm>
+#include <limits>
 #include <vector>
 #include <memory> // for unique_ptr
 
@@ -39,6 +41,56 @@ DouglasPeuckerLineSimplifier::simplify(
     return simp.simplify();
 }
 
+/*public static*/
+std::vector<double>
+DouglasPeuckerLineSimplifier::computeEffectiveTolerances(
+    const DouglasPeuckerLineSimplifier::CoordsVect& nPts)
+{
+    const double inf = std::numeric_limits<double>::infinity();
+    std::vector<double> tolerances(nPts.size(), inf);
+    if(nPts.size() < 3) {
+        return tolerances;
+    }
+
+    // Walk the same sections as simplifySection() at zero tolerance.
+    // A vertex is kept only if it and all the vertices which split
+    // the enclosing sections are further than the tolerance.
+    struct Section {
+        std::size_t i;
+        std::size_t j;
+        double parentTolerance;
+    };
+    std::vector<Section> stack;
+    stack.push_back(Section{0, nPts.size() - 1, inf});
+
+    while(!stack.empty()) {
+        Section s = stack.back();
+        stack.pop_back();
+
+        if((s.i + 1) >= s.j) {
+            continue;
+        }
+
+        geos::geom::LineSegment seg(nPts[s.i], nPts[s.j]);
+        double maxDistance = -1.0;
+        std::size_t maxIndex = s.i + 1;
+        for(std::size_t k = s.i + 1; k < s.j; k++) {
+            double distance = seg.distance(nPts[k]);
+            if(distance > maxDistance) {
+                maxDistance = distance;
+                maxIndex = k;
+            }
+        }
+
+        double tolerance = std::min(maxDistance, s.parentTolerance);
+        tolerances[maxIndex] = tolerance;
+        stack.push_back(Section{s.i, maxIndex, tolerance});
+        stack.push_back(Section{maxIndex, s.j, tolerance});
+    }
+
+    return tolerances;
+}
+
 /*public*/
 DouglasPeuckerLineSimplifier::DouglasPeuckerLineSimplifier(
     const DouglasPeuckerLineSimplifier::CoordsVect& nPts)
@@ -23,7 +23,11 @@
 #include <geos/index/ItemVisitor.h>
 #include <geos/geom/LineSegment.h>
 #include <geos/geom/Envelope.h>
+#include <geos/shape/fractal/HilbertEncoder.h>
 
+#include <algorithm>
+#include <cstdint>
+#include <utility>
 #include <vector>
 #include <memory> // for unique_ptr
 #include <cassert>
@@ -110,11 +114,27 @@ public:
 };
 
 
+const std::size_t LineSegmentIndex::nodeCapacity;
+const std::size_t LineSegmentIndex::maxStackSize;
+
+/*public*/
+LineSegmentIndex::LineSegmentIndex()
+    :
+    built(false),
+    count(0),
+    overflowCount(0)
+{
+}
+
 /*public*/
 void
 LineSegmentIndex::add(const TaggedLineString& line)
 {
-    for(const LineSegment* seg : line.getSegments()) {
+    const std::vector<TaggedLineSegment*>& segs = line.getSegments();
+    if(!built) {
+        pending.reserve(pending.size() + segs.size());
+    }
+    for(const LineSegment* seg : segs) {
         add(seg);
     }
 }
@@ -123,11 +143,19 @@ LineSegmentIndex::add(const TaggedLineString& line)
 void
 LineSegmentIndex::add(const LineSegment* seg)
 {
+    ++count;
+
+    if(!built) {
+        pending.push_back(seg);
+        return;
+    }
+
     std::unique_ptr<Envelope> env{new Envelope(seg->p0, seg->p1)};
 
     // We need a cast because index wants a non-const,
     // although it won't change the argument
-    index.insert(env.get(), const_cast<LineSegment*>(seg));
+    overflow.insert(env.get(), const_cast<LineSegment*>(seg));
+    ++overflowCount;
 
     newEnvelopes.push_back(std::move(env));
 }
@@ -136,25 +164,228 @@ LineSegmentIndex::add(const LineSegment* seg)
 void
 LineSegmentIndex::remove(const LineSegment* seg)
 {
+    build();
+
+    if(removePacked(seg)) {
+        --count;
+        return;
+    }
+
     Envelope env(seg->p0, seg->p1);
 
     // We need a cast because index wants a non-const
     // although it won't change the argument
-    index.remove(&env, const_cast<LineSegment*>(seg));
+    if(overflow.remove(&env, const_cast<LineSegment*>(seg))) {
+        --count;
+        --overflowCount;
+    }
 }
 
 /*public*/
 std::unique_ptr< std::vector<LineSegment*> >
 LineSegmentIndex::query(const LineSegment* querySeg)
 {
-    Envelope env(querySeg->p0, querySeg->p1);
+    std::unique_ptr< std::vector<LineSegment*> > itemsFound(new std::vector<LineSegment*>());
+    query(querySeg, *itemsFound);
+    return itemsFound;
+}
 
-    LineSegmentVisitor visitor(querySeg);
-    index.query(&env, visitor);
+/*public*/
+void
+LineSegmentIndex::query(const LineSegment* querySeg,
+                        std::vector<LineSegment*>& result)
+{
+    build();
+
+    const PackedBox queryBox = boxOf(querySeg);
+
+    if(!boxes.empty() && liveCount.back() > 0 && boxes.back().intersects(queryBox)) {
+        // Depth-first traversal of the packed tree, starting at the root
+        std::size_t stack[maxStackSize];
+        std::size_t level[maxStackSize];
+        std::size_t top = 0;
+        stack[top] = boxes.size() - 1;
+        level[top] = levelStart.size() - 2;
+        ++top;
+
+        while(top > 0) {
+            --top;
+            const std::size_t node = stack[top];
+            const std::size_t lvl = level[top];
+
+            if(lvl == 0) {
+                result.push_back(const_cast<LineSegment*>(leafSegs[node]));
+                continue;
+            }
+
+            const std::size_t first = levelStart[lvl - 1] + (node - levelStart[lvl]) * nodeCapacity;
+            const std::size_t last = std::min(first + nodeCapacity, levelStart[lvl]);
+            for(std::size_t child = first; child < last; ++child) {
+                if(liveCount[child] > 0 && boxes[child].intersects(queryBox)) {
+                    stack[top] = child;
+                    level[top] = lvl - 1;
+                    ++top;
+                }
+            }
+        }
+    }
 
-    std::unique_ptr< std::vector<LineSegment*> > itemsFound = visitor.getItems();
+    if(overflowCount > 0) {
+        Envelope env(querySeg->p0, querySeg->p1);
+        LineSegmentVisitor visitor(querySeg);
+        overflow.query(&env, visitor);
+        std::unique_ptr< std::vector<LineSegment*> > items = visitor.getItems();
+        result.insert(result.end(), items->begin(), items->end());
+    }
+}
 
-    return itemsFound;
+/*private static*/
+LineSegmentIndex::PackedBox
+LineSegmentIndex::boxOf(const LineSegment* seg)
+{
+    PackedBox box;
+    box.minx = std::min(seg->p0.x, seg->p1.x);
+    box.maxx = std::max(seg->p0.x, seg->p1.x);
+    box.miny = std::min(seg->p0.y, seg->p1.y);
+    box.maxy = std::max(seg->p0.y, seg->p1.y);
+    return box;
+}
+
+/*public*/
+void
+LineSegmentIndex::build()
+{
+    if(built) {
+        return;
+    }
+    built = true;
+
+    if(pending.empty()) {
+        return;
+    }
+
+    // Sort segments along a Hilbert curve over the extent of the
+    // segment midpoints, so consecutive leaves are spatially close
+    Envelope extent;
+    for(const LineSegment* seg : pending) {
+        extent.expandToInclude(seg->p0);
+        extent.expandToInclude(seg->p1);
+    }
+    // The encoder requires a non-degenerate extent
+    if(extent.getWidth() == 0.0 || extent.getHeight() == 0.0) {
+        extent.expandBy(1.0);
+    }
+
+    shape::fractal::HilbertEncoder encoder(12, extent);
+    std::vector<std::pair<uint32_t, const LineSegment*>> keyed;
+    keyed.reserve(pending.size());
+    for(const LineSegment* seg : pending) {
+        Envelope env(seg->p0, seg->p1);
+        keyed.emplace_back(encoder.encode(&env), seg);
+    }
+    std::stable_sort(keyed.begin(), keyed.end(),
+                     [](const std::pair<uint32_t, const LineSegment*>& a,
+                        const std::pair<uint32_t, const LineSegment*>& b) {
+                         return a.first < b.first;
+                     });
+
+    const std::size_t n = keyed.size();
+    std::vector<const LineSegment*>().swap(pending);
+
+    // Count nodes over all levels to size the arrays once
+    std::size_t numNodes = n;
+    for(std::size_t levelSize = n; levelSize > 1; ) {
+        levelSize = (levelSize + nodeCapacity - 1) / nodeCapacity;
+        numNodes += levelSize;
+    }
+
+    boxes.reserve(numNodes);
+    liveCount.reserve(numNodes);
+    leafSegs.reserve(n);
+
+    levelStart.push_back(0);
+    for(const auto& k : keyed) {
+        boxes.push_back(boxOf(k.second));
+        liveCount.push_back(1);
+        leafSegs.push_back(k.second);
+    }
+    levelStart.push_back(n);
+
+    // Build the upper levels bottom-up; children of node i in a level
+    // are the nodeCapacity consecutive nodes starting at i * nodeCapacity
+    // in the level below.
+    std::size_t levelBegin = 0;
+    std::size_t levelEnd = n;
+    while(levelEnd - levelBegin > 1) {
+        for(std::size_t i = levelBegin; i < levelEnd; i += nodeCapacity) {
+            const std::size_t last = std::min(i + nodeCapacity, levelEnd);
+            PackedBox box = boxes[i];
+            std::size_t live = 0;
+            for(std::size_t j = i; j < last; ++j) {
+                const PackedBox& b = boxes[j];
+                box.minx = std::min(box.minx, b.minx);
+                box.miny = std::min(box.miny, b.miny);
+                box.maxx = std::max(box.maxx, b.maxx);
+                box.maxy = std::max(box.maxy, b.maxy);
+                live += liveCount[j];
+            }
+            boxes.push_back(box);
+            liveCount.push_back(live);
+        }
+        levelBegin = levelEnd;
+        levelEnd = boxes.size();
+        levelStart.push_back(levelEnd);
+    }
+    assert(boxes.size() == numNodes);
+}
+
+/*private*/
+bool
+LineSegmentIndex::removePacked(const LineSegment* seg)
+{
+    if(boxes.empty() || liveCount.back() == 0) {
+        return false;
+    }
+
+    const PackedBox segBox = boxOf(seg);
+
+    std::size_t stack[maxStackSize];
+    std::size_t level[maxStackSize];
+    std::size_t top = 0;
+    stack[top] = boxes.size() - 1;
+    level[top] = levelStart.size() - 2;
+    ++top;
+
+    while(top > 0) {
+        --top;
+        const std::size_t node = stack[top];
+        const std::size_t lvl = level[top];
+
+        if(lvl == 0) {
+            if(leafSegs[node] != seg) {
+                continue;
+            }
+            leafSegs[node] = nullptr;
+            // Decrement the live counts up to the root
+            std::size_t n = node;
+            for(std::size_t l = 0; l + 1 < levelStart.size(); ++l) {
+                --liveCount[n];
+                n = levelStart[l + 1] + (n - levelStart[l]) / nodeCapacity;
+            }
+            return true;
+        }
+
+        const std::size_t first = levelStart[lvl - 1] + (node - levelStart[lvl]) * nodeCapacity;
+        const std::size_t last = std::min(first + nodeCapacity, levelStart[lvl]);
+        for(std::size_t child = first; child < last; ++child) {
+            if(liveCount[child] > 0 && boxes[child].intersects(segBox)) {
+                stack[top] = child;
+                level[top] = lvl - 1;
+                ++top;
+            }
+        }
+    }
+    return false;
 }
 
 } // namespace geos::simplify
@@ -0,0 +1,171 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2021 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/simplify/MultiLevelSimplifier.h>
+#include <geos/simplify/DouglasPeuckerLineSimplifier.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryComponentFilter.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/CoordinateSequenceFactory.h>
+#include <geos/geom/LineString.h>
+#include <geos/geom/MultiPolygon.h>
+#include <geos/geom/util/GeometryTransformer.h>
+#include <geos/util/IllegalArgumentException.h>
+
+#include <memory> // for unique_ptr
+#include <vector>
+
+using namespace geos::geom;
+
+namespace geos {
+namespace simplify { // geos::simplify
+
+using SignificanceMap = std::unordered_map<const Geometry*, std::vector<double>>;
+
+namespace { // module-statics
+
+class SignificanceFilter: public GeometryComponentFilter {
+
+public:
+
+    SignificanceFilter(SignificanceMap& nMap)
+        : significance(nMap)
+    {}
+
+    void
+    filter_ro(const Geometry* geom) override
+    {
+        const LineString* ls = dynamic_cast<const LineString*>(geom);
+        if(!ls) {
+            return;
+        }
+
+        Coordinate::Vect pts;
+        ls->getCoordinatesRO()->toVector(pts);
+        significance[geom] = DouglasPeuckerLineSimplifier::computeEffectiveTolerances(pts);
+    }
+
+private:
+
+    SignificanceMap& significance;
+};
+
+/*
+ * Same as the transformer of DouglasPeuckerSimplifier, but keeps
+ * the vertices more significant than the tolerance instead of
+ * running Douglas-Peucker.
+ */
+class SignificanceTransformer: public geom::util::GeometryTransformer {
+
+public:
+
+    SignificanceTransformer(const SignificanceMap& nMap, double nTolerance)
+        : significance(nMap)
+        , tolerance(nTolerance)
+    {
+        setSkipTransformedInvalidInteriorRings(true);
+    }
+
+protected:
+
+    CoordinateSequence::Ptr
+    transformCoordinates(const CoordinateSequence* coords,
+                         const Geometry* parent) override
+    {
+        auto it = significance.find(parent);
+        if(it == significance.end()) {
+            return GeometryTransformer::transformCoordinates(coords, parent);
+        }
+
+        const std::vector<double>& sig = it->second;
+        std::unique_ptr<Coordinate::Vect> newPts(new Coordinate::Vect());
+        for(std::size_t i = 0, n = coords->size(); i < n; ++i) {
+            if(sig[i] > tolerance) {
+                newPts->push_back(coords->getAt(i));
+            }
+        }
+
+        return CoordinateSequence::Ptr(
+                   factory->getCoordinateSequenceFactory()->create(
+                       newPts.release()
+                   ));
+    }
+
+    Geometry::Ptr
+    transformPolygon(const Polygon* geom, const Geometry* parent) override
+    {
+        Geometry::Ptr roughGeom(GeometryTransformer::transformPolygon(geom, parent));
+
+        // don't try and correct if the parent is going to do this
+        if(dynamic_cast<const MultiPolygon*>(parent)) {
+            return roughGeom;
+        }
+
+        return roughGeom->buffer(0.0);
+    }
+
+    Geometry::Ptr
+    transformMultiPolygon(const MultiPolygon* geom, const Geometry* parent) override
+    {
+        Geometry::Ptr roughGeom(GeometryTransformer::transformMultiPolygon(geom, parent));
+        return roughGeom->buffer(0.0);
+    }
+
+private:
+
+    const SignificanceMap& significance;
+
+    double tolerance;
+};
+
+} // anonymous namespace
+
+/*public*/
+MultiLevelSimplifier::MultiLevelSimplifier(const Geometry* geom)
+    :
+    inputGeom(geom)
+{
+    SignificanceFilter filter(significance);
+    inputGeom->apply_ro(&filter);
+}
+
+/*public*/
+MultiLevelSimplifier::~MultiLevelSimplifier() = default;
+
+/*public*/
+std::unique_ptr<Geometry>
+MultiLevelSimplifier::getResultGeometry(double tolerance) const
+{
+    if(tolerance < 0.0) {
+        throw util::IllegalArgumentException("Tolerance must be non-negative");
+    }
+
+    SignificanceTransformer t(significance, tolerance);
+    return t.transform(inputGeom);
+}
+
+/*public*/
+const std::vector<double>*
+MultiLevelSimplifier::getVertexSignificance(const Geometry* line) const
+{
+    auto it = significance.find(line);
+    if(it == significance.end()) {
+        return nullptr;
+    }
+    return &(it->second);
+}
+
+} // namespace geos::simplify
+} // namespace geos
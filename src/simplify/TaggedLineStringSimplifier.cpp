@@ -61,6 +61,16 @@ TaggedLineStringSimplifier::TaggedLineStringSimplifier(
 {
 }
 
+/*public*/
+void
+TaggedLineStringSimplifier::setSharedIndexes(
+    const std::vector<LineSegmentIndex*>& sharedInput,
+    const std::vector<LineSegmentIndex*>& sharedOutput)
+{
+    sharedInputIndexes = sharedInput;
+    sharedOutputIndexes = sharedOutput;
+}
+
 /*public*/
 void
 TaggedLineStringSimplifier::simplify(TaggedLineString* nLine)
@@ -211,10 +221,13 @@ bool
 TaggedLineStringSimplifier::hasBadOutputIntersection(
     const LineSegment& candidateSeg)
 {
-    std::unique_ptr< std::vector<LineSegment*> > querySegs =
-        outputIndex->query(&candidateSeg);
+    querySegs.clear();
+    outputIndex->query(&candidateSeg, querySegs);
+    for(LineSegmentIndex* index : sharedOutputIndexes) {
+        index->query(&candidateSeg, querySegs);
+    }
 
-    for(const LineSegment* querySeg : *querySegs) {
+    for(const LineSegment* querySeg : querySegs) {
         if(hasInteriorIntersection(*querySeg, candidateSeg)) {
             return true;
         }
@@ -240,10 +253,13 @@ TaggedLineStringSimplifier::hasBadInputIntersection(
     const pair<std::size_t, std::size_t>& sectionIndex,
     const LineSegment& candidateSeg)
 {
-    std::unique_ptr< std::vector<LineSegment*> > querySegs =
-        inputIndex->query(&candidateSeg);
+    querySegs.clear();
+    inputIndex->query(&candidateSeg, querySegs);
+    for(LineSegmentIndex* index : sharedInputIndexes) {
+        index->query(&candidateSeg, querySegs);
+    }
 
-    for(const LineSegment* ls : *querySegs) {
+    for(const LineSegment* ls : querySegs) {
         const TaggedLineSegment* querySeg = static_cast<const TaggedLineSegment*>(ls);
 
         if(!isInLineSection(parentLine, sectionIndex, querySeg) && hasInteriorIntersection(*querySeg, candidateSeg)) {
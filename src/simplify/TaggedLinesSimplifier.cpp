@@ -19,11 +19,19 @@
 #include <geos/simplify/TaggedLinesSimplifier.h>
 #include <geos/simplify/LineSegmentIndex.h>
 #include <geos/simplify/TaggedLineStringSimplifier.h>
+#include <geos/simplify/TaggedLineString.h>
 #include <geos/algorithm/LineIntersector.h>
+#include <geos/geom/Envelope.h>
+#include <geos/geom/LineString.h>
 
+#include <atomic>
 #include <cassert>
+#include <cmath>
 #include <algorithm>
+#include <exception>
 #include <memory>
+#include <mutex>
+#include <thread>
 
 #ifndef GEOS_DEBUG
 #define GEOS_DEBUG 0
@@ -45,7 +53,9 @@ TaggedLinesSimplifier::TaggedLinesSimplifier()
     inputIndex(new LineSegmentIndex()),
     outputIndex(new LineSegmentIndex()),
     taggedlineSimplifier(new TaggedLineStringSimplifier(inputIndex.get(),
-                         outputIndex.get()))
+                         outputIndex.get())),
+    distanceTolerance(0.0),
+    numThreads(1)
 {
 }
 
@@ -53,9 +63,17 @@ TaggedLinesSimplifier::TaggedLinesSimplifier()
 void
 TaggedLinesSimplifier::setDistanceTolerance(double d)
 {
+    distanceTolerance = d;
     taggedlineSimplifier->setDistanceTolerance(d);
 }
 
+/*public*/
+void
+TaggedLinesSimplifier::setNumThreads(std::size_t n)
+{
+    numThreads = n;
+}
+
 /*private*/
 void
 TaggedLinesSimplifier::simplify(TaggedLineString& tls)
@@ -63,5 +81,122 @@ TaggedLinesSimplifier::simplify(TaggedLineString& tls)
     taggedlineSimplifier->simplify(&tls);
 }
 
+/*private*/
+void
+TaggedLinesSimplifier::simplifyParallel(const std::vector<TaggedLineString*>& lines)
+{
+    Envelope extent;
+    for(const TaggedLineString* line : lines) {
+        extent.expandToInclude(line->getParent()->getEnvelopeInternal());
+    }
+
+    // Cut the extent into a grid with a few cells per thread, so that
+    // threads finishing early can pick up more work.
+    const std::size_t gridSide = static_cast<std::size_t>(
+        std::ceil(std::sqrt(4.0 * static_cast<double>(numThreads))));
+    const std::size_t numCells = gridSide * gridSide;
+    const double cellWidth = extent.getWidth() / static_cast<double>(gridSide);
+    const double cellHeight = extent.getHeight() / static_cast<double>(gridSide);
+
+    // A line belongs to a cell if its envelope lies strictly inside it.
+    // Segments considered while simplifying a line lie within the line
+    // envelope, so lines of different cells never see each other.
+    std::vector<TaggedLineString*> crossLines;
+    std::vector<std::vector<TaggedLineString*>> cellLines(numCells);
+    for(TaggedLineString* line : lines) {
+        const Envelope* env = line->getParent()->getEnvelopeInternal();
+        if(cellWidth > 0.0 && cellHeight > 0.0 && !env->isNull()) {
+            const std::size_t cx = std::min(gridSide - 1, static_cast<std::size_t>(
+                                                (env->getMinX() - extent.getMinX()) / cellWidth));
+            const std::size_t cy = std::min(gridSide - 1, static_cast<std::size_t>(
+                                                (env->getMinY() - extent.getMinY()) / cellHeight));
+            const double cellMinX = extent.getMinX() + static_cast<double>(cx) * cellWidth;
+            const double cellMinY = extent.getMinY() + static_cast<double>(cy) * cellHeight;
+            if(env->getMinX() > cellMinX && env->getMaxX() < cellMinX + cellWidth &&
+                    env->getMinY() > cellMinY && env->getMaxY() < cellMinY + cellHeight) {
+                cellLines[cy * gridSide + cx].push_back(line);
+                continue;
+            }
+        }
+        crossLines.push_back(line);
+    }
+
+    LineSegmentIndex crossInput;
+    LineSegmentIndex crossOutput;
+    std::vector<std::unique_ptr<LineSegmentIndex>> cellInputs;
+    std::vector<std::unique_ptr<LineSegmentIndex>> cellOutputs;
+    std::vector<LineSegmentIndex*> cellInputPtrs;
+    for(std::size_t i = 0; i < numCells; i++) {
+        cellInputs.emplace_back(new LineSegmentIndex());
+        cellOutputs.emplace_back(new LineSegmentIndex());
+        for(TaggedLineString* line : cellLines[i]) {
+            cellInputs[i]->add(*line);
+        }
+        cellInputPtrs.push_back(cellInputs[i].get());
+    }
+    for(TaggedLineString* line : crossLines) {
+        crossInput.add(*line);
+    }
+
+    // Lines crossing cell borders may interact with any line,
+    // so they are simplified first, sequentially.
+    TaggedLineStringSimplifier crossSimplifier(&crossInput, &crossOutput);
+    crossSimplifier.setDistanceTolerance(distanceTolerance);
+    crossSimplifier.setSharedIndexes(cellInputPtrs, std::vector<LineSegmentIndex*>());
+    for(TaggedLineString* line : crossLines) {
+        crossSimplifier.simplify(line);
+    }
+
+    // From here on the cross-cell indexes are only read
+    crossInput.build();
+    crossOutput.build();
+    for(auto& index : cellInputs) {
+        index->build();
+    }
+
+    std::atomic<std::size_t> nextCell(0);
+    std::exception_ptr error;
+    std::mutex errorMutex;
+
+    auto worker = [&]() {
+        try {
+            for(std::size_t cell = nextCell++; cell < numCells; cell = nextCell++) {
+                if(cellLines[cell].empty()) {
+                    continue;
+                }
+                TaggedLineStringSimplifier cellSimplifier(cellInputs[cell].get(),
+                                                          cellOutputs[cell].get());
+                cellSimplifier.setDistanceTolerance(distanceTolerance);
+                cellSimplifier.setSharedIndexes(
+                    std::vector<LineSegmentIndex*>(1, &crossInput),
+                    std::vector<LineSegmentIndex*>(1, &crossOutput));
+                for(TaggedLineString* line : cellLines[cell]) {
+                    cellSimplifier.simplify(line);
+                }
+            }
+        }
+        catch(...) {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if(!error) {
+                error = std::current_exception();
+            }
+            nextCell = numCells;
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for(std::size_t i = 1; i < std::min(numThreads, numCells); i++) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for(std::thread& t : threads) {
+        t.join();
+    }
+
+    if(error) {
+        std::rethrow_exception(error);
+    }
+}
+
 } // namespace geos::simplify
 } // namespace geos
@@ -263,6 +263,9 @@ TopologyPreservingSimplifier::TopologyPreservingSimplifier(const Geometry* geom)
 {
 }
 
+/*public*/
+TopologyPreservingSimplifier::~TopologyPreservingSimplifier() = default;
+
 /*public*/
 void
 TopologyPreservingSimplifier::setDistanceTolerance(double d)
@@ -276,6 +279,13 @@ TopologyPreservingSimplifier::setDistanceTolerance(double d)
     lineSimplifier->setDistanceTolerance(d);
 }
 
+/*public*/
+void
+TopologyPreservingSimplifier::setNumThreads(std::size_t n)
+{
+    lineSimplifier->setNumThreads(n);
+}
+
 
 /*public*/
 std::unique_ptr<geom::Geometry>
@@ -0,0 +1,217 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2021 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************
+ *
+ * Last port: simplify/VWLineSimplifier.java (JTS-1.17)
+ *
+ **********************************************************************/
+
+#include <geos/simplify/VisvalingamWhyattLineSimplifier.h>
+#include <geos/geom/Coordinate.h>
+
+#include <algorithm> // for swap
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <memory> // for unique_ptr
+
+namespace geos {
+namespace simplify { // geos::simplify
+
+/*public static*/
+VisvalingamWhyattLineSimplifier::CoordsVectAutoPtr
+VisvalingamWhyattLineSimplifier::simplify(
+    const VisvalingamWhyattLineSimplifier::CoordsVect& nPts,
+    double distanceTolerance)
+{
+    VisvalingamWhyattLineSimplifier simp(nPts);
+    simp.setDistanceTolerance(distanceTolerance);
+    return simp.simplify();
+}
+
+/*public*/
+VisvalingamWhyattLineSimplifier::VisvalingamWhyattLineSimplifier(
+    const VisvalingamWhyattLineSimplifier::CoordsVect& nPts)
+    :
+    pts(nPts),
+    areaTolerance(0.0)
+{
+}
+
+/*public*/
+void
+VisvalingamWhyattLineSimplifier::setDistanceTolerance(
+    double nDistanceTolerance)
+{
+    areaTolerance = nDistanceTolerance * nDistanceTolerance;
+}
+
+/*public*/
+VisvalingamWhyattLineSimplifier::CoordsVectAutoPtr
+VisvalingamWhyattLineSimplifier::simplify()
+{
+    CoordsVectAutoPtr coordList(new CoordsVect());
+
+    // nothing to remove without interior vertices
+    std::size_t n = pts.size();
+    if(n < 3) {
+        coordList->assign(pts.begin(), pts.end());
+        return coordList;
+    }
+
+    prev.resize(n);
+    next.resize(n);
+    area.assign(n, std::numeric_limits<double>::infinity());
+    heapPos.assign(n, 0);
+    heap.clear();
+    heap.reserve(n);
+
+    for(std::size_t i = 0; i < n; ++i) {
+        prev[i] = i - 1;
+        next[i] = i + 1;
+    }
+
+    // The endpoints are never removed, so only interior vertices
+    // go into the heap
+    for(std::size_t i = 1; i + 1 < n; ++i) {
+        area[i] = triangleArea(i);
+        heapPos[i] = heap.size();
+        heap.push_back(i);
+    }
+    for(std::size_t pos = heap.size() / 2; pos > 0; --pos) {
+        siftDown(pos - 1);
+    }
+
+    std::vector<bool> removed(n, false);
+    while(!heap.empty() && area[heap.front()] < areaTolerance) {
+        std::size_t i = heap.front();
+        heapRemoveTop();
+        removed[i] = true;
+
+        std::size_t p = prev[i];
+        std::size_t q = next[i];
+        next[p] = q;
+        prev[q] = p;
+
+        if(p != 0) {
+            updateArea(p);
+        }
+        if(q != n - 1) {
+            updateArea(q);
+        }
+    }
+
+    for(std::size_t i = 0; i < n; ++i) {
+        if(!removed[i]) {
+            coordList->push_back(pts[i]);
+        }
+    }
+
+    return coordList;
+}
+
+/*private*/
+double
+VisvalingamWhyattLineSimplifier::triangleArea(std::size_t i) const
+{
+    const geom::Coordinate& a = pts[prev[i]];
+    const geom::Coordinate& b = pts[i];
+    const geom::Coordinate& c = pts[next[i]];
+    return std::fabs(((c.x - a.x) * (b.y - a.y) - (b.x - a.x) * (c.y - a.y)) / 2.0);
+}
+
+/*private*/
+bool
+VisvalingamWhyattLineSimplifier::heapLess(std::size_t a, std::size_t b) const
+{
+    // Ties are broken by position along the line, so the result
+    // does not depend on the heap layout
+    if(area[a] != area[b]) {
+        return area[a] < area[b];
+    }
+    return a < b;
+}
+
+/*private*/
+void
+VisvalingamWhyattLineSimplifier::heapSwap(std::size_t a, std::size_t b)
+{
+    std::swap(heap[a], heap[b]);
+    heapPos[heap[a]] = a;
+    heapPos[heap[b]] = b;
+}
+
+/*private*/
+void
+VisvalingamWhyattLineSimplifier::siftUp(std::size_t pos)
+{
+    while(pos > 0) {
+        std::size_t parent = (pos - 1) / 2;
+        if(!heapLess(heap[pos], heap[parent])) {
+            break;
+        }
+        heapSwap(pos, parent);
+        pos = parent;
+    }
+}
+
+/*private*/
+void
+VisvalingamWhyattLineSimplifier::siftDown(std::size_t pos)
+{
+    std::size_t size = heap.size();
+    for(;;) {
+        std::size_t smallest = pos;
+        std::size_t left = 2 * pos + 1;
+        std::size_t right = left + 1;
+        if(left < size && heapLess(heap[left], heap[smallest])) {
+            smallest = left;
+        }
+        if(right < size && heapLess(heap[right], heap[smallest])) {
+            smallest = right;
+        }
+        if(smallest == pos) {
+            return;
+        }
+        heapSwap(pos, smallest);
+        pos = smallest;
+    }
+}
+
+/*private*/
+void
+VisvalingamWhyattLineSimplifier::heapRemoveTop()
+{
+    heapSwap(0, heap.size() - 1);
+    heap.pop_back();
+    if(!heap.empty()) {
+        siftDown(0);
+    }
+}
+
+/*private*/
+void
+VisvalingamWhyattLineSimplifier::updateArea(std::size_t i)
+{
+    double oldArea = area[i];
+    area[i] = triangleArea(i);
+    if(area[i] < oldArea) {
+        siftUp(heapPos[i]);
+    }
+    else {
+        siftDown(heapPos[i]);
+    }
+}
+
+} // namespace geos::simplify
+} // namespace geos
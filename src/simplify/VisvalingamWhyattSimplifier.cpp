@@ -0,0 +1,143 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2021 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************
+ *
+ * Last port: simplify/VWSimplifier.java (JTS-1.17)
+ *
+ **********************************************************************/
+
+#include <geos/simplify/VisvalingamWhyattSimplifier.h>
+#include <geos/simplify/VisvalingamWhyattLineSimplifier.h>
+#include <geos/geom/Geometry.h> // for Ptr typedefs
+#include <geos/geom/MultiPolygon.h>
+#include <geos/geom/CoordinateSequence.h> // for Ptr typedefs
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/CoordinateSequenceFactory.h>
+#include <geos/geom/util/GeometryTransformer.h> // for VWTransformer inheritance
+#include <geos/util/IllegalArgumentException.h>
+#include <geos/util.h>
+
+#include <memory> // for unique_ptr
+
+using namespace geos::geom;
+
+namespace geos {
+namespace simplify { // geos::simplify
+
+namespace { // module-statics
+
+class VWTransformer: public geom::util::GeometryTransformer {
+
+public:
+
+    VWTransformer(double tolerance)
+        : distanceTolerance(tolerance)
+    {
+        setSkipTransformedInvalidInteriorRings(true);
+    }
+
+protected:
+
+    CoordinateSequence::Ptr
+    transformCoordinates(const CoordinateSequence* coords,
+                         const Geometry* parent) override
+    {
+        ::geos::ignore_unused_variable_warning(parent);
+
+        Coordinate::Vect inputPts;
+        coords->toVector(inputPts);
+
+        std::unique_ptr<Coordinate::Vect> newPts =
+            VisvalingamWhyattLineSimplifier::simplify(inputPts, distanceTolerance);
+
+        return CoordinateSequence::Ptr(
+                   factory->getCoordinateSequenceFactory()->create(
+                       newPts.release()
+                   ));
+    }
+
+    Geometry::Ptr
+    transformPolygon(const Polygon* geom, const Geometry* parent) override
+    {
+        Geometry::Ptr roughGeom(GeometryTransformer::transformPolygon(geom, parent));
+
+        // don't try and correct if the parent is going to do this
+        if(dynamic_cast<const MultiPolygon*>(parent)) {
+            return roughGeom;
+        }
+
+        return createValidArea(roughGeom.get());
+    }
+
+    Geometry::Ptr
+    transformMultiPolygon(const MultiPolygon* geom, const Geometry* parent) override
+    {
+        Geometry::Ptr roughGeom(GeometryTransformer::transformMultiPolygon(geom, parent));
+        return createValidArea(roughGeom.get());
+    }
+
+private:
+
+    /*
+     * Creates a valid area geometry from one that possibly has
+     * bad topology (i.e. self-intersections), using a 0-width buffer.
+     */
+    static Geometry::Ptr
+    createValidArea(const Geometry* roughAreaGeom)
+    {
+        return roughAreaGeom->buffer(0.0);
+    }
+
+    double distanceTolerance;
+};
+
+} // anonymous namespace
+
+/*public static*/
+Geometry::Ptr
+VisvalingamWhyattSimplifier::simplify(const Geometry* geom,
+                                      double tolerance)
+{
+    VisvalingamWhyattSimplifier simp(geom);
+    simp.setDistanceTolerance(tolerance);
+    return simp.getResultGeometry();
+}
+
+/*public*/
+VisvalingamWhyattSimplifier::VisvalingamWhyattSimplifier(const Geometry* geom)
+    :
+    inputGeom(geom),
+    distanceTolerance(0.0)
+{
+}
+
+/*public*/
+void
+VisvalingamWhyattSimplifier::setDistanceTolerance(double tol)
+{
+    if(tol < 0.0) {
+        throw util::IllegalArgumentException("Tolerance must be non-negative");
+    }
+    distanceTolerance = tol;
+}
+
+/*public*/
+Geometry::Ptr
+VisvalingamWhyattSimplifier::getResultGeometry()
+{
+    VWTransformer t(distanceTolerance);
+    return t.transform(inputGeom);
+}
+
+} // namespace geos::simplify
+} // namespace geos
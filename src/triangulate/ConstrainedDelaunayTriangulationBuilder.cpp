@@ -0,0 +1,152 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2021 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/triangulate/ConstrainedDelaunayTriangulationBuilder.h>
+
+#include <geos/algorithm/Orientation.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateSequenceFactory.h>
+#include <geos/geom/Envelope.h>
+#include <geos/geom/GeometryCollection.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/Polygon.h>
+#include <geos/geom/util/PolygonExtracter.h>
+#include <geos/triangulate/ConstrainedDelaunayTriangulator.h>
+#include <geos/triangulate/IncrementalDelaunayTriangulator.h>
+#include <geos/triangulate/quadedge/QuadEdge.h>
+#include <geos/triangulate/quadedge/QuadEdgeSubdivision.h>
+
+#include <algorithm>
+
+namespace geos {
+namespace triangulate { //geos.triangulate
+
+using namespace geos::geom;
+
+namespace {
+
+// a copy of the ring, counter-clockwise
+std::unique_ptr<CoordinateSequence>
+ccwRing(const LinearRing& ring)
+{
+    std::unique_ptr<CoordinateSequence> pts = ring.getCoordinatesRO()->clone();
+    if(pts->size() >= 4 && !algorithm::Orientation::isCCW(pts.get())) {
+        CoordinateSequence::reverse(pts.get());
+    }
+    return pts;
+}
+
+} // anonymous namespace
+
+ConstrainedDelaunayTriangulationBuilder::ConstrainedDelaunayTriangulationBuilder() = default;
+
+ConstrainedDelaunayTriangulationBuilder::~ConstrainedDelaunayTriangulationBuilder() = default;
+
+void
+ConstrainedDelaunayTriangulationBuilder::setConstraints(const Geometry& geom)
+{
+    polygons.clear();
+    subdiv.reset();
+    triangles.clear();
+
+    std::vector<const Polygon*> polys;
+    geom::util::PolygonExtracter::getPolygons(geom, polys);
+    for(const Polygon* poly : polys) {
+        if(poly->isEmpty()) {
+            continue;
+        }
+        polygons.emplace_back();
+        polygons.back().push_back(ccwRing(*poly->getExteriorRing()));
+        for(std::size_t i = 0; i < poly->getNumInteriorRing(); i++) {
+            polygons.back().push_back(ccwRing(*poly->getInteriorRingN(i)));
+        }
+    }
+}
+
+void
+ConstrainedDelaunayTriangulationBuilder::create()
+{
+    if(subdiv != nullptr) {
+        return;
+    }
+
+    std::vector<Coordinate> coords;
+    for(const auto& rings : polygons) {
+        for(const auto& ring : rings) {
+            for(std::size_t i = 0; i < ring->size(); i++) {
+                coords.push_back(ring->getAt(i));
+            }
+        }
+    }
+    std::sort(coords.begin(), coords.end(), CoordinateLessThen());
+    coords.erase(std::unique(coords.begin(), coords.end(),
+    [](const Coordinate& a, const Coordinate& b) {
+        return a.equals2D(b);
+    }), coords.end());
+
+    // no polygon has an area
+    if(coords.size() < 3) {
+        return;
+    }
+
+    Envelope siteEnv;
+    IncrementalDelaunayTriangulator::VertexList vertices;
+    vertices.reserve(coords.size());
+    for(const Coordinate& c : coords) {
+        siteEnv.expandToInclude(c);
+        vertices.emplace_back(c);
+    }
+    coords = std::vector<Coordinate>();
+
+    // a random order avoids the long walks of ring order
+    IncrementalDelaunayTriangulator::sortBRIO(vertices);
+
+    subdiv.reset(new quadedge::QuadEdgeSubdivision(siteEnv, 0.0));
+    IncrementalDelaunayTriangulator triangulator(subdiv.get());
+    triangulator.insertSites(vertices);
+
+    ConstrainedDelaunayTriangulator cdt(subdiv.get());
+    std::vector<ConstrainedDelaunayTriangulator::PolygonEdges> polygonEdges;
+    for(const auto& rings : polygons) {
+        polygonEdges.emplace_back(rings.size());
+        for(std::size_t r = 0; r < rings.size(); r++) {
+            cdt.insertConstraints(*rings[r], polygonEdges.back()[r]);
+        }
+    }
+    triangles = cdt.getEnclosedTriangles(polygonEdges);
+}
+
+std::unique_ptr<GeometryCollection>
+ConstrainedDelaunayTriangulationBuilder::getTriangles(const GeometryFactory& geomFact)
+{
+    create();
+
+    auto coordSeqFact = geomFact.getCoordinateSequenceFactory();
+    std::vector<std::unique_ptr<Geometry>> tris;
+    tris.reserve(triangles.size());
+    for(const quadedge::QuadEdge* e : triangles) {
+        auto coordSeq = coordSeqFact->create(4, 0);
+        for(std::size_t i = 0; i < 3; i++, e = &e->lNext()) {
+            coordSeq->setAt(e->orig().getCoordinate(), i);
+        }
+        coordSeq->setAt(e->orig().getCoordinate(), 3);
+        tris.push_back(geomFact.createPolygon(geomFact.createLinearRing(std::move(coordSeq))));
+    }
+
+    return geomFact.createGeometryCollection(std::move(tris));
+}
+
+} //namespace geos.triangulate
+} //namespace goes
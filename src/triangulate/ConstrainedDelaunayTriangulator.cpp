@@ -0,0 +1,405 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2021 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/triangulate/ConstrainedDelaunayTriangulator.h>
+
+#include <geos/algorithm/Orientation.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/triangulate/quadedge/QuadEdge.h>
+#include <geos/triangulate/quadedge/QuadEdgeQuartet.h>
+#include <geos/triangulate/quadedge/QuadEdgeSubdivision.h>
+#include <geos/triangulate/quadedge/LocateFailureException.h>
+#include <geos/triangulate/quadedge/TriangleVisitor.h>
+#include <geos/util/IllegalArgumentException.h>
+
+#include <deque>
+#include <sstream>
+#include <unordered_set>
+
+namespace geos {
+namespace triangulate { //geos.triangulate
+
+using namespace quadedge;
+using geos::algorithm::Orientation;
+
+namespace {
+
+int
+orientation(const Vertex& p, const Vertex& q, const Vertex& r)
+{
+    return Orientation::index(p.getCoordinate(), q.getCoordinate(), r.getCoordinate());
+}
+
+/*
+ * Tests whether e crosses the segment ab at a point
+ * interior to both.
+ */
+bool
+crossesSegment(const QuadEdge& e, const Vertex& a, const Vertex& b)
+{
+    return orientation(a, b, e.orig()) * orientation(a, b, e.dest()) < 0 &&
+           orientation(e.orig(), e.dest(), a) * orientation(e.orig(), e.dest(), b) < 0;
+}
+
+/*
+ * Tests whether the quadrilateral formed by the triangles on
+ * both sides of e is strictly convex, so that e can be swapped.
+ */
+bool
+isSwappable(const QuadEdge& e)
+{
+    const Vertex& p = e.oPrev().dest();
+    const Vertex& q = e.sym().oPrev().dest();
+    return orientation(p, q, e.orig()) * orientation(p, q, e.dest()) < 0;
+}
+
+[[noreturn]] void
+throwCrossingConstraints(const QuadEdge& e)
+{
+    std::ostringstream s;
+    s << "Constraint crosses constraint " << *e.toLineSegment();
+    throw util::IllegalArgumentException(s.str());
+}
+
+/*
+ * Numbers the triangles, storing the number of each triangle
+ * in the data of the edges having it on their left.
+ */
+class TriangleNumberingVisitor : public TriangleVisitor {
+private:
+    std::vector<QuadEdge*>& triangles;
+
+public:
+    TriangleNumberingVisitor(std::vector<QuadEdge*>& p_triangles) : triangles(p_triangles)
+    {
+    }
+
+    void
+    visit(QuadEdge* triEdges[3]) override
+    {
+        int32_t tri = static_cast<int32_t>(triangles.size());
+        for(std::size_t i = 0; i < 3; i++) {
+            triEdges[i]->setData(tri);
+        }
+        triangles.push_back(triEdges[0]);
+    }
+};
+
+/*
+ * Collects the triangles inside a ring, starting from the triangles
+ * on the left of its edges and not crossing them. Triangles are
+ * visited once per stamp value.
+ */
+void
+floodRing(const std::vector<QuadEdge*>& ring, const std::vector<QuadEdge*>& triangles,
+          std::vector<std::size_t>& stamps, std::size_t stamp,
+          std::vector<std::size_t>& inside)
+{
+    inside.clear();
+    std::unordered_set<const QuadEdge*> boundary(ring.begin(), ring.end());
+    for(const QuadEdge* e : ring) {
+        int32_t tri = e->getData();
+        if(tri >= 0 && stamps[static_cast<std::size_t>(tri)] != stamp) {
+            stamps[static_cast<std::size_t>(tri)] = stamp;
+            inside.push_back(static_cast<std::size_t>(tri));
+        }
+    }
+
+    for(std::size_t k = 0; k < inside.size(); k++) {
+        QuadEdge* e = triangles[inside[k]];
+        for(int i = 0; i < 3; i++, e = &e->lNext()) {
+            if(boundary.count(e)) {
+                continue;
+            }
+            int32_t nb = e->sym().getData();
+            if(nb < 0 || stamps[static_cast<std::size_t>(nb)] == stamp) {
+                continue;
+            }
+            stamps[static_cast<std::size_t>(nb)] = stamp;
+            inside.push_back(static_cast<std::size_t>(nb));
+        }
+    }
+}
+
+} // anonymous namespace
+
+ConstrainedDelaunayTriangulator::ConstrainedDelaunayTriangulator(QuadEdgeSubdivision* p_subdiv) :
+    subdiv(p_subdiv)
+{
+}
+
+void
+ConstrainedDelaunayTriangulator::insertConstraints(const geom::CoordinateSequence& line,
+        std::vector<QuadEdge*>& edges)
+{
+    if(line.isEmpty()) {
+        return;
+    }
+
+    Vertex start(line.getAt(0));
+    QuadEdge* e = subdiv->locate(start);
+    if(!e) {
+        throw LocateFailureException("Could not locate vertex.");
+    }
+    if(e->dest().equals(start)) {
+        e = &e->sym();
+    }
+    else if(!e->orig().equals(start)) {
+        throw util::IllegalArgumentException("Constraint vertex is not a site of the triangulation");
+    }
+
+    for(std::size_t i = 1, n = line.size(); i < n; i++) {
+        Vertex v(line.getAt(i));
+        if(v.equals(e->orig())) {
+            continue;
+        }
+        e = &insertConstraint(*e, v, &edges).sym();
+    }
+}
+
+QuadEdge&
+ConstrainedDelaunayTriangulator::insertConstraint(QuadEdge& start, const Vertex& end)
+{
+    return insertConstraint(start, end, nullptr);
+}
+
+QuadEdge&
+ConstrainedDelaunayTriangulator::insertConstraint(QuadEdge& start, const Vertex& end,
+        std::vector<QuadEdge*>* edges)
+{
+    std::vector<QuadEdge*> crossings;
+    QuadEdge* e = &start;
+    for(;;) {
+        // the segment from the origin of e to the first site on the way to end
+        Vertex segEnd;
+        crossings.clear();
+        QuadEdge* seg = findCrossings(*e, end, crossings, segEnd);
+        if(seg) {
+            // already an edge of the triangulation
+            seg->setConstrained(true);
+        }
+        else {
+            Vertex segStart = e->orig();
+            seg = recoverSegment(segStart, segEnd, crossings);
+            seg->setConstrained(true);
+            restoreDelaunay(crossings);
+        }
+        if(edges) {
+            edges->push_back(seg);
+        }
+
+        if(segEnd.equals(end)) {
+            return *seg;
+        }
+        e = &seg->sym();
+    }
+}
+
+/*
+ * Finds the edges crossed by the segment from the origin of start
+ * towards end, up to the first site lying on the segment. Returns the
+ * edge to that site if it already exists, nullptr otherwise.
+ */
+QuadEdge*
+ConstrainedDelaunayTriangulator::findCrossings(QuadEdge& start, const Vertex& end,
+        std::vector<QuadEdge*>& crossings, Vertex& segEnd) const
+{
+    const Vertex& a = start.orig();
+    const geom::Coordinate& pa = a.getCoordinate();
+    const geom::Coordinate& pb = end.getCoordinate();
+
+    // find the edge along the segment, or the triangle it leaves a through
+    QuadEdge* cur = nullptr;
+    QuadEdge* e = &start;
+    do {
+        const Vertex& d = e->dest();
+        if(d.equals(end)) {
+            segEnd = end;
+            return e;
+        }
+        const geom::Coordinate& pd = d.getCoordinate();
+        if(orientation(a, end, d) == 0 &&
+                (pd.x - pa.x) * (pb.x - pa.x) + (pd.y - pa.y) * (pb.y - pa.y) > 0) {
+            segEnd = d;
+            return e;
+        }
+        // e is to the right of the segment and the next edge to the left
+        if(orientation(a, d, end) > 0 && orientation(a, e->oNext().dest(), end) < 0) {
+            cur = &e->lNext();
+            break;
+        }
+        e = &e->oNext();
+    }
+    while(e != &start);
+
+    if(!cur) {
+        throw LocateFailureException("Could not find the triangle containing a constraint");
+    }
+
+    // walk the triangles along the segment, collecting the edges crossed,
+    // which are oriented from the right to the left of the segment
+    for(;;) {
+        if(cur->isConstrained()) {
+            throwCrossingConstraints(*cur);
+        }
+        crossings.push_back(cur);
+
+        QuadEdge& s = cur->sym();
+        const Vertex& v = s.lNext().dest();
+        if(v.equals(end)) {
+            segEnd = end;
+            return nullptr;
+        }
+        int orient = orientation(a, end, v);
+        if(orient == 0) {
+            segEnd = v;
+            return nullptr;
+        }
+        cur = orient > 0 ? &s.lNext() : &s.lNext().lNext();
+    }
+}
+
+/*
+ * Swaps the edges crossing the segment ab until none is left.
+ * Edges which cannot be swapped yet are put back in the queue.
+ * Returns the edge from a to b, leaving the new edges in crossings.
+ */
+QuadEdge*
+ConstrainedDelaunayTriangulator::recoverSegment(const Vertex& a, const Vertex& b,
+        std::vector<QuadEdge*>& crossings)
+{
+    std::deque<QuadEdge*> queue(crossings.begin(), crossings.end());
+    crossings.clear();
+
+    QuadEdge* seg = nullptr;
+    while(!queue.empty()) {
+        QuadEdge* e = queue.front();
+        queue.pop_front();
+
+        if(!isSwappable(*e)) {
+            queue.push_back(e);
+            continue;
+        }
+        QuadEdge::swap(*e);
+
+        if(crossesSegment(*e, a, b)) {
+            queue.push_back(e);
+        }
+        else if(e->orig().equals(a) && e->dest().equals(b)) {
+            seg = e;
+        }
+        else if(e->orig().equals(b) && e->dest().equals(a)) {
+            seg = &e->sym();
+        }
+        else {
+            crossings.push_back(e);
+        }
+    }
+
+    if(!seg) {
+        throw LocateFailureException("Could not recover constraint segment");
+    }
+    return seg;
+}
+
+/*
+ * Swaps the given edges, which triangulate the regions on both sides
+ * of a recovered segment, until they are all locally Delaunay. Each
+ * region then holds the Constrained Delaunay Triangulation of its
+ * boundary, which makes the whole triangulation constrained Delaunay
+ * without checking the edges outside the regions (Anglada, 1997).
+ */
+void
+ConstrainedDelaunayTriangulator::restoreDelaunay(const std::vector<QuadEdge*>& edges)
+{
+    // swapping keeps the edge objects, so marking them once is enough
+    for(QuadEdge* e : edges) {
+        e->setData(0);
+        e->sym().setData(0);
+    }
+
+    std::vector<QuadEdge*> stack(edges);
+    while(!stack.empty()) {
+        QuadEdge* e = stack.back();
+        stack.pop_back();
+
+        const Vertex& p = e->oPrev().dest();
+        const Vertex& q = e->sym().oPrev().dest();
+        if(!q.isInCircle(e->orig(), p, e->dest()) || !isSwappable(*e)) {
+            continue;
+        }
+
+        QuadEdge::swap(*e);
+        for(QuadEdge* n : { &e->lNext(), &e->lPrev(), &e->sym().lNext(), &e->sym().lPrev() }) {
+            if(n->getData() == 0) {
+                stack.push_back(n);
+            }
+        }
+    }
+
+    for(QuadEdge* e : edges) {
+        e->setData(-1);
+        e->sym().setData(-1);
+    }
+}
+
+std::vector<QuadEdge*>
+ConstrainedDelaunayTriangulator::getEnclosedTriangles(const std::vector<PolygonEdges>& polygons)
+{
+    for(auto& q : subdiv->getEdges()) {
+        q.setData(-1);
+    }
+
+    // frame triangles are not numbered, and lie outside all rings
+    std::vector<QuadEdge*> triangles;
+    TriangleNumberingVisitor visitor(triangles);
+    subdiv->visitTriangles(&visitor, false);
+
+    // each ring is flooded with a stamp of its own
+    std::vector<std::size_t> stamps(triangles.size(), 0);
+    std::size_t stamp = 0;
+    std::vector<char> isEnclosed(triangles.size(), 0);
+    std::vector<std::size_t> inShell;
+    std::vector<std::size_t> inHole;
+    for(const PolygonEdges& poly : polygons) {
+        if(poly.empty()) {
+            continue;
+        }
+        floodRing(poly[0], triangles, stamps, ++stamp, inShell);
+        const std::size_t shellStamp = stamp;
+
+        // the holes are flooded after the shell, so the triangles
+        // left with the shell stamp are not in any hole
+        for(std::size_t h = 1; h < poly.size(); h++) {
+            floodRing(poly[h], triangles, stamps, ++stamp, inHole);
+        }
+        for(std::size_t t : inShell) {
+            if(stamps[t] == shellStamp) {
+                isEnclosed[t] = 1;
+            }
+        }
+    }
+
+    std::vector<QuadEdge*> enclosed;
+    for(std::size_t t = 0; t < triangles.size(); t++) {
+        if(isEnclosed[t]) {
+            enclosed.push_back(triangles[t]);
+        }
+    }
+    return enclosed;
+}
+
+} //namespace geos.triangulate
+} //namespace goes
@@ -22,10 +22,14 @@
 
 #include <geos/geom/GeometryFactory.h>
 #include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateArraySequence.h>
 #include <geos/geom/CoordinateArraySequenceFactory.h>
 #include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/PointSet.h>
 #include <geos/operation/valid/RepeatedPointRemover.h>
 #include <geos/triangulate/IncrementalDelaunayTriangulator.h>
+#include <geos/triangulate/DivideAndConquerDelaunayTriangulator.h>
+#include <geos/triangulate/quadedge/HalfEdgeSubdivision.h>
 #include <geos/triangulate/quadedge/QuadEdgeSubdivision.h>
 #include <geos/operation/valid/RepeatedPointRemover.h>
 #include <geos/operation/valid/RepeatedPointTester.h>
@@ -76,10 +80,13 @@ DelaunayTriangulationBuilder::toVertices(
 }
 
 DelaunayTriangulationBuilder::DelaunayTriangulationBuilder() :
-    siteCoords(nullptr), tolerance(0.0), subdiv(nullptr)
+    siteCoords(nullptr), tolerance(0.0), insertionOrder(InsertionOrder::LEXICOGRAPHIC), numThreads(1),
+    compact(false), subdiv(nullptr)
 {
 }
 
+DelaunayTriangulationBuilder::~DelaunayTriangulationBuilder() = default;
+
 void
 DelaunayTriangulationBuilder::setSites(const Geometry& geom)
 {
@@ -94,17 +101,58 @@ DelaunayTriangulationBuilder::setSites(const CoordinateSequence& coords)
     siteCoords = operation::valid::RepeatedPointRemover::removeRepeatedPoints(&coords);
 }
 
+void
+DelaunayTriangulationBuilder::setSites(const PointSet& pts)
+{
+    std::vector<Coordinate> coords;
+    pts.toVector(coords);
+    std::sort(coords.begin(), coords.end(), geos::geom::CoordinateLessThen());
+    coords.erase(std::unique(coords.begin(), coords.end(), [](const Coordinate& a, const Coordinate& b) {
+        return a.equals2D(b);
+    }), coords.end());
+
+    siteCoords = detail::make_unique<CoordinateArraySequence>(std::move(coords), pts.hasZ() ? 3u : 2u);
+}
+
 void
 DelaunayTriangulationBuilder::create()
 {
-    if(subdiv != nullptr || siteCoords == nullptr) {
+    if(subdiv != nullptr || halfEdgeSubdiv != nullptr || siteCoords == nullptr) {
         return;
     }
 
     Envelope siteEnv;
     siteCoords ->expandEnvelope(siteEnv);
     auto vertices = toVertices(*siteCoords);
-    std::sort(vertices.begin(), vertices.end()); // Best performance from locator when inserting points near each other
+
+    // a frame around a single site is degenerate
+    bool hasExtent = siteEnv.getWidth() > 0.0 || siteEnv.getHeight() > 0.0;
+    if(numThreads > 1 && tolerance == 0.0 && hasExtent) {
+        subdiv.reset(new quadedge::QuadEdgeSubdivision(siteEnv, tolerance));
+        DivideAndConquerDelaunayTriangulator triangulator(subdiv.get());
+        triangulator.setNumThreads(numThreads);
+        triangulator.insertSites(vertices);
+        return;
+    }
+
+    switch(insertionOrder) {
+    case InsertionOrder::HILBERT:
+        IncrementalDelaunayTriangulator::sortHilbert(vertices);
+        break;
+    case InsertionOrder::BRIO:
+        IncrementalDelaunayTriangulator::sortBRIO(vertices);
+        break;
+    default:
+        std::sort(vertices.begin(), vertices.end()); // Best performance from locator when inserting points near each other
+        break;
+    }
+
+    if(compact) {
+        halfEdgeSubdiv.reset(new quadedge::HalfEdgeSubdivision(siteEnv, tolerance));
+        IncrementalDelaunayTriangulator triangulator(halfEdgeSubdiv.get());
+        triangulator.insertSites(vertices);
+        return;
+    }
 
     subdiv.reset(new quadedge::QuadEdgeSubdivision(siteEnv, tolerance));
     IncrementalDelaunayTriangulator triangulator = IncrementalDelaunayTriangulator(subdiv.get());
@@ -115,6 +163,9 @@ quadedge::QuadEdgeSubdivision&
 DelaunayTriangulationBuilder::getSubdivision()
 {
     create();
+    if(subdiv == nullptr && halfEdgeSubdiv != nullptr) {
+        subdiv = halfEdgeSubdiv->toQuadEdgeSubdivision();
+    }
     return *subdiv;
 }
 
@@ -122,8 +173,7 @@ std::unique_ptr<MultiLineString>
 DelaunayTriangulationBuilder::getEdges(
     const GeometryFactory& geomFact)
 {
-    create();
-    return subdiv->getEdges(geomFact);
+    return getSubdivision().getEdges(geomFact);
 }
 
 std::unique_ptr<geom::GeometryCollection>
@@ -131,9 +181,26 @@ DelaunayTriangulationBuilder::getTriangles(
     const geom::GeometryFactory& geomFact)
 {
     create();
+    if(halfEdgeSubdiv) {
+        return halfEdgeSubdiv->getTriangles(geomFact);
+    }
     return subdiv->getTriangles(geomFact);
 }
 
+quadedge::TriangleMesh
+DelaunayTriangulationBuilder::getTriangleMesh(bool includeNeighbours)
+{
+    quadedge::TriangleMesh mesh;
+    create();
+    if(halfEdgeSubdiv) {
+        halfEdgeSubdiv->getTriangleMesh(mesh, includeNeighbours);
+    }
+    else if(subdiv) {
+        subdiv->getTriangleMesh(mesh, includeNeighbours);
+    }
+    return mesh;
+}
+
 geom::Envelope
 DelaunayTriangulationBuilder::envelope(const geom::CoordinateSequence& coords)
 {
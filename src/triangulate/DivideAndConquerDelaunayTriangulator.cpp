@@ -0,0 +1,270 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2021 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/triangulate/DivideAndConquerDelaunayTriangulator.h>
+
+#include <geos/algorithm/Orientation.h>
+#include <geos/triangulate/quadedge/QuadEdge.h>
+#include <geos/triangulate/quadedge/QuadEdgeQuartet.h>
+#include <geos/triangulate/quadedge/QuadEdgeSubdivision.h>
+
+#include <algorithm>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace geos {
+namespace triangulate { //geos.triangulate
+
+using namespace quadedge;
+
+namespace {
+
+// don't hand subproblems smaller than this to a new thread
+const std::size_t MIN_PARALLEL_SITES = 4096;
+
+typedef std::deque<QuadEdgeQuartet> QuadEdgeDeque;
+
+bool
+ccw(const Vertex& a, const Vertex& b, const Vertex& c)
+{
+    return algorithm::Orientation::index(a.getCoordinate(), b.getCoordinate(), c.getCoordinate())
+           == algorithm::Orientation::COUNTERCLOCKWISE;
+}
+
+bool
+rightOf(const Vertex& v, const QuadEdge& e)
+{
+    return ccw(v, e.dest(), e.orig());
+}
+
+bool
+leftOf(const Vertex& v, const QuadEdge& e)
+{
+    return ccw(v, e.orig(), e.dest());
+}
+
+void
+deleteEdge(QuadEdge& e)
+{
+    QuadEdge::splice(e, e.oPrev());
+    QuadEdge::splice(e.sym(), e.sym().oPrev());
+    e.remove();
+}
+
+/*
+ * The recursion of Guibas and Stolfi (1985) over a range of sorted
+ * vertices. Returns the CCW convex hull edge out of the leftmost
+ * vertex and the CW convex hull edge out of the rightmost vertex.
+ */
+class Triangulation {
+public:
+    Triangulation(const std::vector<Vertex>& p_sites, std::vector<std::unique_ptr<QuadEdgeDeque>>& p_edgeSets)
+        : sites(p_sites), edgeSets(p_edgeSets)
+    {}
+
+    void
+    triangulate(std::size_t start, std::size_t end, std::size_t edgeSet, std::size_t spawnLevels,
+                QuadEdge*& le, QuadEdge*& re)
+    {
+        QuadEdgeDeque& edges = *edgeSets[edgeSet];
+        std::size_t n = end - start;
+
+        if(n == 2) {
+            QuadEdge* a = QuadEdge::makeEdge(sites[start], sites[start + 1], edges);
+            le = a;
+            re = &a->sym();
+            return;
+        }
+
+        if(n == 3) {
+            const Vertex& s1 = sites[start];
+            const Vertex& s2 = sites[start + 1];
+            const Vertex& s3 = sites[start + 2];
+            QuadEdge* a = QuadEdge::makeEdge(s1, s2, edges);
+            QuadEdge* b = QuadEdge::makeEdge(s2, s3, edges);
+            QuadEdge::splice(a->sym(), *b);
+
+            if(ccw(s1, s2, s3)) {
+                QuadEdge::connect(*b, *a, edges);
+                le = a;
+                re = &b->sym();
+            }
+            else if(ccw(s1, s3, s2)) {
+                QuadEdge* c = QuadEdge::connect(*b, *a, edges);
+                le = &c->sym();
+                re = c;
+            }
+            else {
+                // collinear
+                le = a;
+                re = &b->sym();
+            }
+            return;
+        }
+
+        std::size_t mid = start + n / 2;
+        QuadEdge* ldo;
+        QuadEdge* ldi;
+        QuadEdge* rdi;
+        QuadEdge* rdo;
+
+        if(spawnLevels > 0 && n >= MIN_PARALLEL_SITES) {
+            // the left half goes to a new thread, in its own edge container
+            std::size_t leftSet = edgeSet + (std::size_t(1) << (spawnLevels - 1));
+            std::exception_ptr error;
+            std::thread left([&]() {
+                try {
+                    triangulate(start, mid, leftSet, spawnLevels - 1, ldo, ldi);
+                }
+                catch(...) {
+                    error = std::current_exception();
+                }
+            });
+            try {
+                triangulate(mid, end, edgeSet, spawnLevels - 1, rdi, rdo);
+            }
+            catch(...) {
+                left.join();
+                throw;
+            }
+            left.join();
+            if(error) {
+                std::rethrow_exception(error);
+            }
+        }
+        else {
+            triangulate(start, mid, edgeSet, 0, ldo, ldi);
+            triangulate(mid, end, edgeSet, 0, rdi, rdo);
+        }
+
+        merge(edges, ldo, ldi, rdi, rdo);
+        le = ldo;
+        re = rdo;
+    }
+
+private:
+    const std::vector<Vertex>& sites;
+    std::vector<std::unique_ptr<QuadEdgeDeque>>& edgeSets;
+
+    static void
+    merge(QuadEdgeDeque& edges, QuadEdge*& ldo, QuadEdge* ldi, QuadEdge* rdi, QuadEdge*& rdo)
+    {
+        // compute the lower common tangent of the two halves
+        for(;;) {
+            if(leftOf(rdi->orig(), *ldi)) {
+                ldi = &ldi->lNext();
+            }
+            else if(rightOf(ldi->orig(), *rdi)) {
+                rdi = &rdi->sym().oNext(); // rPrev
+            }
+            else {
+                break;
+            }
+        }
+
+        QuadEdge* basel = QuadEdge::connect(rdi->sym(), *ldi, edges);
+        if(ldi->orig().equals(ldo->orig())) {
+            ldo = &basel->sym();
+        }
+        if(rdi->orig().equals(rdo->orig())) {
+            rdo = basel;
+        }
+
+        // zip the seam upwards
+        for(;;) {
+            QuadEdge* lcand = &basel->sym().oNext();
+            bool lvalid = rightOf(lcand->dest(), *basel);
+            if(lvalid) {
+                while(lcand->oNext().dest().isInCircle(basel->dest(), basel->orig(), lcand->dest())) {
+                    QuadEdge* t = &lcand->oNext();
+                    deleteEdge(*lcand);
+                    lcand = t;
+                }
+            }
+
+            QuadEdge* rcand = &basel->oPrev();
+            bool rvalid = rightOf(rcand->dest(), *basel);
+            if(rvalid) {
+                while(rcand->oPrev().dest().isInCircle(basel->dest(), basel->orig(), rcand->dest())) {
+                    QuadEdge* t = &rcand->oPrev();
+                    deleteEdge(*rcand);
+                    rcand = t;
+                }
+            }
+
+            lvalid = rightOf(lcand->dest(), *basel);
+            rvalid = rightOf(rcand->dest(), *basel);
+            if(!lvalid && !rvalid) {
+                break;
+            }
+
+            if(!lvalid ||
+                    (rvalid && rcand->dest().isInCircle(lcand->dest(), lcand->orig(), rcand->orig()))) {
+                basel = QuadEdge::connect(*rcand, basel->sym(), edges);
+            }
+            else {
+                basel = QuadEdge::connect(basel->sym(), lcand->sym(), edges);
+            }
+        }
+    }
+};
+
+} // anonymous namespace
+
+DivideAndConquerDelaunayTriangulator::DivideAndConquerDelaunayTriangulator(
+    QuadEdgeSubdivision* p_subdiv) :
+    subdiv(p_subdiv), numThreads(1)
+{
+}
+
+void
+DivideAndConquerDelaunayTriangulator::insertSites(const IncrementalDelaunayTriangulator::VertexList& vertices)
+{
+    // the frame is triangulated with the sites, so it is the convex hull
+    std::vector<Vertex> sites(vertices.begin(), vertices.end());
+    for(const Vertex& v : subdiv->getFrameVertices()) {
+        sites.push_back(v);
+    }
+    std::sort(sites.begin(), sites.end());
+    sites.erase(std::unique(sites.begin(), sites.end(), [](const Vertex& a, const Vertex& b) {
+        return a.equals(b);
+    }), sites.end());
+
+    std::size_t spawnLevels = 0;
+    while((std::size_t(1) << (spawnLevels + 1)) <= numThreads) {
+        spawnLevels++;
+    }
+
+    std::vector<std::unique_ptr<QuadEdgeDeque>> edgeSets;
+    for(std::size_t i = 0; i < (std::size_t(1) << spawnLevels); i++) {
+        edgeSets.emplace_back(new QuadEdgeDeque());
+    }
+
+    QuadEdge* le;
+    QuadEdge* re;
+    Triangulation triangulation(sites, edgeSets);
+    triangulation.triangulate(0, sites.size(), 0, spawnLevels, le, re);
+
+    std::vector<QuadEdgeDeque*> edgeSetPtrs;
+    for(auto& edges : edgeSets) {
+        edgeSetPtrs.push_back(edges.get());
+    }
+    subdiv->setTriangulation(edgeSetPtrs);
+}
+
+} //namespace geos.triangulate
+} //namespace goes
@@ -0,0 +1,256 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2021 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/triangulate/DynamicDelaunayTriangulation.h>
+
+#include <geos/algorithm/CGAlgorithmsDD.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/GeometryCollection.h>
+#include <geos/triangulate/IncrementalDelaunayTriangulator.h>
+#include <geos/triangulate/quadedge/LocateFailureException.h>
+#include <geos/triangulate/quadedge/QuadEdge.h>
+#include <geos/triangulate/quadedge/QuadEdgeSubdivision.h>
+#include <geos/triangulate/quadedge/TrianglePredicate.h>
+#include <geos/triangulate/quadedge/Vertex.h>
+#include <geos/triangulate/quadedge/VoronoiCells.h>
+#include <geos/util/IllegalArgumentException.h>
+#include <geos/util/IllegalStateException.h>
+
+using geos::algorithm::CGAlgorithmsDD;
+using geos::geom::Coordinate;
+using geos::geom::TrianglePredicate;
+using geos::triangulate::quadedge::QuadEdge;
+using geos::triangulate::quadedge::Vertex;
+
+namespace geos {
+namespace triangulate { //geos.triangulate
+
+namespace {
+
+int
+orientation(const Coordinate& p, const Coordinate& q, const Coordinate& r)
+{
+    return CGAlgorithmsDD::orientationIndex(p.x, p.y, q.x, q.y, r.x, r.y);
+}
+
+} // anonymous namespace
+
+DynamicDelaunayTriangulation::DynamicDelaunayTriangulation(const geom::Envelope& p_env, double tolerance)
+    : env(p_env)
+    , numSites(0)
+    , numRemovedEdges(0)
+{
+    // a frame around a single point is degenerate
+    if(env.isNull() || (env.getWidth() == 0.0 && env.getHeight() == 0.0)) {
+        throw util::IllegalArgumentException("Triangulation envelope must have an extent");
+    }
+    subdiv.reset(new quadedge::QuadEdgeSubdivision(env, tolerance));
+}
+
+DynamicDelaunayTriangulation::~DynamicDelaunayTriangulation() = default;
+
+QuadEdge*
+DynamicDelaunayTriangulation::findSite(const Coordinate& p)
+{
+    if(!env.contains(p)) {
+        return nullptr;
+    }
+    Vertex v(p);
+    QuadEdge* e = subdiv->locate(v);
+    if(!e) {
+        throw quadedge::LocateFailureException("Could not locate vertex.");
+    }
+    for(QuadEdge* x : { e, &e->sym() }) {
+        const Coordinate& site = x->orig().getCoordinate();
+        if(site.equals2D(p) || site.distance(p) < subdiv->getTolerance()) {
+            return x;
+        }
+    }
+    return nullptr;
+}
+
+bool
+DynamicDelaunayTriangulation::containsSite(const Coordinate& p)
+{
+    return findSite(p) != nullptr;
+}
+
+bool
+DynamicDelaunayTriangulation::insertSite(const Coordinate& p)
+{
+    if(!env.contains(p)) {
+        throw util::IllegalArgumentException("Site is outside of the triangulation envelope");
+    }
+    if(findSite(p)) {
+        return false;
+    }
+    IncrementalDelaunayTriangulator triangulator(subdiv.get());
+    triangulator.insertSite(Vertex(p));
+    numSites++;
+    return true;
+}
+
+std::size_t
+DynamicDelaunayTriangulation::insertSites(const geom::CoordinateSequence& coords)
+{
+    IncrementalDelaunayTriangulator::VertexList vertices;
+    vertices.reserve(coords.size());
+    for(std::size_t i = 0; i < coords.size(); i++) {
+        const Coordinate& p = coords.getAt(i);
+        if(!env.contains(p)) {
+            throw util::IllegalArgumentException("Site is outside of the triangulation envelope");
+        }
+        vertices.emplace_back(p);
+    }
+    IncrementalDelaunayTriangulator::sortBRIO(vertices);
+
+    std::size_t numInserted = 0;
+    for(const Vertex& v : vertices) {
+        if(insertSite(v.getCoordinate())) {
+            numInserted++;
+        }
+    }
+    return numInserted;
+}
+
+bool
+DynamicDelaunayTriangulation::removeSite(const Coordinate& p)
+{
+    QuadEdge* e = findSite(p);
+    if(!e) {
+        return false;
+    }
+    removeStar(*e);
+    numSites--;
+
+    if(2 * numRemovedEdges > subdiv->getEdges().size()) {
+        compact();
+    }
+    return true;
+}
+
+void
+DynamicDelaunayTriangulation::removeStar(QuadEdge& start)
+{
+    // copied, since flipping an edge overwrites its origin
+    const Coordinate v = start.orig().getCoordinate();
+
+    // Flip the edges of the star until the site has 3 neighbours.
+    // Flipping the edge to p[i] cuts the ear (p[i-1], p[i], p[i+1])
+    // off the polygon of the neighbours, which keeps the triangulation
+    // Delaunay if no other neighbour is in the circumcircle of the ear.
+    QuadEdge* e = &start;
+    std::vector<QuadEdge*> star;
+    for(;;) {
+        star.clear();
+        QuadEdge* x = e;
+        do {
+            star.push_back(x);
+            x = &x->oNext();
+        }
+        while(x != e);
+
+        const std::size_t n = star.size();
+        if(n <= 3) {
+            break;
+        }
+
+        std::size_t ear = n;
+        std::size_t flippable = n;
+        for(std::size_t i = 0; i < n && ear == n; i++) {
+            const Coordinate& a = star[(i + n - 1) % n]->dest().getCoordinate();
+            const Coordinate& b = star[i]->dest().getCoordinate();
+            const Coordinate& c = star[(i + 1) % n]->dest().getCoordinate();
+
+            // the ear must be convex, and the site outside of it. A site
+            // on the chord is left in a flat triangle, which is removed
+            // with the site.
+            if(orientation(a, b, c) <= 0 || orientation(a, c, v) < 0) {
+                continue;
+            }
+            if(flippable == n) {
+                flippable = i;
+            }
+
+            bool isEmpty = true;
+            for(std::size_t j = (i + 2) % n; j != (i + n - 1) % n; j = (j + 1) % n) {
+                if(TrianglePredicate::isInCircleRobust(a, b, c, star[j]->dest().getCoordinate())) {
+                    isEmpty = false;
+                    break;
+                }
+            }
+            if(isEmpty) {
+                ear = i;
+            }
+        }
+
+        // cocircular neighbours are not always resolved robustly
+        if(ear == n) {
+            ear = flippable;
+        }
+        if(ear == n) {
+            throw util::IllegalStateException("Could not remove site from triangulation");
+        }
+
+        if(star[ear] == e) {
+            e = star[(ear + 1) % n];
+        }
+        QuadEdge::swap(*star[ear]);
+    }
+
+    for(QuadEdge* x : star) {
+        subdiv->remove(*x);
+    }
+    numRemovedEdges += star.size();
+}
+
+void
+DynamicDelaunayTriangulation::compact()
+{
+    subdiv->setTriangulation({ &subdiv->getEdges() });
+    numRemovedEdges = 0;
+}
+
+quadedge::QuadEdgeSubdivision&
+DynamicDelaunayTriangulation::getSubdivision()
+{
+    if(numRemovedEdges > 0) {
+        compact();
+    }
+    return *subdiv;
+}
+
+std::unique_ptr<geom::GeometryCollection>
+DynamicDelaunayTriangulation::getTriangles(const geom::GeometryFactory& geomFact)
+{
+    return subdiv->getTriangles(geomFact);
+}
+
+quadedge::TriangleMesh
+DynamicDelaunayTriangulation::getTriangleMesh(bool includeNeighbours)
+{
+    quadedge::TriangleMesh mesh;
+    subdiv->getTriangleMesh(mesh, includeNeighbours);
+    return mesh;
+}
+
+void
+DynamicDelaunayTriangulation::getVoronoiCells(quadedge::VoronoiCells& cells)
+{
+    subdiv->getVoronoiCells(cells, &env);
+}
+
+} //namespace geos.triangulate
+} //namespace goes
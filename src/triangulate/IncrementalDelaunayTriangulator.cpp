@@ -18,32 +18,151 @@
 
 #include <geos/triangulate/IncrementalDelaunayTriangulator.h>
 
+#include <geos/triangulate/quadedge/HalfEdgeSubdivision.h>
 #include <geos/triangulate/quadedge/QuadEdge.h>
 #include <geos/triangulate/quadedge/QuadEdgeSubdivision.h>
 #include <geos/triangulate/quadedge/LocateFailureException.h>
+#include <geos/shape/fractal/HilbertCode.h>
+#include <geos/shape/fractal/HilbertEncoder.h>
+#include <geos/geom/Envelope.h>
+#include <geos/triangulate/quadedge/TrianglePredicate.h>
+#include <geos/util/IllegalStateException.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <utility>
 
 namespace geos {
 namespace triangulate { //geos.triangulate
 
 using namespace quadedge;
 
+namespace {
+
+/*
+ * Sorts vertices by (key, Hilbert code), keeping the permutation
+ * out of the Vertex array to avoid swapping full vertices.
+ */
+void
+sortByKeyAndHilbertCode(IncrementalDelaunayTriangulator::VertexList& vertices,
+                        const std::vector<uint32_t>& keys)
+{
+    using shape::fractal::HilbertCode;
+    using shape::fractal::HilbertEncoder;
+
+    if(vertices.size() < 2) {
+        return;
+    }
+
+    geom::Envelope extent;
+    for(const Vertex& v : vertices) {
+        extent.expandToInclude(v.getCoordinate());
+    }
+    // the encoder divides by the extent sides
+    if(extent.getWidth() == 0.0 || extent.getHeight() == 0.0) {
+        extent.expandBy(1.0);
+    }
+
+    HilbertEncoder encoder(HilbertCode::MAX_LEVEL, extent);
+    std::vector<std::pair<uint64_t, std::size_t>> order(vertices.size());
+    for(std::size_t i = 0; i < vertices.size(); i++) {
+        geom::Envelope env(vertices[i].getCoordinate());
+        uint64_t key = keys.empty() ? 0 : keys[i];
+        order[i] = std::make_pair((key << 32) | encoder.encode(&env), i);
+    }
+    std::sort(order.begin(), order.end());
+
+    IncrementalDelaunayTriangulator::VertexList sorted;
+    sorted.reserve(vertices.size());
+    for(const auto& o : order) {
+        sorted.push_back(vertices[o.second]);
+    }
+    vertices.swap(sorted);
+}
+
+} // anonymous namespace
+
 IncrementalDelaunayTriangulator::IncrementalDelaunayTriangulator(
     QuadEdgeSubdivision* p_subdiv) :
-    subdiv(p_subdiv), isUsingTolerance(p_subdiv->getTolerance() > 0.0)
+    subdiv(p_subdiv), halfEdgeSubdiv(nullptr), isUsingTolerance(p_subdiv->getTolerance() > 0.0)
+{
+}
+
+IncrementalDelaunayTriangulator::IncrementalDelaunayTriangulator(
+    HalfEdgeSubdivision* p_subdiv) :
+    subdiv(nullptr), halfEdgeSubdiv(p_subdiv), isUsingTolerance(p_subdiv->getTolerance() > 0.0)
 {
 }
 
 void
 IncrementalDelaunayTriangulator::insertSites(const VertexList& vertices)
 {
+    if(halfEdgeSubdiv) {
+        halfEdgeSubdiv->reserve(halfEdgeSubdiv->getNumVertices() + vertices.size());
+        std::vector<int32_t> suspectEdges;
+        for(const auto& vertex : vertices) {
+            insertSite(*halfEdgeSubdiv, vertex, suspectEdges);
+        }
+        return;
+    }
     for(const auto& vertex : vertices) {
         insertSite(vertex);
     }
 }
 
+void
+IncrementalDelaunayTriangulator::insertSite(HalfEdgeSubdivision& heSubdiv, const Vertex& v,
+                                            std::vector<int32_t>& suspectEdges)
+{
+    double x = v.getX();
+    double y = v.getY();
+    int32_t e = heSubdiv.locate(x, y);
+    if(heSubdiv.isVertexOfEdge(e, x, y)) {
+        // point is already in subdivision.
+        return;
+    }
+
+    int32_t p = heSubdiv.addVertex(x, y, v.getZ());
+    suspectEdges.clear();
+    if(heSubdiv.twin(e) >= 0 && heSubdiv.isOnEdge(e, x, y)) {
+        heSubdiv.splitEdge(e, p, suspectEdges);
+    }
+    else {
+        heSubdiv.splitTriangle(e, p, suspectEdges);
+    }
+
+    // The suspect edges are opposite to p in their triangle. Flipping
+    // one makes the two edges beyond it suspect.
+    geom::Coordinate pc(x, y);
+    while(!suspectEdges.empty()) {
+        e = suspectEdges.back();
+        suspectEdges.pop_back();
+        int32_t f = heSubdiv.twin(e);
+        if(f < 0) {
+            continue;
+        }
+        int32_t a = heSubdiv.orig(e);
+        int32_t b = heSubdiv.dest(e);
+        int32_t d = heSubdiv.orig(HalfEdgeSubdivision::prev(f));
+        if(geom::TrianglePredicate::isInCircleRobust(
+                    geom::Coordinate(heSubdiv.getX(a), heSubdiv.getY(a)),
+                    geom::Coordinate(heSubdiv.getX(b), heSubdiv.getY(b)),
+                    pc,
+                    geom::Coordinate(heSubdiv.getX(d), heSubdiv.getY(d)))) {
+            heSubdiv.flip(e);
+            suspectEdges.push_back(HalfEdgeSubdivision::prev(e));
+            suspectEdges.push_back(HalfEdgeSubdivision::next(f));
+        }
+    }
+}
+
 QuadEdge&
 IncrementalDelaunayTriangulator::insertSite(const Vertex& v)
 {
+    if(!subdiv) {
+        throw util::IllegalStateException("Sites of a HalfEdgeSubdivision must be inserted with insertSites");
+    }
     /*
      * This code is based on Guibas and Stolfi (1985), with minor modifications
      * and a bug fix from Dani Lischinski (Graphic Gems 1993). (The modification
@@ -101,6 +220,40 @@ IncrementalDelaunayTriangulator::insertSite(const Vertex& v)
     }
 }
 
+void
+IncrementalDelaunayTriangulator::sortHilbert(VertexList& vertices)
+{
+    sortByKeyAndHilbertCode(vertices, std::vector<uint32_t>());
+}
+
+void
+IncrementalDelaunayTriangulator::sortBRIO(VertexList& vertices, unsigned int seed)
+{
+    std::size_t n = vertices.size();
+
+    // number of rounds, such that the first round holds a few vertices
+    uint32_t numRounds = 1;
+    while((n >> numRounds) > 16) {
+        numRounds++;
+    }
+
+    // A vertex falls in the last round with probability 1/2, in the
+    // one before with probability 1/4, and so on.
+    std::mt19937 rng(seed);
+    std::vector<uint32_t> rounds(n);
+    for(std::size_t i = 0; i < n; i++) {
+        uint32_t bits = static_cast<uint32_t>(rng());
+        uint32_t level = 0;
+        while(level < numRounds - 1 && (bits & 1u)) {
+            bits >>= 1;
+            level++;
+        }
+        rounds[i] = numRounds - 1 - level;
+    }
+
+    sortByKeyAndHilbertCode(vertices, rounds);
+}
+
 } //namespace geos.triangulate
 } //namespace goes
 
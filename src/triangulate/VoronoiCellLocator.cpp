@@ -0,0 +1,129 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2021 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/triangulate/VoronoiCellLocator.h>
+
+#include <geos/triangulate/quadedge/VoronoiCells.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace geos {
+namespace triangulate { //geos.triangulate
+
+VoronoiCellLocator::VoronoiCellLocator(const quadedge::VoronoiCells& p_cells)
+    : cells(p_cells)
+    , numCols(1)
+    , numRows(1)
+    , cellWidth(0)
+    , cellHeight(0)
+{
+    const std::size_t numCells = cells.getNumCells();
+    for(std::size_t i = 0; i < cells.vertices.size(); i += 2) {
+        extent.expandToInclude(cells.vertices[i], cells.vertices[i + 1]);
+    }
+    if(extent.isNull()) {
+        bucketOffsets.assign(2, 0);
+        return;
+    }
+
+    // about one bucket per cell, in the aspect ratio of the extent
+    double width = extent.getWidth();
+    double height = extent.getHeight();
+    if(width > 0 && height > 0) {
+        double side = std::sqrt(width * height / static_cast<double>(numCells));
+        numCols = std::max<std::size_t>(1, static_cast<std::size_t>(width / side));
+        numRows = std::max<std::size_t>(1, static_cast<std::size_t>(height / side));
+    }
+    cellWidth = width / static_cast<double>(numCols);
+    cellHeight = height / static_cast<double>(numRows);
+
+    // count the cells of each bucket, then fill them
+    std::vector<std::size_t> bounds(4 * numCells);
+    bucketOffsets.assign(numCols * numRows + 1, 0);
+    for(std::size_t i = 0; i < numCells; i++) {
+        geom::Envelope env;
+        for(std::size_t j = cells.offsets[i]; j < cells.offsets[i + 1]; j++) {
+            env.expandToInclude(cells.vertices[2 * j], cells.vertices[2 * j + 1]);
+        }
+        bounds[4 * i] = col(env.getMinX());
+        bounds[4 * i + 1] = col(env.getMaxX());
+        bounds[4 * i + 2] = row(env.getMinY());
+        bounds[4 * i + 3] = row(env.getMaxY());
+        for(std::size_t r = bounds[4 * i + 2]; r <= bounds[4 * i + 3]; r++) {
+            for(std::size_t c = bounds[4 * i]; c <= bounds[4 * i + 1]; c++) {
+                bucketOffsets[r * numCols + c + 1]++;
+            }
+        }
+    }
+    for(std::size_t i = 1; i < bucketOffsets.size(); i++) {
+        bucketOffsets[i] += bucketOffsets[i - 1];
+    }
+
+    bucketCells.resize(bucketOffsets.back());
+    std::vector<std::size_t> next(bucketOffsets.begin(), bucketOffsets.end() - 1);
+    for(std::size_t i = 0; i < numCells; i++) {
+        for(std::size_t r = bounds[4 * i + 2]; r <= bounds[4 * i + 3]; r++) {
+            for(std::size_t c = bounds[4 * i]; c <= bounds[4 * i + 1]; c++) {
+                bucketCells[next[r * numCols + c]++] = i;
+            }
+        }
+    }
+}
+
+std::size_t
+VoronoiCellLocator::col(double x) const
+{
+    if(cellWidth <= 0) {
+        return 0;
+    }
+    double c = std::floor((x - extent.getMinX()) / cellWidth);
+    return static_cast<std::size_t>(std::min(std::max(c, 0.0), static_cast<double>(numCols - 1)));
+}
+
+std::size_t
+VoronoiCellLocator::row(double y) const
+{
+    if(cellHeight <= 0) {
+        return 0;
+    }
+    double r = std::floor((y - extent.getMinY()) / cellHeight);
+    return static_cast<std::size_t>(std::min(std::max(r, 0.0), static_cast<double>(numRows - 1)));
+}
+
+bool
+VoronoiCellLocator::locate(double x, double y, std::size_t& cell) const
+{
+    if(!extent.contains(x, y)) {
+        return false;
+    }
+
+    std::size_t bucket = row(y) * numCols + col(x);
+    double minDistSq = std::numeric_limits<double>::infinity();
+    for(std::size_t i = bucketOffsets[bucket]; i < bucketOffsets[bucket + 1]; i++) {
+        std::size_t c = bucketCells[i];
+        double dx = cells.sites[2 * c] - x;
+        double dy = cells.sites[2 * c + 1] - y;
+        double distSq = dx * dx + dy * dy;
+        if(distSq < minDistSq) {
+            minDistSq = distSq;
+            cell = c;
+        }
+    }
+    return minDistSq < std::numeric_limits<double>::infinity();
+}
+
+} //namespace geos.triangulate
+} //namespace goes
@@ -50,12 +50,41 @@ void
 VoronoiDiagramBuilder::setSites(const geom::Geometry& geom)
 {
     siteCoords = DelaunayTriangulationBuilder::extractUniqueCoordinates(geom);
+
+    // the unique coordinates are sorted, so the first input index of
+    // each one is found by sorting the input positions the same way
+    std::unique_ptr<CoordinateSequence> coords(geom.getCoordinates());
+    std::vector<std::size_t> order(coords->size());
+    for(std::size_t i = 0; i < order.size(); i++) {
+        order[i] = i;
+    }
+    CoordinateLessThen lessThen;
+    std::stable_sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) {
+        return lessThen(coords->getAt(a), coords->getAt(b));
+    });
+
+    siteInputIndex.clear();
+    siteInputIndex.reserve(siteCoords->size());
+    for(std::size_t i = 0; i < order.size(); i++) {
+        if(i == 0 || !coords->getAt(order[i]).equals2D(coords->getAt(order[i - 1]))) {
+            siteInputIndex.push_back(order[i]);
+        }
+    }
 }
 
 void
 VoronoiDiagramBuilder::setSites(const geom::CoordinateSequence& coords)
 {
     siteCoords = operation::valid::RepeatedPointRemover::removeRepeatedPoints(&coords);
+
+    // consecutive repeated points are removed
+    siteInputIndex.clear();
+    siteInputIndex.reserve(siteCoords->size());
+    for(std::size_t i = 0; i < coords.size(); i++) {
+        if(i == 0 || !coords.getAt(i).equals2D(coords.getAt(siteInputIndex.back()))) {
+            siteInputIndex.push_back(i);
+        }
+    }
 }
 
 void
@@ -129,6 +158,41 @@ VoronoiDiagramBuilder::getDiagramEdges(const geom::GeometryFactory& geomFact)
     return clipped;
 }
 
+quadedge::VoronoiCells
+VoronoiDiagramBuilder::getDiagramCells()
+{
+    quadedge::VoronoiCells cells;
+    if(siteCoords == nullptr || siteCoords->isEmpty()) {
+        cells.offsets.push_back(0);
+        return cells;
+    }
+
+    create();
+    subdiv->getVoronoiCells(cells, &diagramEnv);
+
+    // look up the sites of the cells in the site coordinates; the stable
+    // sort keeps the first of the repeated ones in front
+    std::vector<std::size_t> order(siteCoords->size());
+    for(std::size_t i = 0; i < order.size(); i++) {
+        order[i] = i;
+    }
+    CoordinateLessThen lessThen;
+    std::stable_sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) {
+        return lessThen(siteCoords->getAt(a), siteCoords->getAt(b));
+    });
+
+    cells.siteIndices.resize(cells.getNumCells());
+    for(std::size_t i = 0; i < cells.getNumCells(); i++) {
+        Coordinate site(cells.sites[2 * i], cells.sites[2 * i + 1]);
+        auto it = std::lower_bound(order.begin(), order.end(), site, [&](std::size_t a, const Coordinate& c) {
+            return lessThen(siteCoords->getAt(a), c);
+        });
+        cells.siteIndices[i] = siteInputIndex[*it];
+    }
+
+    return cells;
+}
+
 std::unique_ptr<geom::GeometryCollection>
 VoronoiDiagramBuilder::clipGeometryCollection(std::vector<std::unique_ptr<Geometry>> & geoms, const geom::Envelope& clipEnv)
 {
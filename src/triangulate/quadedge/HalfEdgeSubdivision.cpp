@@ -0,0 +1,449 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2021 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/triangulate/quadedge/HalfEdgeSubdivision.h>
+
+#include <geos/algorithm/CGAlgorithmsDD.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/CoordinateSequenceFactory.h>
+#include <geos/geom/GeometryCollection.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/LineSegment.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/Polygon.h>
+#include <geos/triangulate/quadedge/LocateFailureException.h>
+#include <geos/triangulate/quadedge/QuadEdge.h>
+#include <geos/triangulate/quadedge/QuadEdgeQuartet.h>
+#include <geos/triangulate/quadedge/QuadEdgeSubdivision.h>
+#include <geos/triangulate/quadedge/TriangleMesh.h>
+#include <geos/util/IllegalArgumentException.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <deque>
+#include <limits>
+
+using namespace geos::geom;
+
+namespace geos {
+namespace triangulate { //geos.triangulate
+namespace quadedge { //geos.triangulate.quadedge
+
+HalfEdgeSubdivision::HalfEdgeSubdivision(const geom::Envelope& env, double p_tolerance) :
+    tolerance(p_tolerance),
+    edgeCoincidenceTolerance(p_tolerance / EDGE_COINCIDENCE_TOL_FACTOR),
+    siteEnv(env),
+    lastEdge(0)
+{
+    // the frame of QuadEdgeSubdivision::createFrame
+    double offset = std::max(env.getWidth(), env.getHeight()) * 10.0;
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    addVertex((env.getMaxX() + env.getMinX()) / 2.0, env.getMaxY() + offset, nan);
+    addVertex(env.getMinX() - offset, env.getMinY() - offset, nan);
+    addVertex(env.getMaxX() + offset, env.getMinY() - offset, nan);
+
+    setTriangle(newTriangle(), 0, 1, 2);
+}
+
+HalfEdgeSubdivision::~HalfEdgeSubdivision() = default;
+
+void
+HalfEdgeSubdivision::reserve(std::size_t numSites)
+{
+    xs.reserve(numSites + 3);
+    ys.reserve(numSites + 3);
+    // a triangulation of n sites in a triangle has 2n + 1 triangles
+    origins.reserve(6 * numSites + 3);
+    twins.reserve(6 * numSites + 3);
+}
+
+double
+HalfEdgeSubdivision::getZ(int32_t v) const
+{
+    return zs.empty() ? std::numeric_limits<double>::quiet_NaN() : zs[static_cast<std::size_t>(v)];
+}
+
+int32_t
+HalfEdgeSubdivision::addVertex(double x, double y, double z)
+{
+    if(xs.size() >= static_cast<std::size_t>(std::numeric_limits<int32_t>::max())) {
+        throw util::IllegalArgumentException("Triangulation is too large for 32-bit indices");
+    }
+    if(zs.empty() && !std::isnan(z)) {
+        zs.assign(xs.size(), std::numeric_limits<double>::quiet_NaN());
+    }
+    xs.push_back(x);
+    ys.push_back(y);
+    if(!zs.empty()) {
+        zs.push_back(z);
+    }
+    return static_cast<int32_t>(xs.size() - 1);
+}
+
+int32_t
+HalfEdgeSubdivision::newTriangle()
+{
+    if(origins.size() > static_cast<std::size_t>(std::numeric_limits<int32_t>::max() - 3)) {
+        throw util::IllegalArgumentException("Triangulation is too large for 32-bit indices");
+    }
+    int32_t e = static_cast<int32_t>(origins.size());
+    origins.resize(origins.size() + 3);
+    twins.resize(twins.size() + 3, -1);
+    return e;
+}
+
+void
+HalfEdgeSubdivision::setTriangle(int32_t e, int32_t v0, int32_t v1, int32_t v2)
+{
+    std::size_t i = static_cast<std::size_t>(e);
+    origins[i] = v0;
+    origins[i + 1] = v1;
+    origins[i + 2] = v2;
+}
+
+int
+HalfEdgeSubdivision::orientation(int32_t e, double x, double y) const
+{
+    int32_t a = orig(e);
+    int32_t b = dest(e);
+    return algorithm::CGAlgorithmsDD::orientationIndex(getX(a), getY(a), getX(b), getY(b), x, y);
+}
+
+int32_t
+HalfEdgeSubdivision::locate(double x, double y)
+{
+    int32_t e = lastEdge;
+    bool entered = false;
+    std::size_t maxIter = origins.size() + 3;
+
+    for(std::size_t iter = 0; ; iter++) {
+        if(iter > maxIter) {
+            throw LocateFailureException("Could not locate vertex.");
+        }
+
+        // cross an edge having the point on its right; the edge through
+        // which the triangle was entered has it on its left. Alternating
+        // the order of the other two avoids cycling on degenerate input.
+        int32_t f1 = (iter & 1) ? next(e) : prev(e);
+        int32_t f2 = (iter & 1) ? prev(e) : next(e);
+        int32_t crossed = -1;
+        if(!entered && orientation(e, x, y) < 0) {
+            crossed = e;
+        }
+        else if(orientation(f1, x, y) < 0) {
+            crossed = f1;
+        }
+        else if(orientation(f2, x, y) < 0) {
+            crossed = f2;
+        }
+
+        if(crossed < 0) {
+            break;
+        }
+        e = twin(crossed);
+        if(e < 0) {
+            throw LocateFailureException("Vertex is outside of the subdivision frame.");
+        }
+        entered = true;
+    }
+
+    // the point is in the triangle of e, or on its boundary: prefer an
+    // edge starting at the point, then one ending near it or containing it
+    const int32_t tri[3] = { e, next(e), prev(e) };
+    int32_t result = -1;
+    for(int32_t f : tri) {
+        if(getX(orig(f)) == x && getY(orig(f)) == y) {
+            result = f;
+            break;
+        }
+    }
+    for(std::size_t i = 0; i < 3 && result < 0; i++) {
+        if(isVertexOfEdge(tri[i], x, y)) {
+            result = tri[i];
+        }
+    }
+    for(std::size_t i = 0; i < 3 && result < 0; i++) {
+        if(isOnEdge(tri[i], x, y)) {
+            result = tri[i];
+        }
+    }
+    if(result < 0) {
+        result = e;
+    }
+    lastEdge = result;
+    return result;
+}
+
+bool
+HalfEdgeSubdivision::isVertexOfEdge(int32_t e, double x, double y) const
+{
+    Coordinate p(x, y);
+    for(int32_t v : { orig(e), dest(e) }) {
+        if((getX(v) == x && getY(v) == y) || p.distance(Coordinate(getX(v), getY(v))) < tolerance) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool
+HalfEdgeSubdivision::isOnEdge(int32_t e, double x, double y) const
+{
+    int32_t a = orig(e);
+    int32_t b = dest(e);
+    if(orientation(e, x, y) == 0) {
+        return x >= std::min(getX(a), getX(b)) && x <= std::max(getX(a), getX(b))
+               && y >= std::min(getY(a), getY(b)) && y <= std::max(getY(a), getY(b));
+    }
+    if(edgeCoincidenceTolerance > 0.0) {
+        LineSegment seg(getX(a), getY(a), getX(b), getY(b));
+        return seg.distance(Coordinate(x, y)) < edgeCoincidenceTolerance;
+    }
+    return false;
+}
+
+void
+HalfEdgeSubdivision::splitTriangle(int32_t e, int32_t v, std::vector<int32_t>& opposite)
+{
+    // triangle (a, b, c) becomes (a, b, v), (b, c, v) and (c, a, v)
+    int32_t base = e - e % 3;
+    int32_t a = orig(base);
+    int32_t b = orig(base + 1);
+    int32_t c = orig(base + 2);
+    int32_t twinBC = twin(base + 1);
+    int32_t twinCA = twin(base + 2);
+
+    int32_t t1 = newTriangle();
+    int32_t t2 = newTriangle();
+    setTriangle(base, a, b, v);
+    setTriangle(t1, b, c, v);
+    setTriangle(t2, c, a, v);
+
+    link(t1, twinBC);
+    link(t2, twinCA);
+    link(base + 1, t1 + 2);
+    link(base + 2, t2 + 1);
+    link(t1 + 1, t2 + 2);
+
+    opposite.push_back(base);
+    opposite.push_back(t1);
+    opposite.push_back(t2);
+}
+
+void
+HalfEdgeSubdivision::splitEdge(int32_t e, int32_t v, std::vector<int32_t>& opposite)
+{
+    // e (a, b) in triangle (a, b, c) and its twin f (b, a) in (b, a, d)
+    // become (a, v, c), (v, b, c), (b, v, d) and (v, a, d)
+    int32_t f = twin(e);
+    int32_t a = orig(e);
+    int32_t b = orig(f);
+    int32_t c = orig(prev(e));
+    int32_t d = orig(prev(f));
+    int32_t twinBC = twin(next(e));
+    int32_t twinAD = twin(next(f));
+
+    int32_t te = newTriangle();
+    int32_t tf = newTriangle();
+    origins[static_cast<std::size_t>(next(e))] = v;
+    origins[static_cast<std::size_t>(next(f))] = v;
+    setTriangle(te, v, b, c);
+    setTriangle(tf, v, a, d);
+
+    link(te + 1, twinBC);
+    link(tf + 1, twinAD);
+    link(e, tf);
+    link(f, te);
+    link(next(e), te + 2);
+    link(next(f), tf + 2);
+
+    opposite.push_back(prev(e));
+    opposite.push_back(te + 1);
+    opposite.push_back(prev(f));
+    opposite.push_back(tf + 1);
+}
+
+void
+HalfEdgeSubdivision::flip(int32_t e)
+{
+    // (a, b, c) and (b, a, d) become (d, c, a) and (c, d, b)
+    int32_t f = twin(e);
+    int32_t ne = next(e);
+    int32_t pe = prev(e);
+    int32_t nf = next(f);
+    int32_t pf = prev(f);
+
+    int32_t a = orig(e);
+    int32_t b = orig(f);
+    int32_t c = orig(pe);
+    int32_t d = orig(pf);
+    int32_t twinBC = twin(ne);
+    int32_t twinCA = twin(pe);
+    int32_t twinAD = twin(nf);
+    int32_t twinDB = twin(pf);
+
+    origins[static_cast<std::size_t>(e)] = d;
+    origins[static_cast<std::size_t>(ne)] = c;
+    origins[static_cast<std::size_t>(pe)] = a;
+    origins[static_cast<std::size_t>(f)] = c;
+    origins[static_cast<std::size_t>(nf)] = d;
+    origins[static_cast<std::size_t>(pf)] = b;
+
+    link(e, f);
+    link(ne, twinCA);
+    link(pe, twinAD);
+    link(nf, twinDB);
+    link(pf, twinBC);
+}
+
+std::unique_ptr<GeometryCollection>
+HalfEdgeSubdivision::getTriangles(const GeometryFactory& geomFact) const
+{
+    auto coordSeqFact = geomFact.getCoordinateSequenceFactory();
+    std::vector<std::unique_ptr<Geometry>> tris;
+    visitTriangles([&](int32_t e) {
+        auto coordSeq = coordSeqFact->create(4, 0);
+        for(std::size_t i = 0; i < 4; i++) {
+            int32_t v = orig(e + static_cast<int32_t>(i % 3));
+            coordSeq->setAt(Coordinate(getX(v), getY(v), getZ(v)), i);
+        }
+        tris.push_back(geomFact.createPolygon(geomFact.createLinearRing(std::move(coordSeq))));
+    }, false);
+
+    return geomFact.createGeometryCollection(std::move(tris));
+}
+
+void
+HalfEdgeSubdivision::getTriangleMesh(TriangleMesh& mesh, bool includeNeighbours) const
+{
+    mesh.vertices.clear();
+    mesh.triangles.clear();
+    mesh.neighbours.clear();
+
+    // vertices are numbered in insertion order, after the frame
+    mesh.vertices.reserve(3 * (getNumVertices() - 3));
+    for(int32_t v = 3; v < static_cast<int32_t>(getNumVertices()); v++) {
+        mesh.vertices.push_back(getX(v));
+        mesh.vertices.push_back(getY(v));
+        mesh.vertices.push_back(getZ(v));
+    }
+
+    std::vector<int32_t> triIndex;
+    if(includeNeighbours) {
+        triIndex.assign(getNumTriangles(), -1);
+    }
+    visitTriangles([&](int32_t e) {
+        if(includeNeighbours) {
+            triIndex[static_cast<std::size_t>(e / 3)] = static_cast<int32_t>(mesh.triangles.size() / 3);
+        }
+        for(int32_t i = 0; i < 3; i++) {
+            mesh.triangles.push_back(orig(e + i) - 3);
+        }
+    }, false);
+
+    if(includeNeighbours) {
+        mesh.neighbours.reserve(mesh.triangles.size());
+        visitTriangles([&](int32_t e) {
+            for(int32_t i = 0; i < 3; i++) {
+                int32_t t = twin(e + i);
+                mesh.neighbours.push_back(t < 0 ? -1 : triIndex[static_cast<std::size_t>(t / 3)]);
+            }
+        }, false);
+    }
+}
+
+std::unique_ptr<QuadEdgeSubdivision>
+HalfEdgeSubdivision::toQuadEdgeSubdivision() const
+{
+    // Each edge is a quartet, whose edge 0 is the half-edge of lower index
+    // (or the frame border half-edge) and edge 2 its twin. The twins of
+    // the frame border half-edges bound the outer face.
+    const std::size_t n = origins.size();
+    std::vector<int32_t> quadIndex(n);
+    int32_t numQuartets = 0;
+    std::array<int32_t, 3> borderFrom {{ -1, -1, -1 }};
+    std::array<int32_t, 3> borderTo {{ -1, -1, -1 }};
+    for(int32_t e = 0; e < static_cast<int32_t>(n); e++) {
+        int32_t f = twin(e);
+        if(f < 0) {
+            borderFrom[static_cast<std::size_t>(orig(e))] = e;
+            borderTo[static_cast<std::size_t>(dest(e))] = e;
+        }
+        if(f < 0 || e < f) {
+            quadIndex[static_cast<std::size_t>(e)] = 4 * numQuartets;
+            if(f >= 0) {
+                quadIndex[static_cast<std::size_t>(f)] = 4 * numQuartets + 2;
+            }
+            numQuartets++;
+        }
+    }
+
+    std::deque<QuadEdgeQuartet> quartets(static_cast<std::size_t>(numQuartets));
+    auto edgeAt = [&quartets](int32_t i) -> QuadEdge& {
+        QuadEdge& base = quartets[static_cast<std::size_t>(i / 4)].base();
+        switch(i % 4) {
+        case 1:
+            return base.rot();
+        case 2:
+            return base.sym();
+        case 3:
+            return base.invRot();
+        default:
+            return base;
+        }
+    };
+    auto symOf = [](int32_t i) {
+        return i ^ 2;
+    };
+    auto invRotOf = [](int32_t i) {
+        return i - i % 4 + (i + 3) % 4;
+    };
+
+    for(int32_t e = 0; e < static_cast<int32_t>(n); e++) {
+        int32_t f = twin(e);
+        if(f >= 0 && f < e) {
+            continue;
+        }
+        int32_t q = quadIndex[static_cast<std::size_t>(e)];
+        QuadEdge& qe = edgeAt(q);
+        qe.setOrig(Vertex(getX(orig(e)), getY(orig(e)), getZ(orig(e))));
+        qe.sym().setOrig(Vertex(getX(dest(e)), getY(dest(e)), getZ(dest(e))));
+
+        // oNext(e) is the twin of the edge before it in its triangle
+        qe.setNext(&edgeAt(symOf(quadIndex[static_cast<std::size_t>(prev(e))])));
+        // lNext(e) is the next edge in its triangle
+        qe.invRot().setNext(&edgeAt(invRotOf(quadIndex[static_cast<std::size_t>(next(e))])));
+        if(f >= 0) {
+            qe.sym().setNext(&edgeAt(symOf(quadIndex[static_cast<std::size_t>(prev(f))])));
+            qe.rot().setNext(&edgeAt(invRotOf(quadIndex[static_cast<std::size_t>(next(f))])));
+        }
+        else {
+            // around the outer face, from the destination of e
+            int32_t from = borderFrom[static_cast<std::size_t>(dest(e))];
+            int32_t to = borderTo[static_cast<std::size_t>(orig(e))];
+            qe.sym().setNext(&edgeAt(quadIndex[static_cast<std::size_t>(from)]));
+            qe.rot().setNext(&edgeAt(invRotOf(symOf(quadIndex[static_cast<std::size_t>(to)]))));
+        }
+    }
+
+    std::unique_ptr<QuadEdgeSubdivision> subdiv(new QuadEdgeSubdivision(siteEnv, tolerance));
+    subdiv->setTriangulation({ &quartets });
+    return subdiv;
+}
+
+} //namespace geos.triangulate.quadedge
+} //namespace geos.triangulate
+} //namespace goes
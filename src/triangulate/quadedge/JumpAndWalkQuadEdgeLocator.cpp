@@ -0,0 +1,67 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2021 GEOS Contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/triangulate/quadedge/JumpAndWalkQuadEdgeLocator.h>
+#include <geos/triangulate/quadedge/QuadEdgeSubdivision.h>
+
+#include <cmath>
+
+namespace geos {
+namespace triangulate { //geos.triangulate
+namespace quadedge { //geos.triangulate.quadedge
+
+JumpAndWalkQuadEdgeLocator::JumpAndWalkQuadEdgeLocator(QuadEdgeSubdivision* p_subdiv) :
+    subdiv(p_subdiv), lastEdge(nullptr)
+{
+}
+
+std::size_t
+JumpAndWalkQuadEdgeLocator::sampleSize(std::size_t numEdges)
+{
+    return static_cast<std::size_t>(std::cbrt(static_cast<double>(numEdges)));
+}
+
+QuadEdge*
+JumpAndWalkQuadEdgeLocator::locate(const Vertex& v)
+{
+    auto& edges = subdiv->getEdges();
+    const geom::Coordinate& p = v.getCoordinate();
+
+    // the first edge is part of the frame and is never removed
+    QuadEdge* start = &edges[0].base();
+    if(lastEdge && lastEdge->isLive()) {
+        start = lastEdge;
+    }
+    double startDist = start->orig().getCoordinate().distanceSquared(p);
+
+    std::size_t numEdges = edges.size();
+    for(std::size_t i = 0, n = sampleSize(numEdges); i < n; i++) {
+        QuadEdge& e = edges[rng() % numEdges].base();
+        if(!e.isLive()) {
+            continue;
+        }
+        double dist = e.orig().getCoordinate().distanceSquared(p);
+        if(dist < startDist) {
+            start = &e;
+            startDist = dist;
+        }
+    }
+
+    lastEdge = subdiv->locateFromEdge(v, *start);
+    return lastEdge;
+}
+
+} //namespace geos.triangulate.quadedge
+} //namespace geos.triangulate
+} //namespace goes
@@ -19,6 +19,7 @@
 #include <geos/triangulate/quadedge/QuadEdgeSubdivision.h>
 
 #include <algorithm>
+#include <limits>
 #include <vector>
 #include <set>
 #include <iostream>
@@ -39,6 +40,9 @@
 #include <geos/triangulate/quadedge/LastFoundQuadEdgeLocator.h>
 #include <geos/triangulate/quadedge/LocateFailureException.h>
 #include <geos/triangulate/quadedge/TriangleVisitor.h>
+#include <geos/triangulate/quadedge/TriangleMesh.h>
+#include <geos/triangulate/quadedge/VoronoiCells.h>
+#include <geos/util/IllegalArgumentException.h>
 #include <geos/geom/Triangle.h>
 
 
@@ -134,16 +138,89 @@ QuadEdgeSubdivision::remove(QuadEdge& e)
     e.remove();
 }
 
+namespace {
+
+// The edges of a quartet, indexed by their position in it
+std::array<QuadEdge*, 4>
+quartetEdges(QuadEdgeQuartet& q)
+{
+    QuadEdge& e = q.base();
+    return {{ &e, &e.rot(), &e.sym(), &e.invRot() }};
+}
+
+} // anonymous namespace
+
+void
+QuadEdgeSubdivision::setTriangulation(const std::vector<std::deque<QuadEdgeQuartet>*>& edgeSets)
+{
+    // Number the live quartets, storing 4 * number + position in each edge
+    std::size_t numLive = 0;
+    for(auto* edges : edgeSets) {
+        for(auto& q : *edges) {
+            if(!q.base().isLive()) {
+                continue;
+            }
+            if(numLive >= static_cast<std::size_t>(std::numeric_limits<int32_t>::max() / 4)) {
+                throw util::IllegalArgumentException("Triangulation has too many edges");
+            }
+            auto qe = quartetEdges(q);
+            for(int32_t i = 0; i < 4; i++) {
+                qe[static_cast<std::size_t>(i)]->setData(static_cast<int32_t>(4 * numLive) + i);
+            }
+            numLive++;
+        }
+    }
+
+    std::deque<QuadEdgeQuartet> newEdges;
+    newEdges.resize(numLive);
+
+    std::size_t k = 0;
+    for(auto* edges : edgeSets) {
+        for(auto& q : *edges) {
+            if(!q.base().isLive()) {
+                continue;
+            }
+            auto src = quartetEdges(q);
+            auto dst = quartetEdges(newEdges[k++]);
+            for(std::size_t i = 0; i < 4; i++) {
+                int32_t next = src[i]->oNext().getData();
+                auto target = quartetEdges(newEdges[static_cast<std::size_t>(next / 4)]);
+                dst[i]->setOrig(src[i]->orig());
+                dst[i]->setNext(target[static_cast<std::size_t>(next % 4)]);
+            }
+        }
+    }
+
+    // find the frame edges, oriented as in initSubdiv
+    std::array<QuadEdge*, 3> frameEdges {{ nullptr, nullptr, nullptr }};
+    for(auto& q : newEdges) {
+        for(QuadEdge* e : { &q.base(), &q.base().sym() }) {
+            for(std::size_t i = 0; i < 3; i++) {
+                if(e->orig().equals(frameVertex[i]) && e->dest().equals(frameVertex[(i + 1) % 3])) {
+                    frameEdges[i] = e;
+                }
+            }
+        }
+    }
+    if(!frameEdges[0] || !frameEdges[1] || !frameEdges[2]) {
+        throw util::IllegalArgumentException("Triangulation does not contain the subdivision frame");
+    }
+
+    quadEdges.swap(newEdges);
+    startingEdges = frameEdges;
+    locator.reset(new LastFoundQuadEdgeLocator(this));
+    visit_state_clean = true;
+}
+
 QuadEdge*
 QuadEdgeSubdivision::locateFromEdge(const Vertex& v,
                                     const QuadEdge& startEdge) const
 {
-    ::geos::ignore_unused_variable_warning(startEdge);
-
     std::size_t iter = 0;
     auto maxIter = quadEdges.size();
 
-    QuadEdge* e = startingEdges[0];
+    // Edges are never freed, so any live edge is a valid start
+    QuadEdge* e = startEdge.isLive() ? const_cast<QuadEdge*>(&startEdge) : startingEdges[0];
 
     for(;;) {
         ++iter;
@@ -400,6 +477,71 @@ public:
     }
 };
 
+/*
+ * Numbers the vertices on first sight and records the triangle index on
+ * the dual edge of each triangle edge.
+ */
+class
+    QuadEdgeSubdivision::TriangleMeshVisitor : public TriangleVisitor {
+private:
+    TriangleMesh& mesh;
+
+public:
+    TriangleMeshVisitor(TriangleMesh& p_mesh) : mesh(p_mesh)
+    {
+    }
+
+    void
+    visit(QuadEdge* triEdges[3]) override
+    {
+        int32_t tri = static_cast<int32_t>(mesh.getNumTriangles());
+        for(std::size_t i = 0; i < 3; i++) {
+            QuadEdge* e = triEdges[i];
+            int32_t v = e->getData();
+            if(v < 0) {
+                v = static_cast<int32_t>(mesh.getNumVertices());
+                const Coordinate& c = e->orig().getCoordinate();
+                mesh.vertices.push_back(c.x);
+                mesh.vertices.push_back(c.y);
+                mesh.vertices.push_back(c.z);
+
+                // tag all the edges leaving the vertex
+                QuadEdge* oe = e;
+                do {
+                    oe->setData(v);
+                    oe = &oe->oNext();
+                }
+                while(oe != e);
+            }
+            mesh.triangles.push_back(v);
+            e->rot().setData(tri);
+        }
+    }
+};
+
+/*
+ * Reads the triangle across each edge from the tags set by
+ * TriangleMeshVisitor. Frame triangles are never tagged.
+ */
+class
+    QuadEdgeSubdivision::TriangleNeighbourVisitor : public TriangleVisitor {
+private:
+    TriangleMesh& mesh;
+
+public:
+    TriangleNeighbourVisitor(TriangleMesh& p_mesh) : mesh(p_mesh)
+    {
+    }
+
+    void
+    visit(QuadEdge* triEdges[3]) override
+    {
+        for(std::size_t i = 0; i < 3; i++) {
+            mesh.neighbours.push_back(triEdges[i]->sym().rot().getData());
+        }
+    }
+};
+
 
 void
 QuadEdgeSubdivision::getTriangleCoordinates(QuadEdgeSubdivision::TriList* triList, bool includeFrame)
@@ -475,6 +617,34 @@ QuadEdgeSubdivision::getTriangles(const GeometryFactory& geomFact)
     return geomFact.createGeometryCollection(std::move(tris));
 }
 
+void
+QuadEdgeSubdivision::getTriangleMesh(TriangleMesh& mesh, bool includeNeighbours)
+{
+    // there are fewer triangles and vertices than edges
+    if(quadEdges.size() > static_cast<std::size_t>(std::numeric_limits<int32_t>::max())) {
+        throw util::IllegalArgumentException("Triangulation is too large for 32-bit indices");
+    }
+
+    mesh.vertices.clear();
+    mesh.triangles.clear();
+    mesh.neighbours.clear();
+
+    for(auto& qe : quadEdges) {
+        qe.setData(-1);
+    }
+
+    TriangleMeshVisitor meshVisitor(mesh);
+    visitTriangles(&meshVisitor, false);
+
+    // the traversal order is deterministic, so a second pass
+    // visits the triangles in the same order
+    if(includeNeighbours) {
+        mesh.neighbours.reserve(mesh.triangles.size());
+        TriangleNeighbourVisitor neighbourVisitor(mesh);
+        visitTriangles(&neighbourVisitor, false);
+    }
+}
+
 
 //Methods for VoronoiDiagram
 std::unique_ptr<geom::GeometryCollection>
@@ -507,6 +677,137 @@ QuadEdgeSubdivision::getVoronoiCellPolygons(const geom::GeometryFactory& geomFac
     return cells;
 }
 
+namespace {
+
+/*
+ * Clips a convex ring of X, Y pairs to the half-plane where the given
+ * ordinate is above (or below) a value, keeping the vertices on the line.
+ */
+void
+clipRing(const std::vector<double>& in, std::vector<double>& out,
+         std::size_t axis, double value, bool keepAbove)
+{
+    out.clear();
+    std::size_t n = in.size() / 2;
+    if(n == 0) {
+        return;
+    }
+    const double sign = keepAbove ? 1.0 : -1.0;
+    std::size_t prev = n - 1;
+    double prevDist = sign * (in[2 * prev + axis] - value);
+    for(std::size_t i = 0; i < n; i++) {
+        double dist = sign * (in[2 * i + axis] - value);
+        if((dist >= 0) != (prevDist >= 0)) {
+            // the edge crosses the line; compute the crossing from the
+            // inside vertex, so that it is the same on both neighbours
+            double t = prevDist / (prevDist - dist);
+            double x = in[2 * prev] + t * (in[2 * i] - in[2 * prev]);
+            double y = in[2 * prev + 1] + t * (in[2 * i + 1] - in[2 * prev + 1]);
+            if(axis == 0) {
+                x = value;
+            }
+            else {
+                y = value;
+            }
+            out.push_back(x);
+            out.push_back(y);
+        }
+        if(dist >= 0) {
+            out.push_back(in[2 * i]);
+            out.push_back(in[2 * i + 1]);
+        }
+        prev = i;
+        prevDist = dist;
+    }
+}
+
+} // anonymous namespace
+
+void
+QuadEdgeSubdivision::getVoronoiCells(VoronoiCells& cells, const geom::Envelope* clipEnv)
+{
+    cells.sites.clear();
+    cells.vertices.clear();
+    cells.offsets.assign(1, 0);
+    cells.siteIndices.clear();
+
+    TriangleCircumcentreVisitor tricircumVisitor;
+    visitTriangles(&tricircumVisitor, true);
+
+    // the edges around each visited site are tagged, instead of
+    // looking the sites up in a set
+    for(auto& qe : quadEdges) {
+        qe.setData(-1);
+    }
+
+    std::vector<double> ring;
+    std::vector<double> clipped;
+    for(auto& quartet : quadEdges) {
+        if(!quartet.base().isLive()) {
+            continue;
+        }
+        for(QuadEdge* start : { &quartet.base(), &quartet.base().sym() }) {
+            if(start->getData() >= 0 || isFrameVertex(start->orig())) {
+                continue;
+            }
+
+            // the circumcentres of the triangles around the site, in CCW order
+            ring.clear();
+            QuadEdge* qe = start;
+            do {
+                qe->setData(0);
+                const Coordinate& cc = qe->rot().orig().getCoordinate();
+                if(ring.empty() || ring[ring.size() - 2] != cc.x || ring.back() != cc.y) {
+                    ring.push_back(cc.x);
+                    ring.push_back(cc.y);
+                }
+                qe = &qe->oNext();
+            }
+            while(qe != start);
+            if(ring.size() > 2 && ring[0] == ring[ring.size() - 2] && ring[1] == ring.back()) {
+                ring.resize(ring.size() - 2);
+            }
+
+            if(clipEnv != nullptr) {
+                clipRing(ring, clipped, 0, clipEnv->getMinX(), true);
+                clipRing(clipped, ring, 0, clipEnv->getMaxX(), false);
+                clipRing(ring, clipped, 1, clipEnv->getMinY(), true);
+                clipRing(clipped, ring, 1, clipEnv->getMaxY(), false);
+            }
+
+            std::size_t begin = cells.vertices.size();
+            for(std::size_t i = 0; i < ring.size(); i += 2) {
+                std::size_t end = cells.vertices.size();
+                if(end > begin && cells.vertices[end - 2] == ring[i] && cells.vertices[end - 1] == ring[i + 1]) {
+                    continue;
+                }
+                cells.vertices.push_back(ring[i]);
+                cells.vertices.push_back(ring[i + 1]);
+            }
+            std::size_t end = cells.vertices.size();
+            if(end - begin > 2 && cells.vertices[begin] == cells.vertices[end - 2]
+                    && cells.vertices[begin + 1] == cells.vertices[end - 1]) {
+                cells.vertices.resize(end - 2);
+            }
+
+            // the cell is outside of the envelope
+            if(cells.vertices.size() - begin < 6) {
+                cells.vertices.resize(begin);
+                continue;
+            }
+
+            const Coordinate& site = start->orig().getCoordinate();
+            cells.sites.push_back(site.x);
+            cells.sites.push_back(site.y);
+            cells.offsets.push_back(cells.vertices.size() / 2);
+        }
+    }
+
+    for(auto& qe : quadEdges) {
+        qe.setData(-1);
+    }
+}
+
 std::vector<std::unique_ptr<geom::Geometry>>
 QuadEdgeSubdivision::getVoronoiCellEdges(const geom::GeometryFactory& geomFact)
 {
@@ -600,6 +901,9 @@ QuadEdgeSubdivision::getVertexUniqueEdges(bool includeFrame)
 
     for(auto& quartet : quadEdges) {
         QuadEdge* qe = &quartet.base();
+        if(!qe->isLive()) {
+            continue;
+        }
         const Vertex& v = qe->orig();
 
         if(visitedVertices.find(v) == visitedVertices.end()) {	//if v not found
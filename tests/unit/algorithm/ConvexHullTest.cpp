@@ -12,6 +12,7 @@
 #include <geos/geom/Dimension.h>
 #include <geos/geom/Geometry.h>
 #include <geos/geom/GeometryFactory.h>
+#include <geos/geom/PointSet.h>
 #include <geos/geom/PrecisionModel.h>
 #include <geos/io/WKBReader.h>
 #include <geos/io/WKTReader.h>
@@ -19,6 +20,8 @@
 #include <sstream>
 #include <memory>
 #include <cassert>
+#include <random>
+#include <vector>
 
 namespace geos {
 namespace geom {
@@ -218,5 +221,95 @@ void object::test<8>
     ensure(result != nullptr); // No crash!
 }
 
-} // namespace tut
 
+// Hull of coordinate arrays, compared with the hull of the geometry
+template<>
+template<>
+void object::test<9>
+()
+{
+    auto factory = GeometryFactory::create();
+    std::mt19937 gen(1234);
+    std::normal_distribution<double> dist(0.0, 100.0);
+
+    for(std::size_t n : { 3u, 10u, 1000u, 200000u }) {
+        // interleaved XY
+        std::vector<double> xy(2 * n);
+        std::vector<Coordinate> coords;
+        for(std::size_t i = 0; i < n; i++) {
+            xy[2 * i] = dist(gen);
+            xy[2 * i + 1] = dist(gen);
+            coords.emplace_back(xy[2 * i], xy[2 * i + 1]);
+        }
+        std::unique_ptr<Geometry> pts(factory->createMultiPoint(coords));
+        auto expected = pts->convexHull();
+
+        for(std::size_t numThreads : { 1u, 4u }) {
+            auto result = geos::algorithm::ConvexHull::getConvexHull(
+                              &xy[0], &xy[1], n, 2, *factory, numThreads);
+            ensure(result->equalsExact(expected.get()));
+        }
+    }
+}
+
+// Hull indices of separate ordinate arrays
+template<>
+template<>
+void object::test<10>
+()
+{
+    using geos::algorithm::ConvexHull;
+    // a square with an inner point, a repeated corner and a point on a side
+    std::vector<double> x = { 0, 10, 5, 10, 0, 10, 5 };
+    std::vector<double> y = { 0, 0, 5, 10, 10, 0, 0 };
+    std::vector<std::size_t> hull;
+    ConvexHull::computeHull(x.data(), y.data(), x.size(), 1, hull);
+
+    ensure_equals(hull.size(), 4u);
+    ensure_equals(hull[0], 0u);
+    ensure(hull[1] == 1u || hull[1] == 5u);
+    ensure_equals(hull[2], 3u);
+    ensure_equals(hull[3], 4u);
+}
+
+// Degenerate coordinate arrays give the same hull as geometries
+template<>
+template<>
+void object::test<11>
+()
+{
+    using geos::algorithm::ConvexHull;
+    auto factory = GeometryFactory::create();
+
+    std::vector<double> x = { 0, 5, 2, 10, 7 };
+    std::vector<double> y = { 0, 0, 0, 0, 0 };
+    auto result = ConvexHull::getConvexHull(x.data(), y.data(), x.size(), 1, *factory);
+    geom_ = reader_.read("LINESTRING (0 0, 10 0)");
+    ensure(result->equalsExact(geom_.get()));
+
+    x.assign(3, 1);
+    y.assign(3, 2);
+    result = ConvexHull::getConvexHull(x.data(), y.data(), x.size(), 1, *factory);
+    geom_ = reader_.read("POINT (1 2)");
+    ensure(result->equalsExact(geom_.get()));
+
+    result = ConvexHull::getConvexHull(x.data(), y.data(), 0, 1, *factory);
+    ensure(result->isEmpty());
+}
+
+// Hull of a PointSet keeps the Z ordinates
+template<>
+template<>
+void object::test<12>
+()
+{
+    auto factory = GeometryFactory::create();
+    std::vector<double> xyz = { 0, 0, 1, 10, 0, 2, 5, 5, 3, 10, 10, 4, 0, 10, 5 };
+    auto result = geos::algorithm::ConvexHull::getConvexHull(
+                      PointSet::fromXYZ(xyz.data(), 5), *factory);
+    ensure_equals(result->getCoordinateDimension(), 3u);
+    ensure_equals(result->getArea(), 100.0);
+    ensure_equals(result->getCoordinate()->z, 1.0);
+}
+
+} // namespace tut
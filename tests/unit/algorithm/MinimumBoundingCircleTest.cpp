@@ -21,6 +21,7 @@
 #include <geos/geom/Coordinate.h>
 #include <geos/geom/Geometry.h>
 #include <geos/geom/GeometryFactory.h>
+#include <geos/geom/PointSet.h>
 #include <geos/geom/PrecisionModel.h>
 #include <geos/io/WKTReader.h>
 
@@ -28,6 +29,7 @@
 #include <sstream>
 #include <string>
 #include <memory>
+#include <vector>
 
 namespace tut {
 //
@@ -239,5 +241,26 @@ void object::test<10>
         3.60555);
 }
 
-} // namespace tut
+// Points given as ordinate arrays
+template<>
+template<>
+void object::test<11>
+()
+{
+    std::vector<double> xy = { 0, 0, 6, 0, 5, 5, 3, 1, 6, 0 };
+    MinimumBoundingCircle mbc(geos::geom::PointSet::fromXY(xy.data(), 5), *geomFact);
+    ensure(mbc.getCentre().equals2D(Coordinate(3, 2)));
+    ensure_distance(mbc.getRadius(), 3.60555, 0.0001);
+    ensure_equals(mbc.getExtremalPoints().size(), 3u);
 
+    MinimumBoundingCircle empty(geos::geom::PointSet(), *geomFact);
+    ensure(empty.getCircle()->isEmpty());
+
+    std::vector<double> x = { 1, 1 };
+    std::vector<double> y = { 2, 2 };
+    MinimumBoundingCircle single(geos::geom::PointSet(x.data(), y.data(), 2), *geomFact);
+    ensure_equals(single.getCircle()->getGeometryTypeId(), geos::geom::GEOS_POINT);
+    ensure_equals(single.getRadius(), 0.0);
+}
+
+} // namespace tut
@@ -22,10 +22,13 @@
 #include <geos/io/WKTReader.h>
 #include <geos/io/WKTWriter.h>
 #include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/PointSet.h>
 // std
 #include <sstream>
 #include <string>
 #include <memory>
+#include <vector>
 
 namespace tut {
 //
@@ -243,4 +246,22 @@ void object::test<10>
     ensure(minDiameter.get()->equalsExact(expectedGeom.get(), 0.00000000001));
 }
 
+// Points given as ordinate arrays
+template<>
+template<>
+void object::test<11>
+()
+{
+    GeomPtr p_geom(
+        reader.read("MULTIPOINT ((0 0), (10 0), (10 4), (0 4), (5 2), (3 1))"));
+    std::vector<double> xy = { 0, 0, 10, 0, 10, 4, 0, 4, 5, 2, 3, 1 };
+    auto factory = geos::geom::GeometryFactory::create();
+
+    MinimumDiameter expected(p_geom.get());
+    MinimumDiameter actual(geos::geom::PointSet::fromXY(xy.data(), 6), *factory);
+    ensure_equals(actual.getLength(), expected.getLength());
+    ensure(actual.getDiameter()->equalsExact(expected.getDiameter().get()));
+    ensure(actual.getMinimumRectangle()->equalsExact(expected.getMinimumRectangle().get()));
+}
+
 } // namespace tut
@@ -11,11 +11,17 @@
 #include <geos/geom/GeometryFactory.h>
 #include <geos/geom/Geometry.h> // required for use in unique_ptr
 #include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateArraySequence.h>
+#include <geos/geom/LineString.h>
+#include <geos/util/IllegalArgumentException.h>
 // std
+#include <algorithm>
 #include <cmath>
 #include <sstream>
 #include <string>
 #include <memory>
+#include <random>
+#include <vector>
 
 namespace geos {
 namespace geom {
@@ -72,6 +78,32 @@ struct test_DiscreteFrechetDistance_data {
         ensure(diff <= TOLERANCE);
     }
 
+    // the discrete Frechet distance of two lines, from the full matrix
+    // of coupling distances
+    static double
+    fullMatrixDistance(const CoordinateSequence& p, const CoordinateSequence& q)
+    {
+        std::vector<std::vector<double>> ca(p.size(), std::vector<double>(q.size()));
+        for(std::size_t i = 0; i < p.size(); i++) {
+            for(std::size_t j = 0; j < q.size(); j++) {
+                double d = p.getAt(i).distance(q.getAt(j));
+                if(i == 0 && j == 0) {
+                    ca[i][j] = d;
+                }
+                else if(i == 0) {
+                    ca[i][j] = std::max(ca[i][j - 1], d);
+                }
+                else if(j == 0) {
+                    ca[i][j] = std::max(ca[i - 1][j], d);
+                }
+                else {
+                    ca[i][j] = std::max(std::min({ ca[i - 1][j], ca[i - 1][j - 1], ca[i][j - 1] }), d);
+                }
+            }
+        }
+        return ca.back().back();
+    }
+
     PrecisionModel pm;
     GeometryFactory::Ptr gf;
     geos::io::WKTReader reader;
@@ -132,4 +164,61 @@ void object::test<4>
     runTest("LINESTRING (0 0, 100 0)", "LINESTRING (0 0, 50 50, 100 0)", 0.5, 50.0);
 }
 
+// Random lines against the full matrix of coupling distances,
+// including the starting pair, and the threshold mode
+template<>
+template<>
+void object::test<5>
+()
+{
+    std::mt19937 gen(7);
+    std::uniform_real_distribution<double> dist(0, 100);
+    for(int k = 0; k < 50; k++) {
+        CoordinateArraySequence p, q;
+        for(int i = 0; i < 5 + k % 17; i++) {
+            p.add(Coordinate(dist(gen), dist(gen)));
+        }
+        for(int i = 0; i < 3 + k % 23; i++) {
+            q.add(Coordinate(dist(gen), dist(gen)));
+        }
+        GeomPtr g1(gf->createLineString(p));
+        GeomPtr g2(gf->createLineString(q));
+
+        double expected = fullMatrixDistance(p, q);
+        DiscreteFrechetDistance dfd(*g1, *g2);
+        ensure_equals(dfd.distance(), expected);
+        const auto& pts = dfd.getCoordinates();
+        ensure_equals(pts[0].distance(pts[1]), expected);
+
+        ensure(DiscreteFrechetDistance::isWithinDistance(*g1, *g2, expected));
+        ensure(!DiscreteFrechetDistance::isWithinDistance(*g1, *g2, expected * 0.999));
+        ensure(DiscreteFrechetDistance::isWithinDistance(*g1, *g2, expected * 1.5));
+    }
+
+    // the starting pair determines the distance
+    runTest("LINESTRING (0 10, 1 0, 2 0)", "LINESTRING (0 0, 1 1, 2 0)", 10.0);
+}
+
+// Densified threshold mode, and empty inputs
+template<>
+template<>
+void object::test<6>
+()
+{
+    GeomPtr g1(reader.read("LINESTRING (0 0, 100 0)"));
+    GeomPtr g2(reader.read("LINESTRING (0 0, 50 50, 100 0)"));
+
+    DiscreteFrechetDistance dfd(*g1, *g2);
+    dfd.setDensifyFraction(0.5);
+    ensure(dfd.isWithinDistance(50.0));
+    ensure(!dfd.isWithinDistance(49.0));
+
+    GeomPtr empty(reader.read("LINESTRING EMPTY"));
+    try {
+        DiscreteFrechetDistance::distance(*g1, *empty);
+        fail("IllegalArgumentException expected");
+    }
+    catch(const geos::util::IllegalArgumentException&) {}
+}
+
 } // namespace tut
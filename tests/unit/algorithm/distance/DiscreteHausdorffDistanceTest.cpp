@@ -12,11 +12,14 @@
 #include <geos/geom/GeometryFactory.h>
 #include <geos/geom/Geometry.h> // required for use in unique_ptr
 #include <geos/geom/Coordinate.h>
+#include <geos/geom/Point.h>
 // std
 #include <cmath>
 #include <sstream>
 #include <string>
 #include <memory>
+#include <random>
+#include <vector>
 
 namespace geos {
 namespace geom {
@@ -73,6 +76,24 @@ struct test_DiscreteHausdorffDistance_data {
         ensure(diff <= TOLERANCE);
     }
 
+    // the distance of the vertices, or densified points, of discreteGeom
+    // to geom by brute force
+    static double
+    orientedDistance(const Geometry& discreteGeom, const Geometry& geom,
+                     double densifyFactor)
+    {
+        DiscreteHausdorffDistance::MaxPointDistanceFilter filter(geom);
+        discreteGeom.apply_ro(&filter);
+        PointPairDistance ptDist;
+        ptDist.setMaximum(filter.getMaxPointDistance());
+        if(densifyFactor > 0) {
+            DiscreteHausdorffDistance::MaxDensifiedByFractionDistanceFilter fracFilter(geom, densifyFactor);
+            discreteGeom.apply_ro(fracFilter);
+            ptDist.setMaximum(fracFilter.getMaxPointDistance());
+        }
+        return ptDist.getDistance();
+    }
+
     PrecisionModel pm;
     GeometryFactory::Ptr gf;
     geos::io::WKTReader reader;
@@ -133,5 +154,42 @@ void object::test<4>
     runTest("LINESTRING (130 0, 0 0, 0 150)", "LINESTRING (10 10, 10 150, 130 10)", 0.5, 70.0);
 }
 
+// Large geometries, whose facets are indexed, agree with brute force
+template<>
+template<>
+void object::test<5>
+()
+{
+    std::mt19937 gen(3);
+    std::uniform_real_distribution<double> dist(0, 100);
+    std::vector<GeomPtr> geoms;
+    for(int i = 0; i < 3; i++) {
+        GeomPtr pt(gf->createPoint(Coordinate(dist(gen), dist(gen))));
+        geoms.push_back(pt->buffer(10 + dist(gen) / 4, 40));
+    }
+    geoms.push_back(geoms[0]->getBoundary());
+    geoms.push_back(reader.read("MULTIPOINT ((0 0), (10 80), (50 50), (90 20), (100 100))"));
+
+    for(const auto& g0 : geoms) {
+        for(const auto& g1 : geoms) {
+            for(double densifyFactor : { 0.0, 0.3 }) {
+                double expected = std::max(orientedDistance(*g0, *g1, densifyFactor),
+                                           orientedDistance(*g1, *g0, densifyFactor));
+                for(std::size_t numThreads : { 1, 3 }) {
+                    DiscreteHausdorffDistance hd(*g0, *g1);
+                    if(densifyFactor > 0) {
+                        hd.setDensifyFraction(densifyFactor);
+                    }
+                    hd.setNumThreads(numThreads);
+                    // the closest points on segments are rounded differently
+                    ensure(std::fabs(hd.distance() - expected) <= 1e-12);
+                    const auto& pts = hd.getCoordinates();
+                    ensure(std::fabs(pts[0].distance(pts[1]) - expected) <= 1e-12);
+                }
+            }
+        }
+    }
+}
+
 } // namespace tut
 
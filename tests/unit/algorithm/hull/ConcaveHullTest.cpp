@@ -0,0 +1,186 @@
+//
+// Test Suite for geos::algorithm::hull::ConcaveHull
+
+#include <tut/tut.hpp>
+// geos
+#include <geos/algorithm/hull/ConcaveHull.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/MultiPoint.h>
+#include <geos/io/WKTReader.h>
+#include <geos/util/IllegalArgumentException.h>
+// std
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace geos::geom;
+using geos::algorithm::hull::ConcaveHull;
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_concavehull_data {
+    GeometryFactory::Ptr factory_;
+    geos::io::WKTReader reader_;
+
+    test_concavehull_data()
+        : factory_(GeometryFactory::create())
+        , reader_(factory_.get())
+    {}
+
+    // the points of a U shape, 10 wide and 10 high, with arms 2 wide,
+    // on a grid of spacing 1
+    std::unique_ptr<Geometry>
+    uShape()
+    {
+        std::vector<Coordinate> pts;
+        for(int x = 0; x <= 10; x++) {
+            for(int y = 0; y <= 10; y++) {
+                if(y <= 2 || x <= 2 || x >= 8) {
+                    pts.emplace_back(x, y);
+                }
+            }
+        }
+        return std::unique_ptr<Geometry>(factory_->createMultiPoint(pts));
+    }
+
+    void
+    checkHull(const Geometry& pts, const Geometry& hull)
+    {
+        ensure_equals(hull.getGeometryTypeId(), GEOS_POLYGON);
+        ensure(hull.isValid());
+        ensure(hull.covers(&pts));
+    }
+};
+
+typedef test_group<test_concavehull_data> group;
+typedef group::object object;
+
+group test_concavehull_group("geos::algorithm::hull::ConcaveHull");
+
+//
+// Test Cases
+//
+
+// Without a criterion, the hull is the convex hull
+template<>
+template<>
+void object::test<1>
+()
+{
+    auto pts = uShape();
+    ConcaveHull hull(pts.get());
+    auto result = hull.getHull();
+    checkHull(*pts, *result);
+    ensure_equals(result->getArea(), 100.0);
+}
+
+// A maximum edge length follows the U
+template<>
+template<>
+void object::test<2>
+()
+{
+    auto pts = uShape();
+    auto result = ConcaveHull::concaveHullByLength(pts.get(), 1.2);
+    checkHull(*pts, *result);
+    // 3 rectangles of 10 x 2, overlapping in 2 x 2 squares
+    ensure_equals(result->getArea(), 52.0);
+
+    // the diagonals of the inner corners are kept
+    result = ConcaveHull::concaveHullByLength(pts.get(), 1.5);
+    checkHull(*pts, *result);
+    ensure_equals(result->getArea(), 53.0);
+}
+
+// Length ratios
+template<>
+template<>
+void object::test<3>
+()
+{
+    auto pts = uShape();
+    auto convex = ConcaveHull::concaveHullByLengthRatio(pts.get(), 1.0);
+    checkHull(*pts, *convex);
+    ensure_equals(convex->getArea(), 100.0);
+
+    auto concave = ConcaveHull::concaveHullByLengthRatio(pts.get(), 0.0);
+    checkHull(*pts, *concave);
+    ensure(concave->getArea() < 100.0);
+}
+
+// Alpha shape
+template<>
+template<>
+void object::test<4>
+()
+{
+    auto pts = uShape();
+    // the circumradius of the grid triangles is 0.707
+    auto result = ConcaveHull::alphaShape(pts.get(), 1.0);
+    checkHull(*pts, *result);
+    ensure_equals(result->getArea(), 53.0);
+
+    auto convex = ConcaveHull::alphaShape(pts.get(), 100.0);
+    ensure_equals(convex->getArea(), 100.0);
+}
+
+// The hull of scattered points stays a single polygon covering them
+template<>
+template<>
+void object::test<5>
+()
+{
+    std::mt19937 gen(7);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    std::vector<Coordinate> coords;
+    while(coords.size() < 3000) {
+        double x = dist(gen);
+        double y = dist(gen);
+        // a ring with a gap on the right
+        double r2 = x * x + y * y;
+        if(r2 > 0.25 && r2 < 1 && !(x > 0.5 && std::abs(y) < 0.2)) {
+            coords.emplace_back(x, y);
+        }
+    }
+    std::unique_ptr<Geometry> pts(factory_->createMultiPoint(coords));
+
+    auto convex = pts->convexHull();
+    for(double ratio : { 0.0, 0.05, 0.2, 0.5 }) {
+        auto result = ConcaveHull::concaveHullByLengthRatio(pts.get(), ratio);
+        checkHull(*pts, *result);
+        ensure(result->getArea() < convex->getArea());
+    }
+}
+
+// Degenerate input
+template<>
+template<>
+void object::test<6>
+()
+{
+    auto empty = reader_.read("MULTIPOINT EMPTY");
+    auto result = ConcaveHull::concaveHullByLength(empty.get(), 1.0);
+    ensure(result->isEmpty());
+
+    auto line = reader_.read("MULTIPOINT ((0 0), (1 1), (2 2))");
+    result = ConcaveHull::concaveHullByLength(line.get(), 1.0);
+    ensure_equals(result->getGeometryTypeId(), GEOS_LINESTRING);
+
+    auto pt = reader_.read("POINT (1 1)");
+    result = ConcaveHull::alphaShape(pt.get(), 1.0);
+    ensure_equals(result->getGeometryTypeId(), GEOS_POINT);
+
+    try {
+        ConcaveHull::concaveHullByLengthRatio(line.get(), 2.0);
+        fail("IllegalArgumentException expected");
+    }
+    catch(const geos::util::IllegalArgumentException&) {}
+}
+
+} // namespace tut
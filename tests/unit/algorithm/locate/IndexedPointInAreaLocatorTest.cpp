@@ -0,0 +1,131 @@
+//
+// Test Suite for geos::algorithm::locate::IndexedPointInAreaLocator
+
+#include <tut/tut.hpp>
+// geos
+#include <geos/algorithm/locate/IndexedPointInAreaLocator.h>
+#include <geos/io/WKTReader.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/Location.h>
+// std
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+using geos::algorithm::locate::IndexedPointInAreaLocator;
+using geos::geom::Coordinate;
+using geos::geom::Geometry;
+using geos::geom::Location;
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_indexedpointinarealocator_data {
+    geos::io::WKTReader reader;
+
+    std::unique_ptr<Geometry>
+    read(const std::string& wkt)
+    {
+        return reader.read(wkt);
+    }
+
+    // Checks that the batch locate agrees with locating one point at a time
+    void
+    checkBatch(const Geometry& g, const std::vector<double>& xs, const std::vector<double>& ys)
+    {
+        IndexedPointInAreaLocator batchLoc(g);
+        std::vector<Location> out(xs.size(), Location::NONE);
+        batchLoc.locate(xs.data(), ys.data(), xs.size(), out.data());
+
+        IndexedPointInAreaLocator loc(g);
+        for(std::size_t i = 0; i < xs.size(); i++) {
+            Coordinate p(xs[i], ys[i]);
+            ensure_equals(out[i], loc.locate(&p));
+        }
+    }
+};
+
+typedef test_group<test_indexedpointinarealocator_data> group;
+typedef group::object object;
+
+group test_indexedpointinarealocator_group("geos::algorithm::locate::IndexedPointInAreaLocator");
+
+//
+// Test Cases
+//
+
+// Batch locate of interior, boundary, hole and exterior points
+template<>
+template<>
+void object::test<1>
+()
+{
+    auto g = read("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0), (2 2, 2 4, 4 4, 4 2, 2 2))");
+
+    std::vector<double> xs { 5, 3, 0, 10, 5, 2, 11, -1, 3, 10 };
+    std::vector<double> ys { 5, 3, 5, 10, 0, 3, 5, 5, 4, 12 };
+    std::vector<Location> expected {
+        Location::INTERIOR, Location::EXTERIOR, Location::BOUNDARY,
+        Location::BOUNDARY, Location::BOUNDARY, Location::BOUNDARY,
+        Location::EXTERIOR, Location::EXTERIOR, Location::BOUNDARY,
+        Location::EXTERIOR
+    };
+
+    IndexedPointInAreaLocator loc(*g);
+    std::vector<Location> out(xs.size(), Location::NONE);
+    loc.locate(xs.data(), ys.data(), xs.size(), out.data());
+
+    for(std::size_t i = 0; i < xs.size(); i++) {
+        ensure_equals(out[i], expected[i]);
+    }
+}
+
+// A grid of points over a MultiPolygon with shared vertex Y values
+template<>
+template<>
+void object::test<2>
+()
+{
+    auto g = read("MULTIPOLYGON (((0 0, 4 2, 8 0, 8 8, 4 6, 0 8, 0 0)), "
+                  "((10 0, 14 4, 10 8, 10 0)), ((2 10, 6 10, 4 12, 2 10)))");
+
+    std::vector<double> xs, ys;
+    for(int i = 0; i <= 64; i++) {
+        for(int j = 0; j <= 56; j++) {
+            xs.push_back(-1 + i * 0.25);
+            ys.push_back(-1 + j * 0.25);
+        }
+    }
+    checkBatch(*g, xs, ys);
+}
+
+// Empty geometry, empty batch and NaN ordinates
+template<>
+template<>
+void object::test<3>
+()
+{
+    auto empty = read("POLYGON EMPTY");
+    std::vector<double> xs { 0, 1 };
+    std::vector<double> ys { 0, 1 };
+    std::vector<Location> out(2, Location::NONE);
+
+    IndexedPointInAreaLocator emptyLoc(*empty);
+    emptyLoc.locate(xs.data(), ys.data(), xs.size(), out.data());
+    ensure_equals(out[0], Location::EXTERIOR);
+    ensure_equals(out[1], Location::EXTERIOR);
+
+    auto g = read("LINEARRING (0 0, 10 0, 10 10, 0 10, 0 0)");
+    IndexedPointInAreaLocator loc(*g);
+    loc.locate(xs.data(), ys.data(), 0, out.data());
+
+    double nan = std::numeric_limits<double>::quiet_NaN();
+    checkBatch(*g, { 5, 3, 5 }, { nan, 3, 10 });
+}
+
+} // namespace tut
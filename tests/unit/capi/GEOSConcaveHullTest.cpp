@@ -0,0 +1,89 @@
+//
+// Test Suite for C-API GEOSConcaveHull, GEOSConcaveHullByLength and GEOSAlphaShape
+
+#include <tut/tut.hpp>
+// geos
+#include <geos_c.h>
+
+#include "capi_test_utils.h"
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_geosconcavehull_data : public capitest::utility {
+    // the points along a U, 4 wide and 4 high, with arms 1 wide
+    const char* uShape_ = "MULTIPOINT ((0 0), (1 0), (2 0), (3 0), (4 0), (4 1), (4 2), (4 3), (4 4), "
+                          "(3 4), (3 3), (3 2), (3 1), (2 1), (1 1), (1 2), (1 3), (1 4), "
+                          "(0 4), (0 3), (0 2), (0 1))";
+
+    void
+    checkHull(const GEOSGeometry* input, const GEOSGeometry* hull, double minArea, double maxArea)
+    {
+        ensure(hull != nullptr);
+        ensure_equals(GEOSGeomTypeId(hull), GEOS_POLYGON);
+        ensure_equals(GEOSisValid(hull), 1);
+        ensure_equals(GEOSCovers(hull, input), 1);
+        ensure_equals(GEOSGetSRID(hull), GEOSGetSRID(input));
+
+        double area;
+        GEOSArea(hull, &area);
+        ensure(area >= minArea);
+        ensure(area <= maxArea);
+    }
+};
+
+typedef test_group<test_geosconcavehull_data> group;
+typedef group::object object;
+
+group test_geosconcavehull("capi::GEOSConcaveHull");
+
+template<>
+template<>
+void object::test<1>()
+{
+    GEOSGeometry* input = GEOSGeomFromWKT(uShape_);
+    GEOSSetSRID(input, 4326);
+
+    GEOSGeometry* convex = GEOSConcaveHull(input, 1.0);
+    checkHull(input, convex, 16, 16);
+
+    GEOSGeometry* concave = GEOSConcaveHull(input, 0.0);
+    checkHull(input, concave, 10, 15);
+
+    GEOSGeom_destroy(input);
+    GEOSGeom_destroy(convex);
+    GEOSGeom_destroy(concave);
+}
+
+template<>
+template<>
+void object::test<2>()
+{
+    GEOSGeometry* input = GEOSGeomFromWKT(uShape_);
+
+    GEOSGeometry* byLength = GEOSConcaveHullByLength(input, 1.5);
+    checkHull(input, byLength, 10, 15);
+
+    GEOSGeometry* alpha = GEOSAlphaShape(input, 0.8);
+    checkHull(input, alpha, 10, 15);
+
+    GEOSGeom_destroy(input);
+    GEOSGeom_destroy(byLength);
+    GEOSGeom_destroy(alpha);
+}
+
+template<>
+template<>
+void object::test<3>()
+{
+    GEOSGeometry* input = GEOSGeomFromWKT(uShape_);
+
+    ensure(GEOSConcaveHull(input, 1.5) == nullptr);
+    ensure(GEOSConcaveHullByLength(input, -1) == nullptr);
+
+    GEOSGeom_destroy(input);
+}
+
+} // namespace tut
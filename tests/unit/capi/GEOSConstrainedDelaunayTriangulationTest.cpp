@@ -0,0 +1,136 @@
+//
+// Test Suite for C-API GEOSConstrainedDelaunayTriangulation
+
+#include <tut/tut.hpp>
+// geos
+#include <geos_c.h>
+// std
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used in test cases.
+struct test_capigeosconstraineddelaunaytriangulation_data {
+    GEOSGeometry* geom1_;
+    GEOSGeometry* geom2_;
+    GEOSWKTWriter* w_;
+
+    static void
+    notice(const char* fmt, ...)
+    {
+        std::fprintf(stdout, "NOTICE: ");
+
+        va_list ap;
+        va_start(ap, fmt);
+        std::vfprintf(stdout, fmt, ap);
+        va_end(ap);
+
+        std::fprintf(stdout, "\n");
+    }
+
+    test_capigeosconstraineddelaunaytriangulation_data()
+        : geom1_(nullptr), geom2_(nullptr)
+    {
+        initGEOS(notice, notice);
+        w_ = GEOSWKTWriter_create();
+        GEOSWKTWriter_setTrim(w_, 1);
+    }
+
+    void
+    ensure_equals_wkt(GEOSGeometry* g, const std::string& exp)
+    {
+        GEOSNormalize(g);
+        char* wkt_c = GEOSWKTWriter_write(w_, g);
+        std::string out(wkt_c);
+        free(wkt_c);
+        ensure_equals(out, exp);
+    }
+
+    ~test_capigeosconstraineddelaunaytriangulation_data()
+    {
+        GEOSGeom_destroy(geom1_);
+        GEOSGeom_destroy(geom2_);
+        GEOSWKTWriter_destroy(w_);
+        geom1_ = nullptr;
+        geom2_ = nullptr;
+        finishGEOS();
+    }
+
+};
+
+typedef test_group<test_capigeosconstraineddelaunaytriangulation_data> group;
+typedef group::object object;
+
+group test_capigeosconstraineddelaunaytriangulation_group("capi::GEOSConstrainedDelaunayTriangulation");
+
+//
+// Test Cases
+//
+
+// Empty polygon
+template<>
+template<>
+void object::test<1>
+()
+{
+    geom1_ = GEOSGeomFromWKT("POLYGON EMPTY");
+
+    geom2_ = GEOSConstrainedDelaunayTriangulation(geom1_);
+    ensure_equals(GEOSisEmpty(geom2_), 1);
+    ensure_equals(GEOSGeomTypeId(geom2_), GEOS_GEOMETRYCOLLECTION);
+}
+
+// Non-polygonal input
+template<>
+template<>
+void object::test<2>
+()
+{
+    geom1_ = GEOSGeomFromWKT("MULTIPOINT ((0 0), (5 0), (10 10))");
+
+    geom2_ = GEOSConstrainedDelaunayTriangulation(geom1_);
+    ensure_equals(GEOSisEmpty(geom2_), 1);
+    ensure_equals(GEOSGeomTypeId(geom2_), GEOS_GEOMETRYCOLLECTION);
+}
+
+// Concave polygon, whose unconstrained triangulation has the edge (0 0, 10 0)
+template<>
+template<>
+void object::test<3>
+()
+{
+    geom1_ = GEOSGeomFromWKT("POLYGON ((0 0, 5 1, 10 0, 10 10, 0 10, 0 0))");
+    GEOSSetSRID(geom1_, 4326);
+
+    geom2_ = GEOSConstrainedDelaunayTriangulation(geom1_);
+    ensure_equals(GEOSGetSRID(geom2_), 4326);
+    ensure_equals_wkt(geom2_,
+                      "GEOMETRYCOLLECTION (POLYGON ((5 1, 10 10, 10 0, 5 1)), "
+                      "POLYGON ((0 10, 10 10, 5 1, 0 10)), "
+                      "POLYGON ((0 0, 0 10, 5 1, 0 0)))");
+}
+
+// Polygon with a hole
+template<>
+template<>
+void object::test<4>
+()
+{
+    geom1_ = GEOSGeomFromWKT("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0), (2 2, 2 8, 8 8, 8 2, 2 2))");
+
+    geom2_ = GEOSConstrainedDelaunayTriangulation(geom1_);
+    ensure_equals(GEOSGetNumGeometries(geom2_), 8);
+
+    double area1, area2;
+    GEOSArea(geom1_, &area1);
+    GEOSArea(geom2_, &area2);
+    ensure_equals(area2, area1);
+}
+
+} // namespace tut
@@ -190,5 +190,70 @@ void object::test<6>
                      );
 }
 
-} // namespace tut
+// Indexed mesh output
+template<>
+template<>
+void object::test<7>
+()
+{
+    geom1_ = GEOSGeomFromWKT("MULTIPOINT(0 0, 10 0, 10 10, 0 11)");
+
+    double* vertices = nullptr;
+    int* triangles = nullptr;
+    int* neighbours = nullptr;
+    unsigned int numVertices = 0;
+    unsigned int numTriangles = 0;
+
+    int ret = GEOSDelaunayTriangulationMesh(geom1_, 0, &vertices, &numVertices,
+                                            &triangles, &neighbours, &numTriangles);
+    ensure_equals(ret, 1);
+    ensure_equals(numVertices, 4u);
+    ensure_equals(numTriangles, 2u);
+
+    // every vertex is used, and the two triangles share one edge
+    double area = 0;
+    int shared = 0;
+    for(unsigned int t = 0; t < numTriangles; t++) {
+        const double* a = vertices + 3 * triangles[3 * t];
+        const double* b = vertices + 3 * triangles[3 * t + 1];
+        const double* c = vertices + 3 * triangles[3 * t + 2];
+        area += ((b[0] - a[0]) * (c[1] - a[1]) - (c[0] - a[0]) * (b[1] - a[1])) / 2;
+        for(int i = 0; i < 3; i++) {
+            int n = neighbours[3 * t + i];
+            if(n >= 0) {
+                ensure_equals(n, static_cast<int>(1 - t));
+                shared++;
+            }
+        }
+    }
+    ensure_equals(area, 105.0);
+    ensure_equals(shared, 2);
+
+    GEOSFree(vertices);
+    GEOSFree(triangles);
+    GEOSFree(neighbours);
+}
 
+// Empty mesh, without neighbours
+template<>
+template<>
+void object::test<8>
+()
+{
+    geom1_ = GEOSGeomFromWKT("MULTIPOINT(0 0, 10 0)");
+
+    double* vertices = nullptr;
+    int* triangles = nullptr;
+    unsigned int numVertices = 1;
+    unsigned int numTriangles = 1;
+
+    int ret = GEOSDelaunayTriangulationMesh(geom1_, 0, &vertices, &numVertices,
+                                            &triangles, nullptr, &numTriangles);
+    ensure_equals(ret, 1);
+    ensure_equals(numVertices, 0u);
+    ensure_equals(numTriangles, 0u);
+    ensure(vertices == nullptr);
+    ensure(triangles == nullptr);
+}
+
+} // namespace tut
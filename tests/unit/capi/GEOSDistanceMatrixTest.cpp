@@ -0,0 +1,123 @@
+//
+// Test Suite for C-API GEOSDistanceMatrix and GEOSDistanceMatrixSparse
+
+#include <tut/tut.hpp>
+// geos
+#include <geos_c.h>
+// std
+#include <cmath>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <vector>
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used in test cases.
+struct test_capigeosdistancematrix_data {
+    std::vector<GEOSGeometry*> geoms1_;
+    std::vector<GEOSGeometry*> geoms2_;
+
+    static void
+    notice(const char* fmt, ...)
+    {
+        std::fprintf(stdout, "NOTICE: ");
+
+        va_list ap;
+        va_start(ap, fmt);
+        std::vfprintf(stdout, fmt, ap);
+        va_end(ap);
+
+        std::fprintf(stdout, "\n");
+    }
+
+    test_capigeosdistancematrix_data()
+    {
+        initGEOS(notice, notice);
+        for(const char* wkt : { "POINT (0 0)", "LINESTRING (1 1, 2 2)", "POLYGON EMPTY" }) {
+            geoms1_.push_back(GEOSGeomFromWKT(wkt));
+        }
+        for(const char* wkt : { "POINT (3 0)", "POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))" }) {
+            geoms2_.push_back(GEOSGeomFromWKT(wkt));
+        }
+    }
+
+    ~test_capigeosdistancematrix_data()
+    {
+        for(GEOSGeometry* g : geoms1_) {
+            GEOSGeom_destroy(g);
+        }
+        for(GEOSGeometry* g : geoms2_) {
+            GEOSGeom_destroy(g);
+        }
+        finishGEOS();
+    }
+};
+
+typedef test_group<test_capigeosdistancematrix_data> group;
+typedef group::object object;
+
+group test_capigeosdistancematrix_group("capi::GEOSDistanceMatrix");
+
+//
+// Test Cases
+//
+
+// Dense matrix of all the pairs
+template<>
+template<>
+void object::test<1>
+()
+{
+    std::vector<double> distances(6);
+    int ret = GEOSDistanceMatrix(geoms1_.data(), 3, geoms2_.data(), 2,
+                                 std::numeric_limits<double>::infinity(), 2,
+                                 distances.data());
+    ensure_equals(ret, 1);
+    ensure_equals(distances[0], 3.0);
+    ensure_equals(distances[1], 0.0);
+    ensure(std::fabs(distances[2] - std::sqrt(4.5)) < 1e-12);
+    ensure_equals(distances[3], 0.0);
+    ensure(std::isinf(distances[4]));
+    ensure(std::isinf(distances[5]));
+}
+
+// Sparse matrix of the pairs within a distance
+template<>
+template<>
+void object::test<2>
+()
+{
+    unsigned int* indices1;
+    unsigned int* indices2;
+    double* distances;
+    unsigned int numPairs;
+    int ret = GEOSDistanceMatrixSparse(geoms1_.data(), 3, geoms2_.data(), 2, 2.5, 1,
+                                       &indices1, &indices2, &distances, &numPairs);
+    ensure_equals(ret, 1);
+    ensure_equals(numPairs, 3u);
+    ensure_equals(indices1[0], 0u);
+    ensure_equals(indices2[0], 1u);
+    ensure_equals(distances[0], 0.0);
+    ensure_equals(indices1[1], 1u);
+    ensure_equals(indices2[1], 0u);
+    ensure_equals(indices1[2], 1u);
+    ensure_equals(indices2[2], 1u);
+    GEOSFree(indices1);
+    GEOSFree(indices2);
+    GEOSFree(distances);
+
+    ret = GEOSDistanceMatrixSparse(geoms1_.data() + 2, 1, geoms2_.data(), 2, 100, 1,
+                                   &indices1, &indices2, &distances, &numPairs);
+    ensure_equals(ret, 1);
+    ensure_equals(numPairs, 0u);
+    ensure(indices1 == nullptr);
+    ensure(indices2 == nullptr);
+    ensure(distances == nullptr);
+}
+
+} // namespace tut
@@ -0,0 +1,141 @@
+//
+// Test Suite for C-API GEOSDistanceWithin and GEOSPreparedDistanceWithin
+
+#include <tut/tut.hpp>
+// geos
+#include <geos_c.h>
+// std
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used in test cases.
+struct test_capigeosdistancewithin_data {
+    GEOSGeometry* geom1_;
+    GEOSGeometry* geom2_;
+    const GEOSPreparedGeometry* pgeom1_;
+
+    static void
+    notice(const char* fmt, ...)
+    {
+        std::fprintf(stdout, "NOTICE: ");
+
+        va_list ap;
+        va_start(ap, fmt);
+        std::vfprintf(stdout, fmt, ap);
+        va_end(ap);
+
+        std::fprintf(stdout, "\n");
+    }
+
+    test_capigeosdistancewithin_data()
+        : geom1_(nullptr), geom2_(nullptr), pgeom1_(nullptr)
+    {
+        initGEOS(notice, notice);
+    }
+
+    ~test_capigeosdistancewithin_data()
+    {
+        GEOSGeom_destroy(geom2_);
+        GEOSPreparedGeom_destroy(pgeom1_);
+        GEOSGeom_destroy(geom1_);
+        geom1_ = nullptr;
+        geom2_ = nullptr;
+        pgeom1_ = nullptr;
+        finishGEOS();
+    }
+
+    // both functions give the expected result, in both directions
+    // for the unprepared one
+    void checkDistanceWithin(const char* wkt1, const char* wkt2,
+                             double dist, char expected)
+    {
+        geom1_ = GEOSGeomFromWKT(wkt1);
+        ensure(nullptr != geom1_);
+        pgeom1_ = GEOSPrepare(geom1_);
+        ensure(nullptr != pgeom1_);
+        geom2_ = GEOSGeomFromWKT(wkt2);
+        ensure(nullptr != geom2_);
+
+        ensure_equals("GEOSDistanceWithin", GEOSDistanceWithin(geom1_, geom2_, dist), expected);
+        ensure_equals("GEOSDistanceWithin reversed", GEOSDistanceWithin(geom2_, geom1_, dist), expected);
+        ensure_equals("GEOSPreparedDistanceWithin", GEOSPreparedDistanceWithin(pgeom1_, geom2_, dist), expected);
+    }
+};
+
+typedef test_group<test_capigeosdistancewithin_data> group;
+typedef group::object object;
+
+group test_capigeosdistancewithin_group("capi::GEOSDistanceWithin");
+
+//
+// Test Cases
+//
+
+template<>
+template<>
+void object::test<1>
+()
+{
+    checkDistanceWithin("POLYGON EMPTY", "POINT (1 1)", 1e9, 0);
+}
+
+template<>
+template<>
+void object::test<2>
+()
+{
+    checkDistanceWithin("POLYGON ((1 1, 1 5, 5 5, 5 1, 1 1))",
+                        "POLYGON ((8 8, 9 9, 9 10, 8 8))", 4.25, 1);
+}
+
+template<>
+template<>
+void object::test<3>
+()
+{
+    checkDistanceWithin("POLYGON ((1 1, 1 5, 5 5, 5 1, 1 1))",
+                        "POLYGON ((8 8, 9 9, 9 10, 8 8))", 4.24, 0);
+}
+
+template<>
+template<>
+void object::test<4>
+()
+{
+    checkDistanceWithin("LINESTRING (1 5, 5 5, 5 1, 1 1)", "POINT (2 2)", 1, 1);
+}
+
+template<>
+template<>
+void object::test<5>
+()
+{
+    checkDistanceWithin("LINESTRING (1 5, 5 5, 5 1, 1 1)", "POINT (2 2)", 0.5, 0);
+}
+
+// a point inside a polygon, far from its boundary
+template<>
+template<>
+void object::test<6>
+()
+{
+    checkDistanceWithin("POLYGON ((0 0, 100 0, 100 100, 0 100, 0 0))", "POINT (50 50)", 0, 1);
+}
+
+// a line inside a polygon, far from its boundary
+template<>
+template<>
+void object::test<7>
+()
+{
+    checkDistanceWithin("LINESTRING (40 40, 60 60)", "POLYGON ((0 0, 100 0, 100 100, 0 100, 0 0))", 0, 1);
+}
+
+} // namespace tut
+
@@ -393,5 +393,28 @@ void object::test<11>
         ensure_equals(ret, 0);
     }
 }
+
+// Test prepared relate and relate pattern
+template<>
+template<>
+void object::test<12>
+()
+{
+    geom1_ = GEOSGeomFromWKT("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))");
+    geom2_ = GEOSGeomFromWKT("LINESTRING (5 5, 20 5)");
+    prepGeom1_ = GEOSPrepare(geom1_);
+    ensure(nullptr != prepGeom1_);
+
+    char* im = GEOSPreparedRelate(prepGeom1_, geom2_);
+    ensure(nullptr != im);
+    ensure_equals(std::string(im), "1020F1102");
+    GEOSFree(im);
+
+    ensure_equals(GEOSPreparedRelatePattern(prepGeom1_, geom2_, "1020F1102"), 1);
+    ensure_equals(GEOSPreparedRelatePattern(prepGeom1_, geom2_, "T*****FF*"), 0);
+    ensure_equals(GEOSPreparedRelatePattern(prepGeom1_, geom2_, "2********"), 0);
+    ensure_equals(GEOSPreparedRelatePattern(prepGeom1_, geom2_, "bad"), 2);
+}
+
 } // namespace tut
 
@@ -0,0 +1,61 @@
+//
+// Test Suite for C-API GEOSSimplifyVW
+
+#include <tut/tut.hpp>
+// geos
+#include <geos_c.h>
+
+#include "capi_test_utils.h"
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_capigeossimplifyvw_data : public capitest::utility {};
+
+typedef test_group<test_capigeossimplifyvw_data> group;
+typedef group::object object;
+
+group test_capigeossimplifyvw_group("capi::GEOSSimplifyVW");
+
+//
+// Test Cases
+//
+
+template<>
+template<>
+void object::test<1>
+()
+{
+    GEOSGeometry* input = GEOSGeomFromWKT("LINESTRING (0 0, 1 0.1, 2 0, 3 5, 4 0)");
+    GEOSSetSRID(input, 4326);
+
+    GEOSGeometry* result = GEOSSimplifyVW(input, 1.0);
+    GEOSGeometry* expected = GEOSGeomFromWKT("LINESTRING (0 0, 2 0, 3 5, 4 0)");
+
+    ensure_equals(GEOSEqualsExact(result, expected, 0), 1);
+    ensure_equals(GEOSGetSRID(result), 4326);
+
+    GEOSGeom_destroy(input);
+    GEOSGeom_destroy(result);
+    GEOSGeom_destroy(expected);
+}
+
+template<>
+template<>
+void object::test<2>
+()
+{
+    GEOSGeometry* input = GEOSGeomFromWKT("POLYGON EMPTY");
+
+    GEOSGeometry* result = GEOSSimplifyVW(input, 43.2);
+
+    ensure(result != nullptr);
+    ensure(0 != GEOSisEmpty(result));
+
+    GEOSGeom_destroy(input);
+    GEOSGeom_destroy(result);
+}
+
+} // namespace tut
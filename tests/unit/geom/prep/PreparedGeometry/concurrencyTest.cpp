@@ -0,0 +1,137 @@
+//
+// Test Suite for sharing a PreparedGeometry between threads
+
+// tut
+#include <tut/tut.hpp>
+#include <utility.h>
+// geos
+#include <geos/geom/prep/PreparedGeometryFactory.h>
+#include <geos/geom/prep/PreparedGeometry.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/Geometry.h>
+#include <geos/io/WKTReader.h>
+// std
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace geos::geom;
+using geos::geom::prep::PreparedGeometry;
+
+namespace tut {
+
+//
+// Test Group
+//
+
+struct test_preparedgeometryconcurrency_data {
+    typedef geos::geom::GeometryFactory GeometryFactory;
+
+    geos::geom::GeometryFactory::Ptr factory;
+    geos::io::WKTReader reader;
+    std::vector<std::unique_ptr<Geometry>> testGeoms;
+
+    test_preparedgeometryconcurrency_data()
+        : factory(GeometryFactory::create())
+        , reader(factory.get())
+    {
+        std::mt19937 gen(42);
+        std::uniform_real_distribution<double> dist(-120, 120);
+        for(int i = 0; i < 200; i++) {
+            Coordinate p(dist(gen), dist(gen));
+            if(i % 2 == 0) {
+                testGeoms.emplace_back(factory->createPoint(p));
+            }
+            else {
+                std::unique_ptr<Geometry> pt(factory->createPoint(p));
+                testGeoms.push_back(pt->buffer(5 + i % 7, 2));
+            }
+        }
+    }
+
+    // the results of the predicates of each test geometry, in order
+    std::vector<double>
+    evaluate(const PreparedGeometry& pg)
+    {
+        std::vector<double> results;
+        for(const auto& g : testGeoms) {
+            results.push_back(pg.intersects(g.get()));
+            results.push_back(pg.contains(g.get()));
+            results.push_back(pg.containsProperly(g.get()));
+            results.push_back(pg.covers(g.get()));
+            results.push_back(pg.distance(g.get()));
+        }
+        return results;
+    }
+
+    // Queries a fresh prepared geometry from several threads at once,
+    // and compares with a prepared geometry used by a single thread.
+    void
+    checkConcurrent(const Geometry& g)
+    {
+        auto expected = evaluate(*prep::PreparedGeometryFactory::prepare(&g));
+
+        auto pg = prep::PreparedGeometryFactory::prepare(&g);
+        const std::size_t numThreads = 8;
+        std::vector<std::vector<double>> results(numThreads);
+        std::vector<std::thread> threads;
+        for(std::size_t i = 0; i < numThreads; i++) {
+            threads.emplace_back([this, &pg, &results, i]() {
+                results[i] = evaluate(*pg);
+            });
+        }
+        for(auto& t : threads) {
+            t.join();
+        }
+
+        for(const auto& r : results) {
+            ensure(r == expected);
+        }
+    }
+};
+
+typedef test_group<test_preparedgeometryconcurrency_data> group;
+typedef group::object object;
+
+group test_preparedgeometryconcurrency_group("geos::geom::prep::PreparedGeometry::concurrency");
+
+//
+// Test Cases
+//
+
+// Polygon with a hole
+template<>
+template<>
+void object::test<1>
+()
+{
+    auto centre = reader.read("POINT (0 0)");
+    auto outer = centre->buffer(100, 64);
+    auto inner = centre->buffer(40, 64);
+    auto g = outer->difference(inner.get());
+    checkConcurrent(*g);
+}
+
+// LineString
+template<>
+template<>
+void object::test<2>
+()
+{
+    auto g = reader.read("LINESTRING (-100 -100, 100 -50, -100 0, 100 50, -100 100)");
+    checkConcurrent(*g);
+}
+
+// MultiPoint
+template<>
+template<>
+void object::test<3>
+()
+{
+    auto g = reader.read("MULTIPOINT ((0 0), (50 50), (-50 20), (90 -90))");
+    checkConcurrent(*g);
+}
+
+} // namespace tut
@@ -0,0 +1,199 @@
+//
+// Test Suite for PreparedGeometry distance of point sets
+
+// tut
+#include <tut/tut.hpp>
+#include <utility.h>
+// geos
+#include <geos/geom/prep/PreparedGeometryFactory.h>
+#include <geos/geom/prep/PreparedGeometry.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/Point.h>
+#include <geos/geom/PointSet.h>
+#include <geos/io/WKTReader.h>
+// std
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace geos::geom;
+using geos::geom::prep::PreparedGeometry;
+
+namespace tut {
+
+//
+// Test Group
+//
+
+struct test_preparedgeometrydistance_data {
+    typedef geos::geom::GeometryFactory GeometryFactory;
+
+    geos::geom::GeometryFactory::Ptr factory;
+    geos::io::WKTReader reader;
+    std::vector<double> xs;
+    std::vector<double> ys;
+
+    test_preparedgeometrydistance_data()
+        : factory(GeometryFactory::create())
+        , reader(factory.get())
+    {
+        std::mt19937 gen(5);
+        std::uniform_real_distribution<double> dist(-20, 120);
+        for(int i = 0; i < 2000; i++) {
+            xs.push_back(dist(gen));
+            ys.push_back(dist(gen));
+        }
+        // points on vertices and edges
+        xs.insert(xs.end(), { 0, 5, 100, 50 });
+        ys.insert(ys.end(), { 0, 0, 100, 50 });
+    }
+
+    // the distances of the point set are those of each point
+    void
+    checkDistance(const std::string& wkt)
+    {
+        auto g = reader.read(wkt);
+        auto pg = prep::PreparedGeometryFactory::prepare(g.get());
+
+        PointSet pts(xs.data(), ys.data(), xs.size());
+        std::vector<double> distances(pts.size());
+        pg->distance(pts, distances.data());
+
+        for(std::size_t i = 0; i < pts.size(); i++) {
+            std::unique_ptr<Point> pt(factory->createPoint(pts.getCoordinate(i)));
+            ensure_equals(wkt + " " + pt->toString(), distances[i], pg->distance(pt.get()), 1e-12);
+        }
+    }
+};
+
+typedef test_group<test_preparedgeometrydistance_data> group;
+typedef group::object object;
+
+group test_preparedgeometrydistance_group("geos::geom::prep::PreparedGeometry::distance");
+
+//
+// Test Cases
+//
+
+// Polygonal geometries, with points inside them
+template<>
+template<>
+void object::test<1>
+()
+{
+    checkDistance("POLYGON ((0 0, 100 0, 100 100, 50 50, 0 100, 0 0), (20 20, 40 20, 40 40, 20 20))");
+    checkDistance("MULTIPOLYGON (((0 0, 40 0, 40 40, 0 40, 0 0)), ((60 60, 100 60, 100 100, 60 100, 60 60)))");
+}
+
+// Lineal and puntal geometries
+template<>
+template<>
+void object::test<2>
+()
+{
+    checkDistance("LINESTRING (0 0, 100 100, 100 0, 0 100)");
+    checkDistance("MULTILINESTRING ((0 0, 50 50), (60 0, 60 100))");
+    checkDistance("MULTIPOINT ((0 0), (50 50), (100 0))");
+}
+
+// Collections with areas, and empty geometries
+template<>
+template<>
+void object::test<3>
+()
+{
+    checkDistance("GEOMETRYCOLLECTION (POLYGON ((0 0, 40 0, 40 40, 0 40, 0 0)), LINESTRING (50 50, 100 0), POINT (90 90))");
+
+    auto g = reader.read("POLYGON EMPTY");
+    auto pg = prep::PreparedGeometryFactory::prepare(g.get());
+    PointSet pts(xs.data(), ys.data(), 3);
+    std::vector<double> distances(3);
+    pg->distance(pts, distances.data());
+    for(double d : distances) {
+        ensure_equals(d, std::numeric_limits<double>::infinity());
+    }
+}
+
+// Interleaved ordinates and several threads
+template<>
+template<>
+void object::test<4>
+()
+{
+    auto centre = reader.read("POINT (50 50)");
+    auto g = centre->buffer(40, 32);
+    auto pg = prep::PreparedGeometryFactory::prepare(g.get());
+
+    std::mt19937 gen(9);
+    std::uniform_real_distribution<double> dist(-20, 120);
+    std::vector<double> xy(2 * 20000);
+    for(double& v : xy) {
+        v = dist(gen);
+    }
+    PointSet pts = PointSet::fromXY(xy.data(), xy.size() / 2);
+
+    std::vector<double> expected(pts.size());
+    pg->distance(pts, expected.data());
+    std::vector<double> distances(pts.size());
+    pg->distance(pts, distances.data(), 4);
+
+    ensure(distances == expected);
+    for(std::size_t i = 0; i < pts.size(); i += 97) {
+        std::unique_ptr<Point> pt(factory->createPoint(pts.getCoordinate(i)));
+        ensure_equals(distances[i], g->distance(pt.get()));
+    }
+}
+
+// isWithinDistance agrees with the distance, with and without preparing
+template<>
+template<>
+void object::test<5>
+()
+{
+    std::vector<std::unique_ptr<Geometry>> bases;
+    bases.push_back(reader.read("POLYGON ((0 0, 100 0, 100 100, 50 50, 0 100, 0 0), (20 20, 40 20, 40 40, 20 20))"));
+    bases.push_back(reader.read("LINESTRING (0 0, 100 100, 100 0, 0 100)"));
+    bases.push_back(reader.read("MULTIPOINT ((0 0), (50 50), (100 0))"));
+    bases.push_back(reader.read("GEOMETRYCOLLECTION (POLYGON ((0 0, 40 0, 40 40, 0 40, 0 0)), POINT (90 90))"));
+
+    std::vector<std::unique_ptr<Geometry>> tests;
+    for(std::size_t i = 0; i < 200; i += 5) {
+        std::unique_ptr<Point> pt(factory->createPoint(Coordinate(xs[i], ys[i])));
+        if(i % 3 == 1) {
+            tests.push_back(pt->buffer(3, 2));
+        }
+        else if(i % 3 == 2) {
+            tests.push_back(pt->buffer(2, 1)->getBoundary());
+        }
+        else {
+            tests.emplace_back(pt.release());
+        }
+    }
+    // a line inside a polygon, and a polygon around a line
+    tests.push_back(reader.read("LINESTRING (5 5, 10 10)"));
+    tests.push_back(reader.read("POLYGON ((-10 -10, 110 -10, 110 110, -10 110, -10 -10))"));
+
+    for(const auto& g : bases) {
+        auto pg = prep::PreparedGeometryFactory::prepare(g.get());
+        for(const auto& t : tests) {
+            double d = g->distance(t.get());
+            for(double dist : { d + 1e-9, d + 1, d * 0.9 - 1e-6 }) {
+                bool expected = d <= dist;
+                std::string msg = g->toString() + " / " + t->toString();
+                ensure_equals(msg, g->isWithinDistance(t.get(), dist), expected);
+                ensure_equals(msg, pg->isWithinDistance(t.get(), dist), expected);
+            }
+        }
+    }
+
+    auto empty = reader.read("POINT EMPTY");
+    auto pg = prep::PreparedGeometryFactory::prepare(bases[0].get());
+    ensure_equals(bases[0]->isWithinDistance(empty.get(), 1000), false);
+    ensure_equals(pg->isWithinDistance(empty.get(), 1000), false);
+}
+
+} // namespace tut
@@ -0,0 +1,198 @@
+//
+// Test Suite for PreparedGeometry relate and relatePattern
+
+// tut
+#include <tut/tut.hpp>
+#include <utility.h>
+// geos
+#include <geos/geom/prep/PreparedGeometryFactory.h>
+#include <geos/geom/prep/PreparedGeometry.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/IntersectionMatrix.h>
+#include <geos/io/WKTReader.h>
+#include <geos/util/IllegalArgumentException.h>
+// std
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace geos::geom;
+using geos::geom::prep::PreparedGeometry;
+
+namespace tut {
+
+//
+// Test Group
+//
+
+struct test_preparedgeometryrelate_data {
+    typedef geos::geom::GeometryFactory GeometryFactory;
+
+    geos::geom::GeometryFactory::Ptr factory;
+    geos::io::WKTReader reader;
+
+    test_preparedgeometryrelate_data()
+        : factory(GeometryFactory::create())
+        , reader(factory.get())
+    {}
+
+    // relates the geometries of the WKTs with and without preparing the first
+    void
+    checkRelate(const std::string& wktA, const std::vector<std::string>& wktBs)
+    {
+        auto a = reader.read(wktA);
+        auto pa = prep::PreparedGeometryFactory::prepare(a.get());
+        // the prepared geometry is reused, to check that the cached
+        // self-noding is not modified by the calls
+        for(int pass = 0; pass < 2; pass++) {
+            for(const auto& wktB : wktBs) {
+                auto b = reader.read(wktB);
+                std::string expected = a->relate(b.get())->toString();
+                std::string obtained = pa->relate(b.get())->toString();
+                ensure_equals(wktA + " / " + wktB, obtained, expected);
+            }
+        }
+    }
+};
+
+typedef test_group<test_preparedgeometryrelate_data> group;
+typedef group::object object;
+
+group test_preparedgeometryrelate_group("geos::geom::prep::PreparedGeometry::relate");
+
+//
+// Test Cases
+//
+
+// Polygon with a hole
+template<>
+template<>
+void object::test<1>
+()
+{
+    checkRelate("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0), (3 3, 7 3, 7 7, 3 7, 3 3))", {
+        "POINT (1 1)",
+        "POINT (5 5)",
+        "POINT (0 5)",
+        "POINT (20 20)",
+        "POINT (3 5)",
+        "MULTIPOINT ((1 1), (5 5), (0 0))",
+        "LINESTRING (-5 5, 15 5)",
+        "LINESTRING (1 1, 2 2)",
+        "LINESTRING (0 0, 10 0)",
+        "LINESTRING (4 4, 6 6)",
+        "LINESTRING (12 0, 12 10)",
+        "POLYGON ((1 1, 2 1, 2 2, 1 2, 1 1))",
+        "POLYGON ((3 3, 7 3, 7 7, 3 7, 3 3))",
+        "POLYGON ((5 5, 15 5, 15 15, 5 15, 5 5))",
+        "POLYGON ((-1 -1, 11 -1, 11 11, -1 11, -1 -1))",
+        "POLYGON ((20 20, 30 20, 30 30, 20 30, 20 20))",
+        "POLYGON ((10 0, 20 0, 20 10, 10 10, 10 0))",
+        "GEOMETRYCOLLECTION (POINT (1 1), LINESTRING (20 20, 30 30))",
+        "POLYGON EMPTY",
+    });
+}
+
+// LineString and MultiLineString
+template<>
+template<>
+void object::test<2>
+()
+{
+    checkRelate("LINESTRING (0 0, 10 10, 10 0, 0 10)", {
+        "POINT (5 5)",
+        "POINT (0 0)",
+        "POINT (1 0)",
+        "LINESTRING (0 5, 10 5)",
+        "LINESTRING (0 0, 10 10)",
+        "LINESTRING (20 0, 20 10)",
+        "POLYGON ((-1 -1, 11 -1, 11 11, -1 11, -1 -1))",
+        "POLYGON ((2 2, 3 2, 3 3, 2 3, 2 2))",
+    });
+    checkRelate("MULTILINESTRING ((0 0, 5 5), (5 5, 10 0), (0 10, 10 10))", {
+        "POINT (5 5)",
+        "POINT (0 0)",
+        "LINESTRING (5 0, 5 10)",
+        "MULTIPOINT ((0 0), (10 10))",
+    });
+}
+
+// MultiPoint, MultiPolygon and GeometryCollection
+template<>
+template<>
+void object::test<3>
+()
+{
+    checkRelate("MULTIPOINT ((0 0), (5 5), (10 0))", {
+        "POINT (5 5)",
+        "LINESTRING (0 0, 10 0)",
+        "POLYGON ((1 1, 9 1, 9 9, 1 9, 1 1))",
+    });
+    checkRelate("MULTIPOLYGON (((0 0, 4 0, 4 4, 0 4, 0 0)), ((6 0, 10 0, 10 4, 6 4, 6 0)))", {
+        "POINT (5 2)",
+        "LINESTRING (2 2, 8 2)",
+        "POLYGON ((3 1, 7 1, 7 3, 3 3, 3 1))",
+        "POLYGON ((4 0, 6 0, 6 4, 4 4, 4 0))",
+    });
+    checkRelate("GEOMETRYCOLLECTION (POINT (20 20), LINESTRING (0 0, 10 10))", {
+        "POINT (20 20)",
+        "POINT (5 5)",
+        "LINESTRING (0 10, 10 0)",
+        "POINT (50 50)",
+    });
+}
+
+// Random polygons against a self-touching polygon
+template<>
+template<>
+void object::test<4>
+()
+{
+    auto a = reader.read("POLYGON ((0 0, 100 0, 100 100, 50 50, 0 100, 0 0), (20 20, 40 20, 40 40, 20 20))");
+    auto pa = prep::PreparedGeometryFactory::prepare(a.get());
+
+    std::mt19937 gen(17);
+    std::uniform_real_distribution<double> dist(-10, 110);
+    for(int i = 0; i < 200; i++) {
+        std::unique_ptr<Geometry> pt(factory->createPoint(Coordinate(dist(gen), dist(gen))));
+        auto b = pt->buffer(i % 20 + 1, 2);
+        ensure_equals(pa->relate(b.get())->toString(), a->relate(b.get())->toString());
+    }
+}
+
+// Pattern matching
+template<>
+template<>
+void object::test<5>
+()
+{
+    auto a = reader.read("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))");
+    auto pa = prep::PreparedGeometryFactory::prepare(a.get());
+
+    auto inside = reader.read("POLYGON ((1 1, 2 1, 2 2, 1 2, 1 1))");
+    auto touching = reader.read("POLYGON ((10 0, 20 0, 20 10, 10 10, 10 0))");
+    auto line = reader.read("LINESTRING (1 1, 20 20)");
+    auto far = reader.read("POINT (20 20)");
+
+    const std::vector<std::string> patterns = {
+        "T*****FF*", "T**FF*FF*", "FF*FF****", "T*F**F***", "FF*F0****",
+        "FF*F1****", "212101212", "1********", "2********", "***T*****",
+        "****1****", "******2**", "T********"
+    };
+    for(const Geometry* b : { inside.get(), touching.get(), line.get(), far.get() }) {
+        for(const auto& pattern : patterns) {
+            ensure_equals(pattern, pa->relate(b, pattern), a->relate(b, pattern));
+        }
+    }
+
+    try {
+        pa->relate(inside.get(), "T*F");
+        fail("IllegalArgumentException expected");
+    }
+    catch(const geos::util::IllegalArgumentException&) {}
+}
+
+} // namespace tut
@@ -0,0 +1,165 @@
+//
+// Test Suite for geos::operation::distance::DistanceMatrix class.
+
+// tut
+#include <tut/tut.hpp>
+// geos
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/Point.h>
+#include <geos/io/WKTReader.h>
+#include <geos/operation/distance/DistanceMatrix.h>
+// std
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace geos::geom;
+using geos::operation::distance::DistanceMatrix;
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_distancematrix_data {
+    GeometryFactory::Ptr factory_;
+    geos::io::WKTReader reader_;
+    std::vector<std::unique_ptr<Geometry>> owned_;
+    std::vector<const Geometry*> geoms1_;
+    std::vector<const Geometry*> geoms2_;
+
+    test_distancematrix_data()
+        : factory_(GeometryFactory::create())
+        , reader_(factory_.get())
+    {}
+
+    const Geometry*
+    add(std::unique_ptr<Geometry> g)
+    {
+        owned_.push_back(std::move(g));
+        return owned_.back().get();
+    }
+
+    // points, circles and rings scattered over a square
+    void
+    addRandom(std::vector<const Geometry*>& geoms, std::size_t n, unsigned int seed)
+    {
+        std::mt19937 gen(seed);
+        std::uniform_real_distribution<double> dist(0, 1000);
+        for(std::size_t i = 0; i < n; i++) {
+            std::unique_ptr<Point> pt(factory_->createPoint(Coordinate(dist(gen), dist(gen))));
+            if(i % 3 == 0) {
+                geoms.push_back(add(std::move(pt)));
+            }
+            else if(i % 3 == 1) {
+                geoms.push_back(add(pt->buffer(5 + dist(gen) / 50, 4)));
+            }
+            else {
+                geoms.push_back(add(pt->buffer(5 + dist(gen) / 50, 4)->getBoundary()));
+            }
+        }
+    }
+
+    // the dense matrix holds the distances within maxDistance, and the
+    // sparse one the same pairs in order
+    void
+    checkMatrix(double maxDistance, std::size_t numThreads)
+    {
+        DistanceMatrix matrix(geoms1_, geoms2_);
+        matrix.setMaxDistance(maxDistance);
+        matrix.setNumThreads(numThreads);
+
+        const std::size_t n2 = geoms2_.size();
+        std::vector<double> dense(geoms1_.size() * n2);
+        matrix.getDense(dense.data());
+        auto sparse = matrix.getSparse();
+
+        std::size_t k = 0;
+        for(std::size_t i = 0; i < geoms1_.size(); i++) {
+            for(std::size_t j = 0; j < n2; j++) {
+                double d = dense[i * n2 + j];
+                if(geoms1_[i]->isEmpty() || geoms2_[j]->isEmpty()) {
+                    ensure(std::isinf(d));
+                    continue;
+                }
+                double expected = geoms1_[i]->distance(geoms2_[j]);
+                if(std::isinf(d)) {
+                    ensure(expected > maxDistance - 1e-9);
+                    continue;
+                }
+                ensure(std::fabs(d - expected) <= 1e-9);
+                ensure(d <= maxDistance);
+
+                ensure(k < sparse.size());
+                ensure_equals(sparse[k].index1, i);
+                ensure_equals(sparse[k].index2, j);
+                ensure_equals(sparse[k].distance, d);
+                k++;
+            }
+        }
+        ensure_equals(k, sparse.size());
+    }
+};
+
+typedef test_group<test_distancematrix_data> group;
+typedef group::object object;
+
+group test_distancematrix_group("geos::operation::distance::DistanceMatrix");
+
+//
+// Test Cases
+//
+
+// All the pairs
+template<>
+template<>
+void object::test<1>
+()
+{
+    addRandom(geoms1_, 30, 1);
+    addRandom(geoms2_, 40, 2);
+    checkMatrix(std::numeric_limits<double>::infinity(), 1);
+}
+
+// Pairs within a distance, on several threads
+template<>
+template<>
+void object::test<2>
+()
+{
+    addRandom(geoms1_, 200, 3);
+    addRandom(geoms2_, 300, 4);
+    checkMatrix(50, 1);
+    checkMatrix(50, 4);
+    checkMatrix(0, 3);
+}
+
+// Lines inside polygons, empty geometries and empty sets
+template<>
+template<>
+void object::test<3>
+()
+{
+    geoms1_.push_back(add(reader_.read("LINESTRING (1 1, 2 2)")));
+    geoms1_.push_back(add(reader_.read("POLYGON EMPTY")));
+    geoms1_.push_back(add(reader_.read("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))")));
+    geoms1_.push_back(add(reader_.read("MULTIPOINT ((5 5), (30 30))")));
+    geoms2_.push_back(add(reader_.read("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0), (4 4, 6 4, 6 6, 4 6, 4 4))")));
+    geoms2_.push_back(add(reader_.read("LINESTRING (3 3, 7 7)")));
+    geoms2_.push_back(add(reader_.read("POINT EMPTY")));
+    geoms2_.push_back(add(reader_.read("GEOMETRYCOLLECTION (POINT (20 20), LINESTRING (8 1, 8 2))")));
+    checkMatrix(std::numeric_limits<double>::infinity(), 1);
+    checkMatrix(1, 2);
+
+    DistanceMatrix m1({}, geoms2_);
+    ensure(m1.getSparse().empty());
+    DistanceMatrix m2(geoms1_, {});
+    ensure(m2.getSparse().empty());
+    m2.getDense(nullptr);
+}
+
+} // namespace tut
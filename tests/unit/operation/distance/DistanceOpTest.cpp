@@ -17,8 +17,13 @@
 #include <geos/io/WKBReader.h>
 #include <geos/geom/CoordinateSequence.h>
 #include <geos/geom/CoordinateArraySequence.h>
+#include <geos/algorithm/Distance.h>
 // std
+#include <algorithm>
+#include <limits>
 #include <memory>
+#include <random>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -37,6 +42,50 @@ struct test_distanceop_data {
     test_distanceop_data()
         : wktreader()
     {}
+
+    // random vertices on a grid, even or odd, so that many pairs are
+    // at the same distance
+    static std::vector<geos::geom::Coordinate>
+    gridCoords(std::size_t n, int parity, unsigned int seed)
+    {
+        std::mt19937 gen(seed);
+        std::uniform_int_distribution<int> dist(0, 40);
+        std::vector<geos::geom::Coordinate> coords;
+        for(std::size_t i = 0; i < n; i++) {
+            coords.emplace_back(2 * dist(gen) + parity, 2 * dist(gen) + parity);
+        }
+        return coords;
+    }
+
+    static std::string
+    multiPointWKT(const std::vector<geos::geom::Coordinate>& coords)
+    {
+        std::ostringstream wkt;
+        wkt << "MULTIPOINT (";
+        for(std::size_t i = 0; i < coords.size(); i++) {
+            wkt << (i ? ", (" : "(") << coords[i].x << " " << coords[i].y << ")";
+        }
+        wkt << ")";
+        return wkt.str();
+    }
+
+    // the locations on which DistanceOp ends, with and without
+    // a terminating distance
+    void
+    checkLocations(const geos::geom::Geometry& g0, const geos::geom::Geometry& g1,
+                   double terminateDistance,
+                   double expectedDist,
+                   const geos::geom::Coordinate& expected0,
+                   const geos::geom::Coordinate& expected1)
+    {
+        using geos::operation::distance::DistanceOp;
+
+        DistanceOp dist(g0, g1, terminateDistance);
+        ensure_equals(dist.distance(), expectedDist);
+        CSPtr seq(dist.nearestPoints());
+        ensure(seq->getAt(0).equals2D(expected0));
+        ensure(seq->getAt(1).equals2D(expected1));
+    }
 };
 
 typedef test_group<test_distanceop_data> group;
@@ -565,6 +614,105 @@ void object::test<21>()
     ensure_equals(g1->distance(g2.get()), 1.9996999774966246);
 }
 
+// Large MultiPoints are compared through indexes, ending on the same
+// pair as the pairwise loop: the first within the terminating distance,
+// or else the first at the minimum distance
+template<>
+template<>
+void object::test<22>()
+{
+    auto coords0 = gridCoords(5000, 0, 1);
+    auto coords1 = gridCoords(6000, 1, 2);
+    auto g0 = wktreader.read(multiPointWKT(coords0));
+    auto g1 = wktreader.read(multiPointWKT(coords1));
+
+    for(double terminateDistance : { 0.0, 2.0, 5.0 }) {
+        double minDist = std::numeric_limits<double>::max();
+        std::size_t min0 = 0;
+        std::size_t min1 = 0;
+        for(std::size_t i = 0; i < coords0.size() && minDist > terminateDistance; i++) {
+            for(std::size_t j = 0; j < coords1.size(); j++) {
+                double d = coords0[i].distance(coords1[j]);
+                if(d < minDist) {
+                    minDist = d;
+                    min0 = i;
+                    min1 = j;
+                }
+                if(minDist <= terminateDistance) {
+                    break;
+                }
+            }
+        }
+        checkLocations(*g0, *g1, terminateDistance, minDist, coords0[min0], coords1[min1]);
+    }
+
+    // points far apart, and points in common
+    auto coordsFar = gridCoords(6000, 1, 4);
+    for(auto& c : coordsFar) {
+        c.x += 1000;
+    }
+    auto far = wktreader.read(multiPointWKT(coordsFar));
+    double farDist = std::numeric_limits<double>::max();
+    for(const auto& c0 : coords0) {
+        for(const auto& c1 : coordsFar) {
+            farDist = std::min(farDist, c0.distance(c1));
+        }
+    }
+    ensure_equals(g0->distance(far.get()), farDist);
+
+    coords1[2000] = coords0[1500];
+    auto g2 = wktreader.read(multiPointWKT(coords1));
+    ensure_equals(g0->distance(g2.get()), 0.0);
+}
+
+// Lines against a large MultiPoint are compared through indexes,
+// ending on the same segment and point as the pairwise loop
+template<>
+template<>
+void object::test<23>()
+{
+    using geos::algorithm::Distance;
+
+    std::vector<std::vector<geos::geom::Coordinate>> lines;
+    std::ostringstream wkt;
+    wkt << "MULTILINESTRING (";
+    for(unsigned int l = 0; l < 40; l++) {
+        lines.push_back(gridCoords(51, 0, 10 + l));
+        wkt << (l ? ", (" : "(");
+        for(std::size_t i = 0; i < lines.back().size(); i++) {
+            wkt << (i ? ", " : "") << lines.back()[i].x << " " << lines.back()[i].y;
+        }
+        wkt << ")";
+    }
+    wkt << ")";
+    auto g0 = wktreader.read(wkt.str());
+    auto coords1 = gridCoords(2000, 1, 3);
+    auto g1 = wktreader.read(multiPointWKT(coords1));
+
+    for(double terminateDistance : { 0.0, 1.0, 3.0 }) {
+        double minDist = std::numeric_limits<double>::max();
+        geos::geom::Coordinate min0;
+        geos::geom::Coordinate min1;
+        bool done = false;
+        for(std::size_t l = 0; l < lines.size() && !done; l++) {
+            for(std::size_t j = 0; j < coords1.size() && !done; j++) {
+                for(std::size_t i = 1; i < lines[l].size() && !done; i++) {
+                    double d = Distance::pointToSegment(coords1[j], lines[l][i - 1], lines[l][i]);
+                    if(d < minDist) {
+                        minDist = d;
+                        geos::geom::LineSegment(lines[l][i - 1], lines[l][i]).closestPoint(coords1[j], min0);
+                        min1 = coords1[j];
+                    }
+                    done = minDist <= terminateDistance;
+                }
+            }
+        }
+        checkLocations(*g0, *g1, terminateDistance, minDist, min0, min1);
+        // flipped
+        checkLocations(*g1, *g0, terminateDistance, minDist, min1, min0);
+    }
+}
+
 // TODO: finish the tests by adding:
 // 	LINESTRING - *all*
 // 	MULTILINESTRING - *all*
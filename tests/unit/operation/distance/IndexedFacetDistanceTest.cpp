@@ -4,6 +4,7 @@
 #define _USE_MATH_DEFINES
 
 // std
+#include <limits>
 #include <memory>
 #include <string>
 #include <vector>
@@ -366,6 +367,60 @@ void object::test<11>
     catch (const GEOSException&) { }
 }
 
+// Distance to points, without building a tree for them
+template<>
+template<>
+void object::test<12>
+()
+{
+    using geos::geom::Coordinate;
+    using geos::operation::distance::IndexedFacetDistance;
+
+    GeomPtr g0(_wktreader.read("MULTIPOLYGON (((0 0, 100 0, 100 100, 0 100, 0 0), (20 20, 80 20, 80 80, 20 80, 20 20)), ((150 0, 160 0, 150 10, 150 0)))"));
+    IndexedFacetDistance ifd(g0.get());
+    for(int i = -50; i < 200; i += 7) {
+        for(int j = -50; j < 150; j += 11) {
+            Coordinate p(i + 0.5, j * 1.1);
+            GeomPtr pt(_factory->createPoint(p));
+            ensure_equals(ifd.distance(p), ifd.distance(pt.get()));
+        }
+    }
+
+    GeomPtr empty(_wktreader.read("POLYGON EMPTY"));
+    IndexedFacetDistance emptyIfd(empty.get());
+    ensure_equals(emptyIfd.distance(Coordinate(1, 1)), std::numeric_limits<double>::infinity());
+}
+
+// isWithinDistance agrees with the distance of the facets
+template<>
+template<>
+void object::test<13>
+()
+{
+    using geos::geom::Coordinate;
+    using geos::operation::distance::IndexedFacetDistance;
+
+    GeomPtr g0(_wktreader.read("MULTIPOLYGON (((0 0, 100 0, 100 100, 0 100, 0 0), (20 20, 80 20, 80 80, 20 80, 20 20)), ((150 0, 160 0, 150 10, 150 0)))"));
+    IndexedFacetDistance ifd(g0.get());
+    for(int i = -50; i < 200; i += 13) {
+        for(int j = -50; j < 150; j += 17) {
+            GeomPtr pt(_factory->createPoint(Coordinate(i + 0.5, j * 1.1)));
+            GeomPtr line(_wktreader.read("LINESTRING (" + std::to_string(i) + " " + std::to_string(j)
+                                         + ", " + std::to_string(i + 3) + " " + std::to_string(j + 2) + ")"));
+            for(const geos::geom::Geometry* g : { pt.get(), line.get() }) {
+                double d = ifd.distance(g);
+                ensure(ifd.isWithinDistance(g, d + 1e-9));
+                ensure(ifd.isWithinDistance(g, d + 1));
+                ensure_equals(ifd.isWithinDistance(g, d * 0.99 - 1e-9), false);
+            }
+        }
+    }
+
+    GeomPtr empty(_wktreader.read("POLYGON EMPTY"));
+    ensure_equals(ifd.isWithinDistance(empty.get(), 1000), false);
+    IndexedFacetDistance emptyIfd(empty.get());
+    ensure_equals(emptyIfd.isWithinDistance(g0.get(), 1000), false);
+}
 
 
 // TODO: finish the tests by adding:
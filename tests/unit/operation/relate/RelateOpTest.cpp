@@ -0,0 +1,197 @@
+//
+// Test Suite for geos::operation::relate::RelateOp
+
+#include <tut/tut.hpp>
+// geos
+#include <geos/operation/relate/RelateOp.h>
+#include <geos/geom/prep/PreparedGeometry.h>
+#include <geos/geom/prep/PreparedGeometryFactory.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateArraySequence.h>
+#include <geos/geom/Dimension.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/IntersectionMatrix.h>
+#include <geos/geom/Point.h>
+#include <geos/io/WKTReader.h>
+#include <geos/util/IllegalArgumentException.h>
+// std
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace geos::geom;
+using geos::operation::relate::RelateOp;
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_relateop_data {
+    GeometryFactory::Ptr factory_;
+    geos::io::WKTReader reader_;
+    std::vector<std::string> patterns_;
+
+    test_relateop_data()
+        : factory_(GeometryFactory::create())
+        , reader_(factory_.get())
+        , patterns_({
+        "T*****FF*", "T*F**F***", "FF*FF****", "T*T******", "T*****T**",
+        "0********", "1********", "2********", "T*T***T**", "1*T***T**",
+        "T*F**FFF*", "FT*******", "F**T*****", "****0****", "212101212",
+        "FF2FF1212", "*******F*", "**F******", "TTTTTTTTT", "FFFFFFFF2"
+    })
+    {}
+
+    // the pattern mode agrees with the full matrix for all patterns
+    void
+    checkPatterns(const Geometry& a, const Geometry& b)
+    {
+        auto im = RelateOp::relate(&a, &b);
+        for(const auto& pattern : patterns_) {
+            ensure_equals(a.toString() + " " + b.toString() + " " + pattern,
+                          RelateOp::relate(&a, &b, pattern), im->matches(pattern));
+        }
+
+        ensure_equals(a.disjoint(&b), im->isDisjoint());
+        ensure_equals(a.intersects(&b), im->isIntersects());
+        ensure_equals(a.contains(&b), im->isContains());
+        ensure_equals(a.within(&b), im->isWithin());
+        ensure_equals(a.crosses(&b), im->isCrosses(a.getDimension(), b.getDimension()));
+        ensure_equals(a.overlaps(&b), im->isOverlaps(a.getDimension(), b.getDimension()));
+        if(!a.isEmpty() && !b.isEmpty()) {
+            ensure_equals(a.equals(&b), im->isEquals(a.getDimension(), b.getDimension()));
+        }
+    }
+};
+
+typedef test_group<test_relateop_data> group;
+typedef group::object object;
+
+group test_relateop_group("geos::operation::relate::RelateOp");
+
+//
+// Test Cases
+//
+
+// Pairs of geometries of all dimensions
+template<>
+template<>
+void object::test<1>
+()
+{
+    std::vector<std::string> wkts = {
+        "POINT (5 5)",
+        "POINT (0 0)",
+        "MULTIPOINT ((1 1), (5 5), (20 20))",
+        "LINESTRING (0 0, 10 10)",
+        "LINESTRING (0 10, 10 0)",
+        "LINESTRING (0 5, 5 5, 5 0)",
+        "LINESTRING (2 2, 8 2, 8 8, 2 8, 2 2)",
+        "MULTILINESTRING ((0 0, 5 5), (5 5, 10 0))",
+        "POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))",
+        "POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0), (3 3, 7 3, 7 7, 3 7, 3 3))",
+        "POLYGON ((5 5, 15 5, 15 15, 5 15, 5 5))",
+        "POLYGON ((1 1, 2 1, 2 2, 1 2, 1 1))",
+        "POLYGON ((10 0, 20 0, 20 10, 10 10, 10 0))",
+        "MULTIPOLYGON (((0 0, 4 0, 4 4, 0 4, 0 0)), ((6 6, 10 6, 10 10, 6 10, 6 6)))",
+        "GEOMETRYCOLLECTION (POINT (1 1), LINESTRING (2 2, 3 3))",
+        "POLYGON EMPTY",
+        "LINESTRING EMPTY",
+    };
+    for(const auto& wktA : wkts) {
+        auto a = reader_.read(wktA);
+        for(const auto& wktB : wkts) {
+            auto b = reader_.read(wktB);
+            checkPatterns(*a, *b);
+        }
+    }
+}
+
+// Random polygons and lines, which mostly intersect properly
+template<>
+template<>
+void object::test<2>
+()
+{
+    std::mt19937 gen(11);
+    std::uniform_real_distribution<double> dist(0, 100);
+    auto randomGeom = [&](int i) -> std::unique_ptr<Geometry> {
+        Coordinate p0(dist(gen), dist(gen));
+        if(i % 3 == 0) {
+            CoordinateArraySequence seq;
+            seq.add(p0);
+            seq.add(Coordinate(dist(gen), dist(gen)));
+            return std::unique_ptr<Geometry>(factory_->createLineString(seq));
+        }
+        std::unique_ptr<Point> pt(factory_->createPoint(p0));
+        return pt->buffer(5 + dist(gen) / 4, 4);
+    };
+    for(int i = 0; i < 60; i++) {
+        auto a = randomGeom(i);
+        auto b = randomGeom(i / 2);
+        checkPatterns(*a, *b);
+    }
+}
+
+// Invalid patterns are rejected, even when the matrix is not computed
+template<>
+template<>
+void object::test<3>
+()
+{
+    auto a = reader_.read("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))");
+    auto b = reader_.read("POLYGON ((5 5, 15 5, 15 15, 5 15, 5 5))");
+    try {
+        RelateOp::relate(a.get(), b.get(), "T*F");
+        fail("IllegalArgumentException expected");
+    }
+    catch(const geos::util::IllegalArgumentException&) {}
+}
+
+// Small geometries against large ones with self-nodes far from them,
+// which are only noded within the envelope intersection. The prepared
+// geometries have all their self-nodes.
+template<>
+template<>
+void object::test<4>
+()
+{
+    std::vector<std::unique_ptr<Geometry>> large;
+    large.push_back(reader_.read(
+        "MULTIPOLYGON (((0 0, 100 0, 100 100, 50 50, 0 100, 0 0), (20 20, 40 20, 40 40, 20 20)),"
+        " ((100 0, 150 50, 100 100, 100 0)))"));
+    large.push_back(reader_.read(
+        "MULTILINESTRING ((0 0, 150 100), (0 100, 150 0), (0 50, 150 50, 75 0, 75 100))"));
+    std::unique_ptr<Point> centre(factory_->createPoint(Coordinate(75, 50)));
+    large.push_back(centre->buffer(50, 200)->getBoundary());
+
+    std::mt19937 gen(23);
+    std::uniform_real_distribution<double> dist(-10, 160);
+    for(const auto& a : large) {
+        auto pa = geos::geom::prep::PreparedGeometryFactory::prepare(a.get());
+        for(int i = 0; i < 200; i++) {
+            std::unique_ptr<Point> pt(factory_->createPoint(Coordinate(dist(gen), dist(gen) * 0.7)));
+            std::unique_ptr<Geometry> b;
+            if(i % 4 == 0) {
+                b.reset(pt.release());
+            }
+            else {
+                b = pt->buffer(i % 10 + 0.5, 2);
+            }
+            if(i % 4 == 1) {
+                b = b->getBoundary();
+            }
+            auto expected = pa->relate(b.get())->toString();
+            ensure_equals(a->toString() + " / " + b->toString(),
+                          RelateOp::relate(a.get(), b.get())->toString(), expected);
+            ensure_equals(b->toString() + " / " + a->toString(),
+                          RelateOp::relate(b.get(), a.get())->toString(),
+                          RelateOp::relate(a.get(), b.get())->transpose()->toString());
+        }
+    }
+}
+
+} // namespace tut
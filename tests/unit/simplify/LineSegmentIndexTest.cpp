@@ -0,0 +1,168 @@
+// Test Suite for geos::simplify::LineSegmentIndex
+
+#include <tut/tut.hpp>
+// geos
+#include <geos/simplify/LineSegmentIndex.h>
+#include <geos/geom/LineSegment.h>
+#include <geos/geom/Envelope.h>
+// std
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace tut {
+using geos::geom::Coordinate;
+using geos::geom::Envelope;
+using geos::geom::LineSegment;
+using geos::simplify::LineSegmentIndex;
+
+//
+// Test Group
+//
+
+struct test_linesegmentindex_data {
+    std::vector<std::unique_ptr<LineSegment>> segs;
+
+    test_linesegmentindex_data()
+    {
+        // a grid of short diagonal segments
+        for(int i = 0; i < 40; i++) {
+            for(int j = 0; j < 40; j++) {
+                segs.emplace_back(new LineSegment(
+                                      Coordinate(i, j), Coordinate(i + 0.5, j + 0.5)));
+            }
+        }
+    }
+
+    std::vector<LineSegment*>
+    bruteForce(const LineSegment& q, const std::vector<bool>& live)
+    {
+        std::vector<LineSegment*> ret;
+        for(std::size_t i = 0; i < segs.size(); i++) {
+            const LineSegment* s = segs[i].get();
+            if(live[i] && Envelope::intersects(s->p0, s->p1, q.p0, q.p1)) {
+                ret.push_back(segs[i].get());
+            }
+        }
+        std::sort(ret.begin(), ret.end());
+        return ret;
+    }
+
+    static std::vector<LineSegment*>
+    sorted(std::vector<LineSegment*> v)
+    {
+        std::sort(v.begin(), v.end());
+        return v;
+    }
+};
+
+typedef test_group<test_linesegmentindex_data> group;
+typedef group::object object;
+
+group test_linesegmentindex_group("geos::simplify::LineSegmentIndex");
+
+//
+// Test Cases
+//
+
+// Queries on a bulk-loaded index match brute force
+template<>
+template<>
+void object::test<1>
+()
+{
+    LineSegmentIndex index;
+    for(const auto& s : segs) {
+        index.add(s.get());
+    }
+    ensure_equals(index.size(), segs.size());
+
+    std::vector<bool> live(segs.size(), true);
+    LineSegment q(Coordinate(3.2, 7.1), Coordinate(12.7, 9.3));
+    ensure(sorted(*index.query(&q)) == bruteForce(q, live));
+
+    LineSegment far(Coordinate(100, 100), Coordinate(101, 101));
+    ensure(index.query(&far)->empty());
+}
+
+// Removed segments are no longer returned
+template<>
+template<>
+void object::test<2>
+()
+{
+    LineSegmentIndex index;
+    for(const auto& s : segs) {
+        index.add(s.get());
+    }
+
+    std::vector<bool> live(segs.size(), true);
+    for(std::size_t i = 0; i < segs.size(); i += 3) {
+        index.remove(segs[i].get());
+        live[i] = false;
+    }
+
+    LineSegment q(Coordinate(0, 0), Coordinate(20, 20));
+    ensure(sorted(*index.query(&q)) == bruteForce(q, live));
+
+    // remove everything
+    for(std::size_t i = 0; i < segs.size(); i++) {
+        index.remove(segs[i].get());
+    }
+    ensure_equals(index.size(), 0u);
+    ensure(index.query(&q)->empty());
+}
+
+// Segments added after the first query are found and can be removed
+template<>
+template<>
+void object::test<3>
+()
+{
+    LineSegmentIndex index;
+    std::vector<bool> live(segs.size(), false);
+    std::size_t half = segs.size() / 2;
+    for(std::size_t i = 0; i < half; i++) {
+        index.add(segs[i].get());
+        live[i] = true;
+    }
+
+    LineSegment q(Coordinate(5, 5), Coordinate(35, 30));
+    ensure(sorted(*index.query(&q)) == bruteForce(q, live));
+
+    for(std::size_t i = half; i < segs.size(); i++) {
+        index.add(segs[i].get());
+        live[i] = true;
+    }
+    ensure(sorted(*index.query(&q)) == bruteForce(q, live));
+
+    index.remove(segs[half + 1].get());
+    live[half + 1] = false;
+    index.remove(segs[1].get());
+    live[1] = false;
+    ensure(sorted(*index.query(&q)) == bruteForce(q, live));
+}
+
+// Single and degenerate segments
+template<>
+template<>
+void object::test<4>
+()
+{
+    LineSegmentIndex index;
+    LineSegment s(Coordinate(1, 1), Coordinate(1, 1));
+    index.add(&s);
+
+    LineSegment q(Coordinate(0, 0), Coordinate(2, 2));
+    std::vector<LineSegment*> found;
+    index.query(&q, found);
+    ensure_equals(found.size(), 1u);
+    ensure(found[0] == &s);
+
+    index.remove(&s);
+    found.clear();
+    index.query(&q, found);
+    ensure(found.empty());
+}
+
+} // namespace tut
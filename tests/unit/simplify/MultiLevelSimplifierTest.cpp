@@ -0,0 +1,121 @@
+// Test Suite for geos::simplify::MultiLevelSimplifier
+
+#include <tut/tut.hpp>
+#include <utility.h>
+// geos
+#include <geos/simplify/MultiLevelSimplifier.h>
+#include <geos/simplify/DouglasPeuckerSimplifier.h>
+#include <geos/geom/LineString.h>
+#include <geos/util/IllegalArgumentException.h>
+// std
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <string>
+
+namespace tut {
+using namespace geos::simplify;
+
+//
+// Test Group
+//
+
+struct test_multilevelsimp_data {
+    typedef geos::geom::Geometry::Ptr GeomPtr;
+
+    geos::io::WKTReader wktreader;
+
+    // The result at every tolerance must match DouglasPeuckerSimplifier
+    void
+    checkAllLevels(const std::string& wkt)
+    {
+        GeomPtr g(wktreader.read(wkt));
+        MultiLevelSimplifier mls(g.get());
+
+        const double tolerances[] = { 0.0, 0.5, 1.0, 2.0, 3.5, 5.0, 10.0, 20.0, 100.0 };
+        for(double tol : tolerances) {
+            GeomPtr expected = DouglasPeuckerSimplifier::simplify(g.get(), tol);
+            GeomPtr actual = mls.getResultGeometry(tol);
+            ensure_equals_geometry(expected.get(), actual.get());
+        }
+    }
+};
+
+typedef test_group<test_multilevelsimp_data> group;
+typedef group::object object;
+
+group test_multilevelsimp_group("geos::simplify::MultiLevelSimplifier");
+
+//
+// Test Cases
+//
+
+// LineString
+template<>
+template<>
+void object::test<1>
+()
+{
+    checkAllLevels("LINESTRING (0 0, 2 3, 4 1, 6 7, 8 2, 10 4, 12 0, 14 9, 16 3, 18 5, 20 0)");
+}
+
+// Polygon with hole
+template<>
+template<>
+void object::test<2>
+()
+{
+    checkAllLevels("POLYGON ((0 0, 10 1, 20 0, 21 10, 20 20, 10 19, 0 20, 1 10, 0 0), \
+                    (5 5, 10 6, 15 5, 14 10, 15 15, 10 14, 5 15, 6 10, 5 5))");
+}
+
+// MultiPolygon and collections
+template<>
+template<>
+void object::test<3>
+()
+{
+    checkAllLevels("MULTIPOLYGON (((0 0, 5 1, 10 0, 10 10, 5 9, 0 10, 0 0)), \
+                    ((20 0, 25 3, 30 0, 30 10, 20 10, 20 0)))");
+    checkAllLevels("GEOMETRYCOLLECTION (POINT (1 1), \
+                    LINESTRING (0 0, 5 4, 10 0, 15 6, 20 0), \
+                    POLYGON ((0 0, 10 1, 20 0, 20 20, 0 20, 0 0)))");
+}
+
+// Vertex significances
+template<>
+template<>
+void object::test<4>
+()
+{
+    GeomPtr g(wktreader.read("LINESTRING (0 0, 5 1, 10 0, 15 4, 20 0)"));
+    MultiLevelSimplifier mls(g.get());
+
+    const std::vector<double>* sig = mls.getVertexSignificance(g.get());
+    ensure(sig != nullptr);
+    ensure_equals(sig->size(), 5u);
+    ensure_equals(sig->front(), std::numeric_limits<double>::infinity());
+    ensure_equals(sig->back(), std::numeric_limits<double>::infinity());
+    // 15 4 splits the whole line, then 10 0 its first part, then 5 1
+    ensure_equals((*sig)[3], 4.0);
+    ensure_distance((*sig)[2], 40.0 / std::sqrt(241.0), 1e-12);
+    ensure_equals((*sig)[1], 1.0);
+}
+
+// Negative tolerance
+template<>
+template<>
+void object::test<5>
+()
+{
+    GeomPtr g(wktreader.read("LINESTRING (0 0, 5 1, 10 0)"));
+    MultiLevelSimplifier mls(g.get());
+    try {
+        mls.getResultGeometry(-1.0);
+        fail("IllegalArgumentException expected");
+    }
+    catch(const geos::util::IllegalArgumentException&) {
+    }
+}
+
+} // namespace tut
@@ -7,6 +7,7 @@
 // geos
 #include <geos/simplify/TopologyPreservingSimplifier.h>
 // std
+#include <sstream>
 #include <string>
 #include <memory>
 
@@ -354,5 +355,92 @@ void object::test<16>
     ensure_equals(wktwriter.write(simp.get()),
                   "GEOMETRYCOLLECTION (LINESTRING (0 0, 10 0))");
 }
-} // namespace tut
 
+// Multithreaded simplification of separate polygons
+// gives the sequential result
+template<>
+template<>
+void object::test<17>
+()
+{
+    std::stringstream wkt;
+    wkt << "MULTIPOLYGON (";
+    for(int i = 0; i < 8; i++) {
+        for(int j = 0; j < 8; j++) {
+            double x = i * 20;
+            double y = j * 20;
+            wkt << (i || j ? ", " : "") << "((" << x << " " << y;
+            for(int k = 1; k < 10; k++) {
+                wkt << ", " << x + k << " " << y + (k % 2) * 0.2;
+            }
+            wkt << ", " << x + 10 << " " << y
+                << ", " << x + 10 << " " << y + 10
+                << ", " << x << " " << y + 10
+                << ", " << x << " " << y << "))";
+        }
+    }
+    wkt << ")";
+
+    GeomPtr g(wktreader.read(wkt.str()));
+    GeomPtr expected = TopologyPreservingSimplifier::simplify(g.get(), 1.0);
+
+    TopologyPreservingSimplifier tps(g.get());
+    tps.setDistanceTolerance(1.0);
+    tps.setNumThreads(4);
+    GeomPtr simplified = tps.getResultGeometry();
+
+    ensure("Simplified geometry is invalid!", simplified->isValid());
+    ensure_equals(simplified->getNumPoints(), 64u * 5u);
+    ensure(simplified->equalsExact(expected.get()));
+}
+
+// Multithreaded simplification of a polygonal coverage
+// keeps the rings valid
+template<>
+template<>
+void object::test<18>
+()
+{
+    std::stringstream wkt;
+    wkt << "GEOMETRYCOLLECTION (";
+    for(int i = 0; i < 8; i++) {
+        for(int j = 0; j < 8; j++) {
+            double x = i * 10;
+            double y = j * 10;
+            wkt << (i || j ? ", " : "") << "POLYGON ((" << x << " " << y;
+            for(int k = 1; k < 10; k++) {
+                wkt << ", " << x + k << " " << y + (k % 2) * 0.2;
+            }
+            wkt << ", " << x + 10 << " " << y;
+            for(int k = 1; k < 10; k++) {
+                wkt << ", " << x + 10 + (k % 2) * 0.2 << " " << y + k;
+            }
+            wkt << ", " << x + 10 << " " << y + 10;
+            for(int k = 9; k > 0; k--) {
+                wkt << ", " << x + k << " " << y + 10 + (k % 2) * 0.2;
+            }
+            wkt << ", " << x << " " << y + 10;
+            for(int k = 9; k > 0; k--) {
+                wkt << ", " << x + (k % 2) * 0.2 << " " << y + k;
+            }
+            wkt << ", " << x << " " << y << "))";
+        }
+    }
+    wkt << ")";
+
+    GeomPtr g(wktreader.read(wkt.str()));
+
+    TopologyPreservingSimplifier tps(g.get());
+    tps.setDistanceTolerance(1.0);
+    tps.setNumThreads(4);
+    GeomPtr simplified = tps.getResultGeometry();
+
+    ensure_equals(simplified->getNumGeometries(), g->getNumGeometries());
+    ensure(simplified->getNumPoints() < g->getNumPoints());
+    for(std::size_t i = 0; i < simplified->getNumGeometries(); i++) {
+        ensure("Simplified polygon is invalid!",
+               simplified->getGeometryN(i)->isValid());
+    }
+}
+
+} // namespace tut
@@ -0,0 +1,171 @@
+// Test Suite for geos::simplify::VisvalingamWhyattSimplifier
+
+#include <tut/tut.hpp>
+#include <utility.h>
+// geos
+#include <geos/simplify/VisvalingamWhyattSimplifier.h>
+#include <geos/simplify/VisvalingamWhyattLineSimplifier.h>
+#include <geos/util/IllegalArgumentException.h>
+// std
+#include <cmath>
+#include <limits>
+#include <string>
+#include <memory>
+
+namespace tut {
+using namespace geos::simplify;
+using geos::geom::Coordinate;
+
+//
+// Test Group
+//
+
+struct test_vwsimp_data {
+    typedef geos::geom::Geometry::Ptr GeomPtr;
+
+    geos::io::WKTReader wktreader;
+
+    void
+    checkSimplify(const std::string& wkt, double tolerance,
+                  const std::string& wktExpected)
+    {
+        GeomPtr g(wktreader.read(wkt));
+        GeomPtr expected(wktreader.read(wktExpected));
+        GeomPtr simplified = VisvalingamWhyattSimplifier::simplify(g.get(), tolerance);
+
+        ensure("Simplified geometry is invalid!", simplified->isValid());
+        ensure_equals_geometry(simplified.get(), expected.get());
+    }
+
+    static double
+    triangleArea(const Coordinate& a, const Coordinate& b, const Coordinate& c)
+    {
+        return std::fabs(((c.x - a.x) * (b.y - a.y) - (b.x - a.x) * (c.y - a.y)) / 2.0);
+    }
+
+    // Quadratic reference implementation, rescanning for the
+    // smallest triangle after each removal
+    static std::vector<Coordinate>
+    simplifyByScan(std::vector<Coordinate> pts, double tolerance)
+    {
+        double areaTolerance = tolerance * tolerance;
+        for(;;) {
+            double minArea = std::numeric_limits<double>::infinity();
+            std::size_t minIndex = 0;
+            for(std::size_t i = 1; i + 1 < pts.size(); i++) {
+                double a = triangleArea(pts[i - 1], pts[i], pts[i + 1]);
+                if(a < minArea) {
+                    minArea = a;
+                    minIndex = i;
+                }
+            }
+            if(minIndex == 0 || minArea >= areaTolerance) {
+                return pts;
+            }
+            pts.erase(pts.begin() + static_cast<long>(minIndex));
+        }
+    }
+};
+
+typedef test_group<test_vwsimp_data> group;
+typedef group::object object;
+
+group test_vwsimp_group("geos::simplify::VisvalingamWhyattSimplifier");
+
+//
+// Test Cases
+//
+
+// Empty polygon
+template<>
+template<>
+void object::test<1>
+()
+{
+    checkSimplify("POLYGON EMPTY", 1, "POLYGON EMPTY");
+}
+
+// Collinear vertices are removed
+template<>
+template<>
+void object::test<2>
+()
+{
+    checkSimplify("POLYGON ((20 220, 40 220, 60 220, 80 220, 100 220, 120 220, 140 220, 140 180, 100 180, 60 180, 20 180, 20 220))",
+                  10.0,
+                  "POLYGON ((20 220, 140 220, 140 180, 20 180, 20 220))");
+}
+
+// Smallest triangle first
+template<>
+template<>
+void object::test<3>
+()
+{
+    checkSimplify("LINESTRING (0 0, 1 0.1, 2 0, 3 5, 4 0)", 1.0,
+                  "LINESTRING (0 0, 2 0, 3 5, 4 0)");
+    checkSimplify("LINESTRING (0 0, 1 0.1, 2 0, 3 5, 4 0)", 4.0,
+                  "LINESTRING (0 0, 4 0)");
+}
+
+// Multilinestring and points
+template<>
+template<>
+void object::test<4>
+()
+{
+    checkSimplify("MULTILINESTRING ((0 0, 5 0.5, 10 0), (0 10, 5 15, 10 10))", 2.0,
+                  "MULTILINESTRING ((0 0, 10 0), (0 10, 5 15, 10 10))");
+    checkSimplify("MULTIPOINT ((0 0), (1 1))", 10.0,
+                  "MULTIPOINT ((0 0), (1 1))");
+}
+
+// Polygon collapsing to nothing
+template<>
+template<>
+void object::test<5>
+()
+{
+    checkSimplify("POLYGON ((0 0, 1 0, 1 1, 0 1, 0 0))", 10.0,
+                  "POLYGON EMPTY");
+}
+
+// Heap order matches a rescan for the smallest triangle
+template<>
+template<>
+void object::test<6>
+()
+{
+    std::vector<Coordinate> pts;
+    for(int i = 0; i < 400; i++) {
+        double t = i * 0.05;
+        pts.emplace_back(t * 10.0, std::sin(t * 3.0) * 5.0 + std::sin(t * 17.0) + (i % 7) * 0.1);
+    }
+
+    const double tolerances[] = { 0.1, 0.5, 1.0, 3.0 };
+    for(double tol : tolerances) {
+        auto simplified = VisvalingamWhyattLineSimplifier::simplify(pts, tol);
+        std::vector<Coordinate> expected = simplifyByScan(pts, tol);
+        ensure_equals(simplified->size(), expected.size());
+        for(std::size_t i = 0; i < expected.size(); i++) {
+            ensure(simplified->at(i).equals2D(expected[i]));
+        }
+    }
+}
+
+// Negative tolerance
+template<>
+template<>
+void object::test<7>
+()
+{
+    GeomPtr g(wktreader.read("LINESTRING (0 0, 1 1, 2 0)"));
+    try {
+        VisvalingamWhyattSimplifier::simplify(g.get(), -1.0);
+        fail("IllegalArgumentException expected");
+    }
+    catch(const geos::util::IllegalArgumentException&) {
+    }
+}
+
+} // namespace tut
@@ -0,0 +1,306 @@
+//
+// Test Suite for geos::triangulate::ConstrainedDelaunayTriangulationBuilder
+//
+// tut
+#include <tut/tut.hpp>
+// geos
+#include <geos/triangulate/ConstrainedDelaunayTriangulationBuilder.h>
+#include <geos/triangulate/DelaunayTriangulationBuilder.h>
+#include <geos/triangulate/quadedge/QuadEdgeSubdivision.h>
+#include <geos/io/WKTReader.h>
+#include <geos/algorithm/Orientation.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateArraySequence.h>
+#include <geos/geom/GeometryCollection.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/Point.h>
+#include <geos/geom/Polygon.h>
+#include <geos/triangulate/quadedge/TrianglePredicate.h>
+#include <geos/util/IllegalArgumentException.h>
+// std
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <random>
+#include <set>
+#include <utility>
+
+using namespace geos::triangulate;
+using namespace geos::geom;
+using namespace geos::io;
+using geos::algorithm::Orientation;
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_constraineddelaunay_data {
+    WKTReader reader;
+    const GeometryFactory& geomFact;
+
+    test_constraineddelaunay_data()
+        : geomFact(*GeometryFactory::getDefaultInstance())
+    {
+    }
+
+    typedef std::pair<Coordinate, Coordinate> Edge;
+
+    static Edge
+    edge(const Coordinate& a, const Coordinate& b)
+    {
+        return a.compareTo(b) < 0 ? Edge(a, b) : Edge(b, a);
+    }
+
+    // Checks that the triangles exactly cover the polygon, that all
+    // ring segments are triangle edges and that the others are Delaunay
+    std::unique_ptr<GeometryCollection>
+    checkTriangulation(const Geometry& poly, std::size_t expectedTriangles)
+    {
+        ConstrainedDelaunayTriangulationBuilder builder;
+        builder.setConstraints(poly);
+        auto tris = builder.getTriangles(geomFact);
+
+        ensure_equals("triangles", tris->getNumGeometries(), expectedTriangles);
+        ensure_distance(tris->getArea(), poly.getArea(), 1e-9 * poly.getArea());
+
+        // the vertices opposite to each edge, and the triangle circles
+        std::map<Edge, std::vector<Coordinate>> opposite;
+        for(std::size_t i = 0; i < tris->getNumGeometries(); i++) {
+            auto pts = tris->getGeometryN(i)->getCoordinates();
+            for(std::size_t j = 0; j < 3; j++) {
+                opposite[edge(pts->getAt(j), pts->getAt(j + 1))].push_back(pts->getAt((j + 2) % 3));
+            }
+        }
+
+        std::set<Edge> ringEdges;
+        const Polygon& p = dynamic_cast<const Polygon&>(poly);
+        for(std::size_t r = 0; r <= p.getNumInteriorRing(); r++) {
+            const LinearRing* ring = r == 0 ? p.getExteriorRing() : p.getInteriorRingN(r - 1);
+            const CoordinateSequence* pts = ring->getCoordinatesRO();
+            for(std::size_t i = 1; i < pts->size(); i++) {
+                Edge e = edge(pts->getAt(i - 1), pts->getAt(i));
+                ensure("ring segment", opposite.count(e) > 0);
+                ringEdges.insert(e);
+            }
+        }
+
+        // unconstrained edges are locally Delaunay
+        for(const auto& o : opposite) {
+            if(ringEdges.count(o.first)) {
+                continue;
+            }
+            ensure_equals("interior edge", o.second.size(), 2u);
+            Coordinate a = o.first.first;
+            Coordinate b = o.first.second;
+            Coordinate c = o.second[0];
+            if(Orientation::index(a, b, c) < 0) {
+                std::swap(a, b);
+            }
+            ensure("Delaunay", !TrianglePredicate::isInCircleRobust(a, b, c, o.second[1]));
+        }
+        return tris;
+    }
+};
+
+typedef test_group<test_constraineddelaunay_data> group;
+typedef group::object object;
+
+group test_constraineddelaunay_group("geos::triangulate::ConstrainedDelaunay");
+
+//
+// Test Cases
+//
+
+// 1 - Square
+template<>
+template<>
+void object::test<1>
+()
+{
+    auto poly = reader.read("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))");
+    checkTriangulation(*poly, 2);
+}
+
+// 2 - Concave polygon whose Delaunay triangulation crosses the boundary
+template<>
+template<>
+void object::test<2>
+()
+{
+    auto poly = reader.read(
+        "POLYGON ((0 0, 10 0, 10 1, 5 1.2, 10 1.4, 10 3, 5 3.2, 10 3.4, 10 5, 0 5, 5 2.5, 0 0))");
+    auto tris = checkTriangulation(*poly, 9);
+    for(std::size_t i = 0; i < tris->getNumGeometries(); i++) {
+        auto c = tris->getGeometryN(i)->getCentroid();
+        ensure("centroid", poly->contains(c.get()));
+    }
+}
+
+// 3 - Polygon with holes, one of them touching the shell
+template<>
+template<>
+void object::test<3>
+()
+{
+    auto poly = reader.read(
+        "POLYGON ((0 0, 10 0, 20 0, 20 20, 0 20, 0 0), (2 2, 2 8, 8 8, 8 2, 2 2), "
+        "(10 0, 12 5, 14 3, 10 0), (12 12, 12 18, 18 15, 12 12))");
+    // the shell and the touching hole form a single boundary of 8 vertices,
+    // plus 2 holes of 4 and 3 vertices
+    auto tris = checkTriangulation(*poly, 8 + 4 + 3 + 2 * 2 - 2);
+    for(std::size_t i = 0; i < tris->getNumGeometries(); i++) {
+        auto c = tris->getGeometryN(i)->getCentroid();
+        ensure("centroid", poly->contains(c.get()));
+    }
+}
+
+// 4 - A vertex lying on the segment of another polygon splits it
+template<>
+template<>
+void object::test<4>
+()
+{
+    auto mpoly = reader.read(
+        "MULTIPOLYGON (((0 0, 10 0, 10 10, 0 10, 0 0)), ((10 5, 15 0, 15 10, 10 5)))");
+    ConstrainedDelaunayTriangulationBuilder builder;
+    builder.setConstraints(*mpoly);
+    auto tris = builder.getTriangles(geomFact);
+
+    ensure_equals(tris->getNumGeometries(), 4u);
+    ensure_distance(tris->getArea(), mpoly->getArea(), 1e-12);
+}
+
+// 5 - Convex polygon gives the unconstrained Delaunay triangulation
+template<>
+template<>
+void object::test<5>
+()
+{
+    std::default_random_engine e(11);
+    std::uniform_real_distribution<> dis(0, 100);
+    std::vector<std::unique_ptr<Point>> pts;
+    for(int i = 0; i < 500; i++) {
+        pts.emplace_back(geomFact.createPoint(Coordinate(dis(e), dis(e))));
+    }
+    auto mp = geomFact.createMultiPoint(std::move(pts));
+    auto hull = mp->convexHull();
+
+    ConstrainedDelaunayTriangulationBuilder builder;
+    builder.setConstraints(*hull);
+    auto results = builder.getTriangles(geomFact);
+
+    DelaunayTriangulationBuilder dtb;
+    dtb.setSites(*hull);
+    auto expected = dtb.getTriangles(geomFact);
+
+    results->normalize();
+    expected->normalize();
+    ensure(results->equalsExact(expected.get()));
+}
+
+// 6 - Large star-shaped polygon with a hole
+template<>
+template<>
+void object::test<6>
+()
+{
+    const std::size_t n = 20000;
+    std::default_random_engine e(3);
+    std::uniform_real_distribution<> dis(50, 100);
+
+    std::unique_ptr<CoordinateArraySequence> shell(new CoordinateArraySequence());
+    for(std::size_t i = 0; i < n; i++) {
+        double a = 2 * M_PI * static_cast<double>(i) / static_cast<double>(n);
+        double r = dis(e);
+        shell->add(Coordinate(r * std::cos(a), r * std::sin(a)));
+    }
+    shell->add(shell->getAt(0));
+
+    std::unique_ptr<CoordinateArraySequence> hole(new CoordinateArraySequence());
+    for(std::size_t i = 0; i < 100; i++) {
+        double a = -2 * M_PI * static_cast<double>(i) / 100.0;
+        hole->add(Coordinate(20 * std::cos(a), 20 * std::sin(a)));
+    }
+    hole->add(hole->getAt(0));
+
+    std::vector<std::unique_ptr<LinearRing>> holes;
+    holes.push_back(geomFact.createLinearRing(std::move(hole)));
+    auto poly = geomFact.createPolygon(geomFact.createLinearRing(std::move(shell)), std::move(holes));
+
+    checkTriangulation(*poly, n + 100 + 2 - 2);
+}
+
+// 7 - Non-polygonal and invalid inputs
+template<>
+template<>
+void object::test<7>
+()
+{
+    ConstrainedDelaunayTriangulationBuilder builder;
+    builder.setConstraints(*reader.read("LINESTRING (0 0, 10 0, 10 10)"));
+    ensure(builder.getTriangles(geomFact)->isEmpty());
+
+    builder.setConstraints(*reader.read("POLYGON EMPTY"));
+    ensure(builder.getTriangles(geomFact)->isEmpty());
+
+    builder.setConstraints(*reader.read("POLYGON ((0 0, 10 0, 20 0, 0 0))"));
+    ensure(builder.getTriangles(geomFact)->isEmpty());
+
+    // self-crossing ring
+    builder.setConstraints(*reader.read("POLYGON ((0 0, 10 10, 10 0, 0 10, 0 0))"));
+    try {
+        builder.getTriangles(geomFact);
+        fail("IllegalArgumentException expected");
+    }
+    catch(const geos::util::IllegalArgumentException&) {
+    }
+}
+
+// 8 - Adjacent polygons in a collection, and an island inside a hole
+template<>
+template<>
+void object::test<8>
+()
+{
+    // two half-discs sharing their diameter, one counter-clockwise
+    // and one clockwise
+    const std::size_t n = 40;
+    std::unique_ptr<CoordinateArraySequence> upper(new CoordinateArraySequence());
+    std::unique_ptr<CoordinateArraySequence> lower(new CoordinateArraySequence());
+    for(std::size_t i = 0; i < n; i++) {
+        double a = M_PI * static_cast<double>(i) / static_cast<double>(n - 1);
+        upper->add(Coordinate(10 * std::cos(a), 10 * std::sin(a)));
+        lower->add(Coordinate(10 * std::cos(a), -10 * std::sin(a)));
+    }
+    upper->add(upper->getAt(0));
+    lower->add(lower->getAt(0));
+    std::vector<std::unique_ptr<Geometry>> halves;
+    halves.push_back(geomFact.createPolygon(geomFact.createLinearRing(std::move(upper))));
+    halves.push_back(geomFact.createPolygon(geomFact.createLinearRing(std::move(lower))));
+    auto discs = geomFact.createGeometryCollection(std::move(halves));
+
+    ConstrainedDelaunayTriangulationBuilder builder;
+    builder.setConstraints(*discs);
+    auto tris = builder.getTriangles(geomFact);
+    ensure_equals(tris->getNumGeometries(), 2 * (n - 2));
+    ensure_distance(tris->getArea(), discs->getArea(), 1e-9 * discs->getArea());
+
+    // a square with a hole holding an island which holds a lake,
+    // next to a square sharing an edge with it
+    auto nested = reader.read(
+        "GEOMETRYCOLLECTION ("
+        "POLYGON ((0 0, 30 0, 30 30, 0 30, 0 0), (5 5, 25 5, 25 25, 5 25, 5 5)),"
+        "POLYGON ((10 10, 20 10, 20 20, 10 20, 10 10), (13 13, 13 17, 17 17, 17 13, 13 13)),"
+        "POLYGON ((30 0, 40 0, 40 30, 30 30, 30 0)))");
+    builder.setConstraints(*nested);
+    tris = builder.getTriangles(geomFact);
+    ensure_distance(tris->getArea(), nested->getArea(), 1e-9 * nested->getArea());
+    for(std::size_t i = 0; i < tris->getNumGeometries(); i++) {
+        auto c = tris->getGeometryN(i)->getCentroid();
+        ensure("centroid", nested->intersects(c.get()));
+    }
+}
+
+} // namespace tut
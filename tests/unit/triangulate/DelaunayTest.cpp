@@ -7,14 +7,21 @@
 // geos
 #include <geos/triangulate/quadedge/QuadEdge.h>
 #include <geos/triangulate/quadedge/QuadEdgeSubdivision.h>
+#include <geos/triangulate/quadedge/HalfEdgeSubdivision.h>
+#include <geos/triangulate/quadedge/TrianglePredicate.h>
 #include <geos/triangulate/IncrementalDelaunayTriangulator.h>
 #include <geos/triangulate/DelaunayTriangulationBuilder.h>
+#include <geos/triangulate/quadedge/JumpAndWalkQuadEdgeLocator.h>
 //#include <geos/io/WKTWriter.h>
 #include <geos/io/WKTReader.h>
 #include <geos/geom/GeometryCollection.h>
 #include <geos/geom/GeometryFactory.h>
 #include <geos/geom/CoordinateArraySequence.h>
+#include <geos/geom/PointSet.h>
 //#include <stdio.h>
+// std
+#include <cmath>
+#include <random>
 
 using namespace geos::triangulate;
 using namespace geos::triangulate::quadedge;
@@ -46,23 +53,27 @@ runDelaunay(const char* sitesWkt, bool computeTriangles, const char* expectedWkt
     std::unique_ptr<Geometry> results;
     auto sites = reader.read(sitesWkt);
     auto expected = reader.read(expectedWkt);
-    DelaunayTriangulationBuilder builder;
-    builder.setTolerance(tolerance);
     const GeometryFactory& geomFact(*GeometryFactory::getDefaultInstance());
+    expected->normalize();
 
-    builder.setSites(*sites);
-    if(computeTriangles) {
-        results = builder.getTriangles(geomFact);
-    }
-    else {
-        results = builder.getEdges(geomFact);
-    }
+    for(bool compact : { false, true }) {
+        DelaunayTriangulationBuilder builder;
+        builder.setTolerance(tolerance);
+        builder.setCompact(compact);
 
-    results->normalize();
-    expected->normalize();
+        builder.setSites(*sites);
+        if(computeTriangles) {
+            results = builder.getTriangles(geomFact);
+        }
+        else {
+            results = builder.getEdges(geomFact);
+        }
+
+        results->normalize();
 
-    ensure(results->toString(), results->equalsExact(expected.get(), 1e-7));
-    ensure_equals(results->getCoordinateDimension(), expected->getCoordinateDimension());
+        ensure(results->toString(), results->equalsExact(expected.get(), 1e-7));
+        ensure_equals(results->getCoordinateDimension(), expected->getCoordinateDimension());
+    }
 }
 
 //
@@ -257,4 +268,353 @@ void object::test<12>
     }
 }
 
+// 13 - Hilbert and BRIO insertion orders give the same triangulation
+template<>
+template<>
+void object::test<13>
+()
+{
+    std::default_random_engine e(2021);
+    std::uniform_real_distribution<> dis(0, 100);
+    CoordinateArraySequence seq;
+    for(int i = 0; i < 2000; i++) {
+        seq.add(Coordinate(dis(e), dis(e)));
+    }
+    const GeometryFactory& geomFact(*GeometryFactory::getDefaultInstance());
+
+    DelaunayTriangulationBuilder lexBuilder;
+    lexBuilder.setSites(seq);
+    auto expected = lexBuilder.getTriangles(geomFact);
+    expected->normalize();
+
+    for(auto order : { DelaunayTriangulationBuilder::InsertionOrder::HILBERT,
+                       DelaunayTriangulationBuilder::InsertionOrder::BRIO }) {
+        DelaunayTriangulationBuilder builder;
+        builder.setInsertionOrder(order);
+        builder.setSites(seq);
+        auto results = builder.getTriangles(geomFact);
+        results->normalize();
+        ensure(results->equalsExact(expected.get()));
+    }
+}
+
+// 14 - Gridded sites in all insertion orders
+template<>
+template<>
+void object::test<14>
+()
+{
+    CoordinateArraySequence seq;
+    for(int i = 0; i < 40; i++) {
+        for(int j = 0; j < 30; j++) {
+            seq.add(Coordinate(i, j));
+        }
+    }
+    const GeometryFactory& geomFact(*GeometryFactory::getDefaultInstance());
+
+    for(auto order : { DelaunayTriangulationBuilder::InsertionOrder::LEXICOGRAPHIC,
+                       DelaunayTriangulationBuilder::InsertionOrder::HILBERT,
+                       DelaunayTriangulationBuilder::InsertionOrder::BRIO }) {
+        DelaunayTriangulationBuilder builder;
+        builder.setInsertionOrder(order);
+        builder.setSites(seq);
+        auto results = builder.getTriangles(geomFact);
+        // diagonals of cocircular cells may differ, counts and area do not
+        ensure_equals(results->getNumGeometries(), 2u * 39u * 29u);
+        ensure_equals(results->getArea(), 39.0 * 29.0);
+    }
+}
+
+// 15 - Jump-and-walk locator with sites inserted in random order
+template<>
+template<>
+void object::test<15>
+()
+{
+    std::default_random_engine e(42);
+    std::uniform_real_distribution<> dis(0, 100);
+    CoordinateArraySequence seq;
+    for(int i = 0; i < 2000; i++) {
+        seq.add(Coordinate(dis(e), dis(e)));
+    }
+    const GeometryFactory& geomFact(*GeometryFactory::getDefaultInstance());
+
+    DelaunayTriangulationBuilder builder;
+    builder.setSites(seq);
+    auto expected = builder.getTriangles(geomFact);
+    expected->normalize();
+
+    Envelope env = DelaunayTriangulationBuilder::envelope(seq);
+    QuadEdgeSubdivision subdiv(env, 0.0);
+    subdiv.setLocator(std::unique_ptr<QuadEdgeLocator>(new JumpAndWalkQuadEdgeLocator(&subdiv)));
+    IncrementalDelaunayTriangulator triangulator(&subdiv);
+    triangulator.insertSites(DelaunayTriangulationBuilder::toVertices(seq));
+
+    auto results = subdiv.getTriangles(geomFact);
+    results->normalize();
+    ensure(results->equalsExact(expected.get()));
+}
+
+// 16 - Indexed mesh matches the triangle polygons
+template<>
+template<>
+void object::test<16>
+()
+{
+    std::default_random_engine e(7);
+    std::uniform_real_distribution<> dis(0, 100);
+    CoordinateArraySequence seq;
+    for(int i = 0; i < 500; i++) {
+        seq.add(Coordinate(dis(e), dis(e)));
+    }
+    const GeometryFactory& geomFact(*GeometryFactory::getDefaultInstance());
+
+    DelaunayTriangulationBuilder builder;
+    builder.setSites(seq);
+    auto tris = builder.getTriangles(geomFact);
+    auto mesh = builder.getTriangleMesh(true);
+
+    ensure_equals(mesh.getNumVertices(), 500u);
+    ensure_equals(mesh.getNumTriangles(), tris->getNumGeometries());
+    ensure_equals(mesh.neighbours.size(), mesh.triangles.size());
+
+    for(std::size_t t = 0; t < mesh.getNumTriangles(); t++) {
+        auto ring = tris->getGeometryN(t)->getCoordinates();
+        for(std::size_t i = 0; i < 3; i++) {
+            int32_t v = mesh.triangles[3 * t + i];
+            ensure_equals(mesh.vertices[3 * v], ring->getX(i));
+            ensure_equals(mesh.vertices[3 * v + 1], ring->getY(i));
+
+            // the neighbour across edge (v0, v1) has the edge (v1, v0)
+            int32_t n = mesh.neighbours[3 * t + i];
+            if(n < 0) {
+                continue;
+            }
+            int32_t v1 = mesh.triangles[3 * t + (i + 1) % 3];
+            bool found = false;
+            for(std::size_t j = 0; j < 3; j++) {
+                if(mesh.triangles[3 * n + j] == v1 &&
+                        mesh.triangles[3 * n + (j + 1) % 3] == v &&
+                        mesh.neighbours[3 * n + j] == static_cast<int32_t>(t)) {
+                    found = true;
+                }
+            }
+            ensure(found);
+        }
+    }
+}
+
+// 17 - Parallel divide-and-conquer gives the sequential triangulation
+template<>
+template<>
+void object::test<17>
+()
+{
+    std::default_random_engine e(33);
+    std::uniform_real_distribution<> dis(0, 100);
+    CoordinateArraySequence seq;
+    for(int i = 0; i < 20000; i++) {
+        seq.add(Coordinate(dis(e), dis(e)));
+    }
+    const GeometryFactory& geomFact(*GeometryFactory::getDefaultInstance());
+
+    DelaunayTriangulationBuilder builder;
+    builder.setSites(seq);
+    auto expected = builder.getTriangles(geomFact);
+    expected->normalize();
+    auto expectedEdges = builder.getEdges(geomFact);
+    expectedEdges->normalize();
+
+    for(std::size_t numThreads : { 2, 3, 8 }) {
+        DelaunayTriangulationBuilder parBuilder;
+        parBuilder.setNumThreads(numThreads);
+        parBuilder.setSites(seq);
+        auto results = parBuilder.getTriangles(geomFact);
+        results->normalize();
+        ensure(results->equalsExact(expected.get()));
+
+        auto edges = parBuilder.getEdges(geomFact);
+        edges->normalize();
+        ensure(edges->equalsExact(expectedEdges.get()));
+    }
+}
+
+// 18 - Parallel triangulation of small and collinear inputs
+template<>
+template<>
+void object::test<18>
+()
+{
+    const char* wkt = "MULTIPOINT ((0 0), (1 0), (2 0), (3 0), (4 0), (5 0))";
+    runDelaunay(wkt, false, "MULTILINESTRING ((4 0, 5 0), (3 0, 4 0), (2 0, 3 0), (1 0, 2 0), (0 0, 1 0))");
+
+    WKTReader reader;
+    const GeometryFactory& geomFact(*GeometryFactory::getDefaultInstance());
+    for(const char* sites : { "MULTIPOINT ((0 0), (1 0), (2 0), (3 0), (4 0), (5 0))",
+                              "MULTIPOINT ((0 0), (10 0), (10 10), (0 10), (5 5))",
+                              "MULTIPOINT ((1 1))" }) {
+        auto g = reader.read(sites);
+
+        DelaunayTriangulationBuilder builder;
+        builder.setSites(*g);
+        auto expected = builder.getEdges(geomFact);
+        expected->normalize();
+
+        DelaunayTriangulationBuilder parBuilder;
+        parBuilder.setNumThreads(4);
+        parBuilder.setSites(*g);
+        auto results = parBuilder.getEdges(geomFact);
+        results->normalize();
+        ensure(results->toString(), results->equalsExact(expected.get()));
+    }
+}
+
+// 19 - Compact storage gives the same triangulation and mesh
+template<>
+template<>
+void object::test<19>
+()
+{
+    std::default_random_engine e(19);
+    std::uniform_real_distribution<> dis(0, 100);
+    CoordinateArraySequence seq;
+    for(int i = 0; i < 5000; i++) {
+        seq.add(Coordinate(dis(e), dis(e), dis(e)));
+    }
+    const GeometryFactory& geomFact(*GeometryFactory::getDefaultInstance());
+
+    DelaunayTriangulationBuilder builder;
+    builder.setSites(seq);
+    auto expected = builder.getTriangles(geomFact);
+    expected->normalize();
+    auto expectedEdges = builder.getEdges(geomFact);
+    expectedEdges->normalize();
+
+    for(auto order : { DelaunayTriangulationBuilder::InsertionOrder::LEXICOGRAPHIC,
+                       DelaunayTriangulationBuilder::InsertionOrder::BRIO }) {
+        DelaunayTriangulationBuilder compactBuilder;
+        compactBuilder.setCompact(true);
+        compactBuilder.setInsertionOrder(order);
+        compactBuilder.setSites(seq);
+
+        auto results = compactBuilder.getTriangles(geomFact);
+        auto mesh = compactBuilder.getTriangleMesh(true);
+        ensure_equals(mesh.getNumVertices(), seq.size());
+        ensure_equals(mesh.getNumTriangles(), results->getNumGeometries());
+        for(std::size_t t = 0; t < mesh.getNumTriangles(); t++) {
+            auto ring = results->getGeometryN(t)->getCoordinates();
+            for(std::size_t i = 0; i < 3; i++) {
+                int32_t v = mesh.triangles[3 * t + i];
+                ensure_equals(mesh.vertices[3 * v], ring->getX(i));
+                ensure_equals(mesh.vertices[3 * v + 1], ring->getY(i));
+                ensure_equals(mesh.vertices[3 * v + 2], ring->getAt(i).z);
+
+                int32_t n = mesh.neighbours[3 * t + i];
+                if(n >= 0) {
+                    int32_t v1 = mesh.triangles[3 * t + (i + 1) % 3];
+                    bool found = false;
+                    for(std::size_t j = 0; j < 3; j++) {
+                        found |= mesh.triangles[3 * n + j] == v1 && mesh.triangles[3 * n + (j + 1) % 3] == v;
+                    }
+                    ensure(found);
+                }
+            }
+        }
+
+        results->normalize();
+        ensure(results->equalsExact(expected.get()));
+
+        auto edges = compactBuilder.getEdges(geomFact);
+        edges->normalize();
+        ensure(edges->equalsExact(expectedEdges.get()));
+    }
+}
+
+// 20 - Compact storage with gridded, repeated and collinear sites
+template<>
+template<>
+void object::test<20>
+()
+{
+    CoordinateArraySequence seq;
+    for(int i = 0; i < 40; i++) {
+        for(int j = 0; j < 30; j++) {
+            seq.add(Coordinate(i, j));
+        }
+    }
+    // repeated sites, and sites lying on the diagonals of grid cells
+    for(int i = 0; i < 39; i += 3) {
+        seq.add(Coordinate(i, 0));
+        seq.add(Coordinate(i + 0.5, 0.5));
+    }
+
+    Envelope env = DelaunayTriangulationBuilder::envelope(seq);
+    for(auto order : { DelaunayTriangulationBuilder::InsertionOrder::LEXICOGRAPHIC,
+                       DelaunayTriangulationBuilder::InsertionOrder::HILBERT }) {
+        auto vertices = DelaunayTriangulationBuilder::toVertices(seq);
+        if(order == DelaunayTriangulationBuilder::InsertionOrder::HILBERT) {
+            IncrementalDelaunayTriangulator::sortHilbert(vertices);
+        }
+        HalfEdgeSubdivision subdiv(env, 0.0);
+        IncrementalDelaunayTriangulator triangulator(&subdiv);
+        triangulator.insertSites(vertices);
+
+        ensure_equals(subdiv.getNumVertices(), 3u + 40u * 30u + 13u);
+
+        // the triangles cover the grid and are locally Delaunay
+        std::size_t numTriangles = 0;
+        double area = 0;
+        subdiv.visitTriangles([&](int32_t t) {
+            numTriangles++;
+            Coordinate p[3];
+            for(int32_t i = 0; i < 3; i++) {
+                int32_t v = subdiv.orig(t + i);
+                p[i] = Coordinate(subdiv.getX(v), subdiv.getY(v));
+            }
+            area += ((p[1].x - p[0].x) * (p[2].y - p[0].y) - (p[1].y - p[0].y) * (p[2].x - p[0].x)) / 2;
+            for(int32_t i = 0; i < 3; i++) {
+                int32_t f = subdiv.twin(t + i);
+                if(f < 0) {
+                    continue;
+                }
+                int32_t d = subdiv.orig(HalfEdgeSubdivision::prev(f));
+                ensure(!TrianglePredicate::isInCircleRobust(p[0], p[1], p[2],
+                       Coordinate(subdiv.getX(d), subdiv.getY(d))));
+            }
+        }, false);
+        ensure_equals(numTriangles, 2u * 39u * 29u + 2u * 13u);
+        ensure_equals(area, 39.0 * 29.0);
+    }
+}
+
+// Sites given as ordinate arrays
+template<>
+template<>
+void object::test<21>
+()
+{
+    std::mt19937 gen(11);
+    std::uniform_real_distribution<double> dist(0.0, 100.0);
+    std::vector<double> xyz;
+    std::vector<Coordinate> coords;
+    for(std::size_t i = 0; i < 500; i++) {
+        double x = std::floor(dist(gen));
+        double y = std::floor(dist(gen));
+        xyz.insert(xyz.end(), { x, y, 1.0 });
+        coords.emplace_back(x, y);
+    }
+    auto geomFact = GeometryFactory::create();
+    std::unique_ptr<Geometry> sites(geomFact->createMultiPoint(coords));
+
+    DelaunayTriangulationBuilder expected;
+    expected.setSites(*sites);
+    DelaunayTriangulationBuilder actual;
+    actual.setSites(PointSet::fromXYZ(xyz.data(), 500));
+
+    auto expectedTris = expected.getTriangles(*geomFact);
+    auto actualTris = actual.getTriangles(*geomFact);
+    ensure(actualTris->equalsExact(expectedTris.get()));
+    ensure_equals(actualTris->getCoordinate()->z, 1.0);
+}
+
 } // namespace tut
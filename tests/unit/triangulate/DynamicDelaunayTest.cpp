@@ -0,0 +1,266 @@
+//
+// Test Suite for geos::triangulate::DynamicDelaunayTriangulation
+//
+// tut
+#include <tut/tut.hpp>
+// geos
+#include <geos/triangulate/DynamicDelaunayTriangulation.h>
+#include <geos/triangulate/IncrementalDelaunayTriangulator.h>
+#include <geos/triangulate/quadedge/QuadEdgeSubdivision.h>
+#include <geos/triangulate/quadedge/TrianglePredicate.h>
+#include <geos/triangulate/quadedge/VoronoiCells.h>
+#include <geos/geom/CoordinateArraySequence.h>
+#include <geos/geom/GeometryCollection.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/util/IllegalArgumentException.h>
+// std
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace geos::triangulate;
+using namespace geos::triangulate::quadedge;
+using namespace geos::geom;
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_dyndelaunay_data {
+    const GeometryFactory& geomFact;
+
+    test_dyndelaunay_data()
+        : geomFact(*GeometryFactory::getDefaultInstance())
+    {
+    }
+
+    std::vector<Coordinate>
+    randomSites(std::size_t n, unsigned int seed)
+    {
+        std::mt19937 gen(seed);
+        std::uniform_real_distribution<double> dist(0.0, 100.0);
+        std::vector<Coordinate> sites;
+        for(std::size_t i = 0; i < n; i++) {
+            double x = dist(gen);
+            double y = dist(gen);
+            sites.emplace_back(x, y);
+        }
+        return sites;
+    }
+
+    // the triangles of a triangulation of the sites built from scratch
+    // in the same frame
+    std::unique_ptr<Geometry>
+    rebuild(const Envelope& env, const std::vector<Coordinate>& sites)
+    {
+        QuadEdgeSubdivision subdiv(env, 0.0);
+        IncrementalDelaunayTriangulator triangulator(&subdiv);
+        IncrementalDelaunayTriangulator::VertexList vertices(sites.begin(), sites.end());
+        std::sort(vertices.begin(), vertices.end());
+        triangulator.insertSites(vertices);
+        std::unique_ptr<Geometry> tris = subdiv.getTriangles(geomFact);
+        tris->normalize();
+        return tris;
+    }
+
+    // checks that no site is strictly inside the circumcircle of a
+    // neighbouring triangle
+    void
+    checkDelaunay(DynamicDelaunayTriangulation& dt)
+    {
+        TriangleMesh mesh = dt.getTriangleMesh(true);
+        auto coord = [&mesh](int32_t v) {
+            return Coordinate(mesh.vertices[3 * static_cast<std::size_t>(v)],
+                              mesh.vertices[3 * static_cast<std::size_t>(v) + 1]);
+        };
+        for(std::size_t t = 0; t < mesh.getNumTriangles(); t++) {
+            Coordinate a = coord(mesh.triangles[3 * t]);
+            Coordinate b = coord(mesh.triangles[3 * t + 1]);
+            Coordinate c = coord(mesh.triangles[3 * t + 2]);
+            for(std::size_t i = 0; i < 3; i++) {
+                int32_t nb = mesh.neighbours[3 * t + i];
+                if(nb < 0) {
+                    continue;
+                }
+                for(std::size_t j = 0; j < 3; j++) {
+                    Coordinate p = coord(mesh.triangles[3 * static_cast<std::size_t>(nb) + j]);
+                    ensure(!TrianglePredicate::isInCircleRobust(a, b, c, p));
+                }
+            }
+        }
+    }
+};
+
+typedef test_group<test_dyndelaunay_data> group;
+typedef group::object object;
+
+group test_dyndelaunay_group("geos::triangulate::DynamicDelaunay");
+
+//
+// Test Cases
+//
+
+// Removing random sites gives the triangulation of the remaining ones
+template<>
+template<>
+void object::test<1>
+()
+{
+    Envelope env(0, 100, 0, 100);
+    std::vector<Coordinate> sites = randomSites(600, 17);
+
+    DynamicDelaunayTriangulation dt(env);
+    for(const Coordinate& p : sites) {
+        ensure(dt.insertSite(p));
+    }
+    ensure_equals(dt.getNumSites(), sites.size());
+
+    std::mt19937 gen(5);
+    std::shuffle(sites.begin(), sites.end(), gen);
+    std::vector<Coordinate> removed(sites.begin(), sites.begin() + 400);
+    sites.erase(sites.begin(), sites.begin() + 400);
+    for(const Coordinate& p : removed) {
+        ensure(dt.removeSite(p));
+    }
+    ensure_equals(dt.getNumSites(), sites.size());
+
+    std::unique_ptr<Geometry> tris = dt.getTriangles(geomFact);
+    tris->normalize();
+    ensure(tris->equalsExact(rebuild(env, sites).get()));
+    checkDelaunay(dt);
+}
+
+// Interleaved insertions and removals
+template<>
+template<>
+void object::test<2>
+()
+{
+    Envelope env(0, 100, 0, 100);
+    std::vector<Coordinate> pool = randomSites(400, 3);
+
+    DynamicDelaunayTriangulation dt(env);
+    std::vector<Coordinate> current;
+    std::mt19937 gen(11);
+    for(const Coordinate& p : pool) {
+        dt.insertSite(p);
+        current.push_back(p);
+        if(current.size() > 20 && gen() % 3 == 0) {
+            std::size_t i = gen() % current.size();
+            ensure(dt.removeSite(current[i]));
+            current.erase(current.begin() + static_cast<long>(i));
+        }
+    }
+
+    std::unique_ptr<Geometry> tris = dt.getTriangles(geomFact);
+    tris->normalize();
+    ensure(tris->equalsExact(rebuild(env, current).get()));
+
+    // the deleted edges are dropped from the subdivision
+    QuadEdgeSubdivision& subdiv = dt.getSubdivision();
+    for(auto& q : subdiv.getEdges()) {
+        ensure(q.base().isLive());
+    }
+    ensure_equals(dt.getTriangleMesh().getNumTriangles(), rebuild(env, current)->getNumGeometries());
+}
+
+// Removing sites of a grid, whose neighbours are cocircular
+template<>
+template<>
+void object::test<3>
+()
+{
+    Envelope env(0, 9, 0, 9);
+    CoordinateArraySequence grid;
+    for(int i = 0; i < 10; i++) {
+        for(int j = 0; j < 10; j++) {
+            grid.add(Coordinate(i, j));
+        }
+    }
+
+    DynamicDelaunayTriangulation dt(env);
+    ensure_equals(dt.insertSites(grid), 100u);
+    for(int i = 1; i < 9; i += 2) {
+        for(int j = 0; j < 10; j += 3) {
+            ensure(dt.removeSite(Coordinate(i, j)));
+        }
+    }
+    ensure_equals(dt.getNumSites(), 84u);
+    checkDelaunay(dt);
+
+    std::unique_ptr<GeometryCollection> tris = dt.getTriangles(geomFact);
+    ensure_distance(tris->getArea(), 81.0, 1e-9);
+}
+
+// Duplicate, absent and out of envelope sites
+template<>
+template<>
+void object::test<4>
+()
+{
+    DynamicDelaunayTriangulation dt(Envelope(0, 10, 0, 10));
+    ensure(dt.insertSite(Coordinate(1, 1)));
+    ensure(dt.insertSite(Coordinate(9, 2)));
+    ensure(dt.insertSite(Coordinate(5, 8)));
+    ensure(!dt.insertSite(Coordinate(9, 2)));
+    ensure(dt.containsSite(Coordinate(5, 8)));
+    ensure(!dt.containsSite(Coordinate(5, 5)));
+    ensure(!dt.removeSite(Coordinate(5, 5)));
+    ensure(!dt.removeSite(Coordinate(50, 50)));
+
+    try {
+        dt.insertSite(Coordinate(11, 5));
+        fail("IllegalArgumentException expected");
+    }
+    catch(const geos::util::IllegalArgumentException&) {}
+
+    ensure_equals(dt.getTriangles(geomFact)->getNumGeometries(), 1u);
+    ensure(dt.removeSite(Coordinate(1, 1)));
+    ensure(dt.removeSite(Coordinate(9, 2)));
+    ensure(dt.removeSite(Coordinate(5, 8)));
+    ensure_equals(dt.getNumSites(), 0u);
+    ensure(dt.getTriangles(geomFact)->isEmpty());
+
+    ensure(dt.insertSite(Coordinate(1, 1)));
+    ensure(dt.insertSite(Coordinate(9, 2)));
+    ensure(dt.insertSite(Coordinate(5, 8)));
+    ensure_equals(dt.getTriangles(geomFact)->getNumGeometries(), 1u);
+}
+
+// The Voronoi cells follow the updates
+template<>
+template<>
+void object::test<5>
+()
+{
+    Envelope env(0, 100, 0, 100);
+    std::vector<Coordinate> sites = randomSites(200, 23);
+
+    DynamicDelaunayTriangulation dt(env);
+    for(const Coordinate& p : sites) {
+        dt.insertSite(p);
+    }
+    for(std::size_t i = 0; i < sites.size(); i += 2) {
+        dt.removeSite(sites[i]);
+    }
+
+    VoronoiCells cells;
+    dt.getVoronoiCells(cells);
+    ensure_equals(cells.getNumCells(), 100u);
+
+    double area = 0;
+    for(std::size_t c = 0; c < cells.getNumCells(); c++) {
+        Coordinate site(cells.sites[2 * c], cells.sites[2 * c + 1]);
+        ensure(dt.containsSite(site));
+        for(std::size_t i = cells.offsets[c]; i < cells.offsets[c + 1]; i++) {
+            std::size_t j = (i + 1 < cells.offsets[c + 1]) ? i + 1 : cells.offsets[c];
+            area += cells.vertices[2 * i] * cells.vertices[2 * j + 1]
+                    - cells.vertices[2 * j] * cells.vertices[2 * i + 1];
+        }
+    }
+    ensure_distance(area / 2, env.getArea(), 1e-6);
+}
+
+} // namespace tut
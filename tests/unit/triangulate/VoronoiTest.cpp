@@ -8,7 +8,9 @@
 #include <geos/triangulate/quadedge/QuadEdge.h>
 #include <geos/triangulate/quadedge/QuadEdgeSubdivision.h>
 #include <geos/triangulate/IncrementalDelaunayTriangulator.h>
+#include <geos/triangulate/VoronoiCellLocator.h>
 #include <geos/triangulate/VoronoiDiagramBuilder.h>
+#include <geos/triangulate/quadedge/VoronoiCells.h>
 
 #include <geos/io/WKTWriter.h>
 #include <geos/io/WKTReader.h>
@@ -17,8 +19,11 @@
 #include <geos/geom/GeometryFactory.h>
 
 #include <geos/geom/CoordinateArraySequence.h>
+#include <geos/geom/Envelope.h>
+#include <geos/geom/Polygon.h>
 //#include <stdio.h>
 #include <iostream>
+#include <random>
 using namespace geos::triangulate;
 using namespace geos::triangulate::quadedge;
 using namespace geos::geom;
@@ -232,4 +237,143 @@ void object::test<10>
     runVoronoi(wkt, expected, 0);
 }
 
+// Area of a cell, which must be positive as cells are CCW
+double
+cellArea(const VoronoiCells& cells, std::size_t i)
+{
+    double area = 0;
+    std::size_t n = cells.getNumCellVertices(i);
+    const double* v = &cells.vertices[2 * cells.offsets[i]];
+    for(std::size_t j = 0; j < n; j++) {
+        std::size_t k = (j + 1) % n;
+        area += v[2 * j] * v[2 * k + 1] - v[2 * k] * v[2 * j + 1];
+    }
+    return area / 2;
+}
+
+// 11 - Flat cells match the cell polygons
+template<>
+template<>
+void object::test<11>
+()
+{
+    std::default_random_engine e(7);
+    std::uniform_real_distribution<> dis(0, 100);
+    CoordinateArraySequence seq;
+    for(int i = 0; i < 1000; i++) {
+        seq.add(Coordinate(dis(e), dis(e)));
+    }
+
+    VoronoiDiagramBuilder builder;
+    builder.setSites(seq);
+    VoronoiCells cells = builder.getDiagramCells();
+    auto polys = builder.getDiagram(*GeometryFactory::getDefaultInstance());
+
+    ensure_equals(cells.getNumCells(), seq.size());
+    ensure_equals(cells.offsets.size(), seq.size() + 1);
+    ensure_equals(cells.vertices.size(), 2 * cells.offsets.back());
+
+    double totalArea = 0;
+    for(std::size_t i = 0; i < cells.getNumCells(); i++) {
+        std::size_t site = cells.siteIndices[i];
+        ensure_equals(cells.sites[2 * i], seq.getAt(site).x);
+        ensure_equals(cells.sites[2 * i + 1], seq.getAt(site).y);
+
+        double area = cellArea(cells, i);
+        ensure(area > 0);
+        totalArea += area;
+
+        // the polygons are in the same order
+        const Geometry* poly = polys->getGeometryN(i);
+        ensure_distance(area, poly->getArea(), 1e-9 * poly->getArea());
+        Envelope env;
+        for(std::size_t j = cells.offsets[i]; j < cells.offsets[i + 1]; j++) {
+            env.expandToInclude(cells.vertices[2 * j], cells.vertices[2 * j + 1]);
+        }
+        const Envelope* polyEnv = poly->getEnvelopeInternal();
+        ensure_distance(env.getMinX(), polyEnv->getMinX(), 1e-9);
+        ensure_distance(env.getMaxX(), polyEnv->getMaxX(), 1e-9);
+        ensure_distance(env.getMinY(), polyEnv->getMinY(), 1e-9);
+        ensure_distance(env.getMaxY(), polyEnv->getMaxY(), 1e-9);
+    }
+
+    // the cells tile the diagram extent
+    VoronoiCellLocator locator(cells);
+    const Envelope& extent = locator.getExtent();
+    ensure_distance(totalArea, extent.getArea(), 1e-9 * extent.getArea());
+}
+
+// 12 - Clip envelope, repeated sites and input indices
+template<>
+template<>
+void object::test<12>
+()
+{
+    WKTReader reader;
+    auto geom = reader.read("MULTIPOINT ((5 5), (1 1), (9 2), (1 1), (3 8), (9 2), (6 9))");
+    Envelope clip(-100, 100, -50, 50);
+
+    VoronoiDiagramBuilder builder;
+    builder.setSites(*geom);
+    builder.setClipEnvelope(&clip);
+    VoronoiCells cells = builder.getDiagramCells();
+
+    ensure_equals(cells.getNumCells(), 5u);
+    double totalArea = 0;
+    for(std::size_t i = 0; i < cells.getNumCells(); i++) {
+        const Coordinate* site = geom->getGeometryN(cells.siteIndices[i])->getCoordinate();
+        ensure_equals(cells.sites[2 * i], site->x);
+        ensure_equals(cells.sites[2 * i + 1], site->y);
+        totalArea += cellArea(cells, i);
+    }
+    std::vector<std::size_t> indices(cells.siteIndices);
+    std::sort(indices.begin(), indices.end());
+    ensure(indices == std::vector<std::size_t>({0, 1, 2, 4, 6}));
+    ensure_distance(totalArea, clip.getArea(), 1e-9 * clip.getArea());
+
+    // no sites
+    VoronoiDiagramBuilder empty;
+    empty.setSites(*reader.read("MULTIPOINT EMPTY"));
+    VoronoiCells noCells = empty.getDiagramCells();
+    ensure_equals(noCells.getNumCells(), 0u);
+    ensure_equals(noCells.offsets.size(), 1u);
+}
+
+// 13 - Cell locator finds the nearest site
+template<>
+template<>
+void object::test<13>
+()
+{
+    std::default_random_engine e(5);
+    std::uniform_real_distribution<> dis(0, 100);
+    CoordinateArraySequence seq;
+    for(int i = 0; i < 2000; i++) {
+        seq.add(Coordinate(dis(e), dis(e) / 4));
+    }
+
+    VoronoiDiagramBuilder builder;
+    builder.setSites(seq);
+    VoronoiCells cells = builder.getDiagramCells();
+    VoronoiCellLocator locator(cells);
+
+    std::uniform_real_distribution<> query(-50, 150);
+    for(int i = 0; i < 2000; i++) {
+        double x = query(e);
+        double y = query(e) / 4;
+        std::size_t cell;
+        bool found = locator.locate(x, y, cell);
+        ensure_equals(found, locator.getExtent().contains(x, y));
+        if(!found) {
+            continue;
+        }
+
+        double minDist = std::numeric_limits<double>::infinity();
+        for(std::size_t j = 0; j < seq.size(); j++) {
+            minDist = std::min(minDist, seq.getAt(j).distance(Coordinate(x, y)));
+        }
+        ensure_distance(seq.getAt(cells.siteIndices[cell]).distance(Coordinate(x, y)), minDist, 1e-12);
+    }
+}
+
 } // namespace tut
@@ -0,0 +1,83 @@
+//
+// Test Suite for geos::util::ChunkedRange
+
+// tut
+#include <tut/tut.hpp>
+// geos
+#include <geos/util/ChunkedRange.h>
+#include <geos/util/IllegalArgumentException.h>
+// std
+#include <cstddef>
+#include <vector>
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_chunkedrange_data {};
+
+typedef test_group<test_chunkedrange_data> group;
+typedef group::object object;
+
+group test_chunkedrange_group("geos::util::ChunkedRange");
+
+//
+// Test Cases
+//
+
+// The chunks cover the range in order, once each
+template<>
+template<>
+void object::test<1>
+()
+{
+    using geos::util::ChunkedRange;
+
+    ensure_equals(ChunkedRange(0, 10, 4).getNumChunks(), 1u);
+    ensure_equals(ChunkedRange(25, 10, 4).getNumChunks(), 3u);
+    ensure_equals(ChunkedRange(1000, 10, 4).getNumChunks(), 4u);
+    ensure_equals(ChunkedRange(1000, 10, 0).getNumChunks(), 1u);
+
+    ChunkedRange chunks(1003, 10, 4);
+    std::vector<int> counts(1003, 0);
+    std::vector<std::size_t> sizes(chunks.getNumChunks());
+    chunks.run([&](std::size_t c, std::size_t begin, std::size_t end) {
+        ensure_equals(begin, chunks.chunkBegin(c));
+        for(std::size_t i = begin; i < end; i++) {
+            counts[i]++;
+        }
+        sizes[c] = end - begin;
+    });
+    for(int count : counts) {
+        ensure_equals(count, 1);
+    }
+    ensure_equals(sizes[0], 251u);
+    ensure_equals(sizes[3], 250u);
+}
+
+// An exception of a chunk is rethrown once all the chunks are done
+template<>
+template<>
+void object::test<2>
+()
+{
+    geos::util::ChunkedRange chunks(100, 10, 4);
+    std::vector<int> done(chunks.getNumChunks(), 0);
+    try {
+        chunks.run([&](std::size_t c, std::size_t, std::size_t) {
+            done[c] = 1;
+            if(c == 2) {
+                throw geos::util::IllegalArgumentException("chunk 2");
+            }
+        });
+        fail("IllegalArgumentException expected");
+    }
+    catch(const geos::util::IllegalArgumentException&) {
+    }
+    for(int d : done) {
+        ensure_equals(d, 1);
+    }
+}
+
+} // namespace tut